@@ -0,0 +1,22 @@
+--
+DELETE FROM `rbac_permissions` WHERE `id` BETWEEN 1000 AND 1007;
+INSERT INTO `rbac_permissions` (`id`,`name`) VALUES
+(1000,"Command: .server packetlog"),
+(1001,"Command: .server packetlog status"),
+(1002,"Command: .server packetlog start"),
+(1003,"Command: .server packetlog stop"),
+(1004,"Command: .server packetlog filter"),
+(1005,"Command: .server packetlog filter account"),
+(1006,"Command: .server packetlog filter address"),
+(1007,"Command: .server packetlog filter clear");
+
+DELETE FROM `rbac_linked_permissions` WHERE `linkedId` BETWEEN 1000 AND 1007;
+INSERT INTO `rbac_linked_permissions` (`id`,`linkedId`) VALUES
+(196,1000),
+(196,1001),
+(196,1002),
+(196,1003),
+(196,1004),
+(196,1005),
+(196,1006),
+(196,1007);
@@ -0,0 +1,10 @@
+--
+DELETE FROM `rbac_permissions` WHERE `id` IN (1008,1009);
+INSERT INTO `rbac_permissions` (`id`,`name`) VALUES
+(1008,"Command: .server scripthooks"),
+(1009,"Command: .server scripthooks reset");
+
+DELETE FROM `rbac_linked_permissions` WHERE `linkedId` IN (1008,1009);
+INSERT INTO `rbac_linked_permissions` (`id`,`linkedId`) VALUES
+(196,1008),
+(196,1009);
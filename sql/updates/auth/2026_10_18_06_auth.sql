@@ -0,0 +1,8 @@
+--
+DELETE FROM `rbac_permissions` WHERE `id`=1014;
+INSERT INTO `rbac_permissions` (`id`,`name`) VALUES
+(1014,"Command: .debug bgupdate");
+
+DELETE FROM `rbac_linked_permissions` WHERE `linkedId`=1014;
+INSERT INTO `rbac_linked_permissions` (`id`,`linkedId`) VALUES
+(196,1014);
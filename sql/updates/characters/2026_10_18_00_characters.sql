@@ -0,0 +1,32 @@
+--
+DROP TABLE IF EXISTS `calendar_events_archive`;
+CREATE TABLE `calendar_events_archive` (
+  `id` bigint(20) unsigned NOT NULL DEFAULT '0',
+  `creator` int(10) unsigned NOT NULL DEFAULT '0',
+  `title` varchar(255) NOT NULL DEFAULT '',
+  `description` varchar(255) NOT NULL DEFAULT '',
+  `type` tinyint(1) unsigned NOT NULL DEFAULT '4',
+  `dungeon` int(10) NOT NULL DEFAULT '-1',
+  `eventtime` int(10) unsigned NOT NULL DEFAULT '0',
+  `flags` int(10) unsigned NOT NULL DEFAULT '0',
+  `time2` int(10) unsigned NOT NULL DEFAULT '0',
+  `archived` int(10) unsigned NOT NULL DEFAULT '0',
+  PRIMARY KEY (`id`,`archived`),
+  KEY `idx_creator` (`creator`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8;
+
+DROP TABLE IF EXISTS `calendar_invites_archive`;
+CREATE TABLE `calendar_invites_archive` (
+  `id` bigint(20) unsigned NOT NULL DEFAULT '0',
+  `event` bigint(20) unsigned NOT NULL DEFAULT '0',
+  `invitee` int(10) unsigned NOT NULL DEFAULT '0',
+  `sender` int(10) unsigned NOT NULL DEFAULT '0',
+  `status` tinyint(1) unsigned NOT NULL DEFAULT '0',
+  `statustime` int(10) unsigned NOT NULL DEFAULT '0',
+  `rank` tinyint(1) unsigned NOT NULL DEFAULT '0',
+  `text` varchar(255) NOT NULL DEFAULT '',
+  `archived` int(10) unsigned NOT NULL DEFAULT '0',
+  PRIMARY KEY (`id`,`archived`),
+  KEY `idx_event` (`event`),
+  KEY `idx_invitee` (`invitee`)
+) ENGINE=InnoDB DEFAULT CHARSET=utf8;
@@ -0,0 +1,11 @@
+--
+DELETE FROM `command` WHERE `permission` BETWEEN 1000 AND 1007;
+INSERT INTO `command` (`name`,`permission`,`help`) VALUES
+("server packetlog",1000,"Syntax: .server packetlog $subcommand\nType .server packetlog to see the list of possible subcommands or .help server packetlog $subcommand to see info on subcommands"),
+("server packetlog status",1001,"Syntax: .server packetlog status\nShows the packet capture state, captured/dropped/filtered packet counters, the per packet producer overhead and the active filters."),
+("server packetlog start",1002,"Syntax: .server packetlog start\nResumes packet capture into PacketLogFile."),
+("server packetlog stop",1003,"Syntax: .server packetlog stop\nPauses packet capture, packets already queued are still written."),
+("server packetlog filter",1004,"Syntax: .server packetlog filter $subcommand\nType .server packetlog filter to see the list of possible subcommands or .help server packetlog filter $subcommand to see info on subcommands"),
+("server packetlog filter account",1005,"Syntax: .server packetlog filter account #accountId|$accountName\nAdds the account to the packet capture filter. While any filter is set only matching connections are captured."),
+("server packetlog filter address",1006,"Syntax: .server packetlog filter address $address\nAdds the IP address to the packet capture filter. While any filter is set only matching connections are captured."),
+("server packetlog filter clear",1007,"Syntax: .server packetlog filter clear\nRemoves all packet capture filters, every connection is captured again.");
@@ -0,0 +1,5 @@
+--
+DELETE FROM `command` WHERE `permission` IN (1008,1009);
+INSERT INTO `command` (`name`,`permission`,`help`) VALUES
+("server scripthooks",1008,"Syntax: .server scripthooks\nLists every script hook called since startup (or the last reset) with its call count and how many scripts of its type implement it."),
+("server scripthooks reset",1009,"Syntax: .server scripthooks reset\nResets the script hook call counters.");
@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `permission`=1010;
+INSERT INTO `command` (`name`,`permission`,`help`) VALUES
+("guild stats",1010,"Syntax: .guild stats\nShows how many guilds have their event logs, bank logs and bank contents loaded, along with load and unload counters.");
@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `permission`=1011;
+INSERT INTO `command` (`name`,`permission`,`help`) VALUES
+("debug spellalloc",1011,"Syntax: .debug spellalloc [reset]\nShows how many Spell objects were created and reused from the spell pool, and the heap allocations made on the spell cast path. Use reset to zero the counters.");
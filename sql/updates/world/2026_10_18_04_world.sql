@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `permission`=1012;
+INSERT INTO `command` (`name`,`permission`,`help`) VALUES
+("debug gridload",1012,"Syntax: .debug gridload\nShows grid preloader counters and, per map, how many grids were loaded on the map update thread and how long those loads stalled it.");
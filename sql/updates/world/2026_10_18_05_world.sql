@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `permission`=1013;
+INSERT INTO `command` (`name`,`permission`,`help`) VALUES
+("debug achievementcriteria",1013,"Syntax: .debug achievementcriteria [reset]\nShows, for the busiest achievement criteria types, how many criteria each update evaluated and how many were skipped as already completed. With reset, clears the counters.");
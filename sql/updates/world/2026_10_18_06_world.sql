@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `permission`=1014;
+INSERT INTO `command` (`name`,`permission`,`help`) VALUES
+("debug bgupdate",1014,"Syntax: .debug bgupdate\nLists every running battleground and arena with the number of updates done by its map and the average and maximum update time in microseconds.");
@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `permission`=1015;
+INSERT INTO `command` (`name`,`permission`,`help`) VALUES
+("debug gameeventspawns",1015,"Syntax: .debug gameeventspawns\nLists, per map, the game event spawns and despawns still waiting to be applied, how many were applied or skipped, and how many map updates had more requests than Event.SpawnsPerMapUpdate allows.");
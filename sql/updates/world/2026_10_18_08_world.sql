@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `permission`=1016;
+INSERT INTO `command` (`name`,`permission`,`help`) VALUES
+("debug respawnqueue",1016,"Syntax: .debug respawnqueue\nLists, per map, the dead creatures waiting in the respawn queue, how many were woken by the queue and how many dead creatures were still polled during the last update.");
@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `permission`=1017;
+INSERT INTO `command` (`name`,`permission`,`help`) VALUES
+("debug querycache",1017,"Syntax: .debug querycache\nLists, per query type, how many responses are cached and how many queries were answered from the cache.");
@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `permission`=1018;
+INSERT INTO `command` (`name`,`permission`,`help`) VALUES
+("debug opcodestats",1018,"Syntax: .debug opcodestats [reset]\nLists the 20 client opcodes with the highest total handler time, with call count, average and maximum time in microseconds. With reset, clears the statistics.");
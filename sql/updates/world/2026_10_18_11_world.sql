@@ -0,0 +1,4 @@
+--
+DELETE FROM `command` WHERE `permission`=1019;
+INSERT INTO `command` (`name`,`permission`,`help`) VALUES
+("debug mailexpiry",1019,"Syntax: .debug mailexpiry\nShows the progress of the running or last daily expired mail job: elapsed time, fetched chunks and the number of returned, deleted and skipped mails.");
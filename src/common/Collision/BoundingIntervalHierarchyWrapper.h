@@ -21,9 +21,11 @@
 
 #include "G3D/Table.h"
 #include "G3D/Array.h"
-#include "G3D/Set.h"
 #include "BoundingIntervalHierarchy.h"
 
+#include <algorithm>
+#include <chrono>
+
 
 template<class T, class BoundsFunc = BoundsTrait<T> >
 class BIHWrap
@@ -59,50 +61,95 @@ class BIHWrap
 
     typedef G3D::Array<const T*> ObjArray;
 
+    enum
+    {
+        // objects kept outside of the tree and tested one by one before a rebuild is needed
+        MAX_LOOSE_OBJECTS   = 16,
+        // removed objects leave a hole in the tree, rebuild once there are this many (or a quarter of the tree)
+        MIN_REMOVED_OBJECTS = 16
+    };
+
     BIH m_tree;
-    ObjArray m_objects;
+    ObjArray m_objects;                                     // tree primitives, NULL where removed since the last build
     G3D::Table<const T*, uint32> m_obj2Idx;
-    G3D::Set<const T*> m_objects_to_push;
-    int unbalanced_times;
+    ObjArray m_loose;                                       // inserted since the last build
+    uint32 m_removed;
+    uint32 m_rebuilds;
+    uint64 m_rebuildTime;                                   // microseconds
 
 public:
-    BIHWrap() : unbalanced_times(0) { }
+    BIHWrap() : m_removed(0), m_rebuilds(0), m_rebuildTime(0) { }
 
     void insert(const T& obj)
     {
-        ++unbalanced_times;
-        m_objects_to_push.insert(&obj);
+        m_loose.append(&obj);
     }
 
     void remove(const T& obj)
     {
-        ++unbalanced_times;
         uint32 Idx = 0;
         const T * temp;
         if (m_obj2Idx.getRemove(&obj, temp, Idx))
+        {
             m_objects[Idx] = NULL;
+            ++m_removed;
+        }
         else
-            m_objects_to_push.remove(&obj);
+        {
+            int looseIdx = m_loose.findIndex(&obj);
+            if (looseIdx >= 0)
+                m_loose.fastRemove(looseIdx);
+        }
     }
 
-    void balance()
+    /// Rebuilds the tree only once too many objects were added or removed since the last build,
+    /// moving objects (transports) mostly cycle through the loose list instead
+    bool balance(bool force = false)
     {
-        if (unbalanced_times == 0)
-            return;
+        if (!force && m_loose.size() <= MAX_LOOSE_OBJECTS && m_removed <= std::max<uint32>(MIN_REMOVED_OBJECTS, m_objects.size() / 4))
+            return false;
+
+        if (!m_loose.size() && !m_removed)
+            return false;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        ObjArray objects;
+        objects.reserve(m_objects.size() - m_removed + m_loose.size());
+        for (int i = 0; i < m_objects.size(); ++i)
+            if (m_objects[i])
+                objects.append(m_objects[i]);
+        objects.append(m_loose);
+
+        m_tree.build(objects, BoundsFunc::getBounds2);
 
-        unbalanced_times = 0;
         m_objects.fastClear();
-        m_obj2Idx.getKeys(m_objects);
-        m_objects_to_push.getMembers(m_objects);
-        //assert that m_obj2Idx has all the keys
+        m_objects.append(objects);
+        m_obj2Idx.clear();
+        for (int i = 0; i < m_objects.size(); ++i)
+            m_obj2Idx.set(m_objects[i], i);
 
-        m_tree.build(m_objects, BoundsFunc::getBounds2);
+        m_loose.fastClear();
+        m_removed = 0;
+
+        ++m_rebuilds;
+        m_rebuildTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+        return true;
     }
 
+    uint32 getRebuildCount() const { return m_rebuilds; }
+    uint64 getRebuildTime() const { return m_rebuildTime; }
+
     template<typename RayCallback>
     void intersectRay(const G3D::Ray& ray, RayCallback& intersectCallback, float& maxDist)
     {
         balance();
+
+        // like the tree traversal, stop at the first hit
+        for (int i = 0; i < m_loose.size(); ++i)
+            if (intersectCallback(ray, *m_loose[i], maxDist))
+                return;
+
         MDLCallback<RayCallback> temp_cb(intersectCallback, m_objects.getCArray(), m_objects.size());
         m_tree.intersectRay(ray, temp_cb, maxDist, true);
     }
@@ -111,6 +158,10 @@ public:
     void intersectPoint(const G3D::Vector3& point, IsectCallback& intersectCallback)
     {
         balance();
+
+        for (int i = 0; i < m_loose.size(); ++i)
+            intersectCallback(point, *m_loose[i]);
+
         MDLCallback<IsectCallback> callback(intersectCallback, m_objects.getCArray(), m_objects.size());
         m_tree.intersectPoint(point, callback);
     }
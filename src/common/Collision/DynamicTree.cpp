@@ -89,6 +89,23 @@ struct DynTreeImpl : public ParentTree/*, public Intersectable*/
         unbalanced_times = 0;
     }
 
+    void getRebuildStats(uint32& rebuilds, uint64& rebuildTime) const
+    {
+        rebuilds = 0;
+        rebuildTime = 0;
+        for (int x = 0; x < CELL_NUMBER; ++x)
+        {
+            for (int y = 0; y < CELL_NUMBER; ++y)
+            {
+                if (BIHWrap<GameObjectModel> const* node = nodes[x][y])
+                {
+                    rebuilds += node->getRebuildCount();
+                    rebuildTime += node->getRebuildTime();
+                }
+            }
+        }
+    }
+
     void update(uint32 difftime)
     {
         if (!size())
@@ -144,6 +161,11 @@ void DynamicMapTree::update(uint32 t_diff)
     impl->update(t_diff);
 }
 
+void DynamicMapTree::getRebuildStats(uint32& rebuilds, uint64& rebuildTime) const
+{
+    impl->getRebuildStats(rebuilds, rebuildTime);
+}
+
 struct DynamicTreeIntersectionCallback
 {
     bool did_hit;
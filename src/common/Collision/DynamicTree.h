@@ -59,6 +59,9 @@ public:
 
     void balance();
     void update(uint32 diff);
+
+    /// Number of cell tree rebuilds and the time (in microseconds) they took
+    void getRebuildStats(uint32& rebuilds, uint64& rebuildTime) const;
 };
 
 #endif // _DYNTREE_H
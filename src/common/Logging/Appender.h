@@ -101,6 +101,7 @@ class TC_COMMON_API Appender
         void write(LogMessage* message);
         static const char* getLogLevelString(LogLevel level);
         virtual void setRealmId(uint32 /*realmId*/) { }
+        virtual void flush() { }
 
     private:
         virtual void _write(LogMessage const* /*message*/) = 0;
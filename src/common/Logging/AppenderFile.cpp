@@ -78,7 +78,6 @@ void AppenderFile::_write(LogMessage const* message)
         if (!file)
             return;
         fprintf(file, "%s%s\n", message->prefix.c_str(), message->text.c_str());
-        fflush(file);
         _fileSize += uint64(message->Size());
         fclose(file);
         return;
@@ -90,10 +89,18 @@ void AppenderFile::_write(LogMessage const* message)
         return;
 
     fprintf(logfile, "%s%s\n", message->prefix.c_str(), message->text.c_str());
-    fflush(logfile);
+    // Asynchronous logging flushes once per batch from the writer thread
+    if (!sLog->IsAsync())
+        fflush(logfile);
     _fileSize += uint64(message->Size());
 }
 
+void AppenderFile::flush()
+{
+    if (logfile)
+        fflush(logfile);
+}
+
 FILE* AppenderFile::OpenFile(std::string const& filename, std::string const& mode, bool backup)
 {
     std::string fullName(_logDir + filename);
@@ -109,6 +116,9 @@ FILE* AppenderFile::OpenFile(std::string const& filename, std::string const& mod
 
     if (FILE* ret = fopen(fullName.c_str(), mode.c_str()))
     {
+        if (sLog->IsAsync())
+            setvbuf(ret, NULL, _IOFBF, 64 * 1024);
+
         _fileSize = ftell(ret);
         return ret;
     }
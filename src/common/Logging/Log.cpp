@@ -27,7 +27,8 @@
 #include <cstdio>
 #include <sstream>
 
-Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), _ioService(nullptr), _strand(nullptr)
+Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), _async(false), _queueSize(0), _flushInterval(100),
+    _pendingMessages(0), _droppedMessages(0), _reportedDroppedMessages(0), _writerThread(nullptr), _writerStop(false)
 {
     m_logsTimestamp = "_" + GetTimestampStr();
     RegisterAppender<AppenderConsole>();
@@ -36,7 +37,7 @@ Log::Log() : AppenderId(0), lowestLogLevel(LOG_LEVEL_FATAL), _ioService(nullptr)
 
 Log::~Log()
 {
-    delete _strand;
+    StopWriter();
     Close();
 }
 
@@ -224,20 +225,97 @@ void Log::ReadLoggersFromConfig()
     }
 }
 
-void Log::write(std::unique_ptr<LogMessage>&& msg) const
+void Log::write(std::unique_ptr<LogMessage>&& msg)
 {
     Logger const* logger = GetLoggerByType(msg->type);
 
-    if (_ioService)
+    if (_async)
     {
-        auto logOperation = std::shared_ptr<LogOperation>(new LogOperation(logger, std::move(msg)));
+        // The writer wakes up on its own every flush interval, only errors and a filling queue need to hurry it
+        bool wakeWriter = msg->level >= LOG_LEVEL_ERROR;
 
-        _ioService->post(_strand->wrap([logOperation](){ logOperation->call(); }));
+        _queue.Enqueue(new LogOperation(logger, std::move(msg)));
+        uint32 pending = ++_pendingMessages;
+
+        if (wakeWriter || (_queueSize && pending == _queueSize / 2))
+            _writerCondition.notify_one();
     }
     else
         logger->write(msg.get());
 }
 
+void Log::StartWriter()
+{
+    if (_writerThread)
+        return;
+
+    _writerStop = false;
+    _writerThread = new std::thread(&Log::WriterThread, this);
+}
+
+void Log::StopWriter()
+{
+    if (!_writerThread)
+        return;
+
+    _writerStop = true;
+    _writerCondition.notify_one();
+    _writerThread->join();
+
+    delete _writerThread;
+    _writerThread = nullptr;
+}
+
+void Log::WriterThread()
+{
+    while (!_writerStop)
+    {
+        {
+            std::unique_lock<std::mutex> lock(_writerMutex);
+            _writerCondition.wait_for(lock, std::chrono::milliseconds(_flushInterval));
+        }
+
+        ProcessQueue();
+    }
+
+    ProcessQueue();
+}
+
+void Log::ProcessQueue()
+{
+    uint32 processed = 0;
+    LogOperation* operation;
+    while (_queue.Dequeue(operation))
+    {
+        operation->call();
+        delete operation;
+        ++processed;
+    }
+
+    if (processed)
+        _pendingMessages -= processed;
+
+    uint64 dropped = _droppedMessages.load(std::memory_order_relaxed);
+    if (dropped != _reportedDroppedMessages)
+    {
+        if (Logger const* logger = GetLoggerByType("server"))
+        {
+            LogMessage message(LOG_LEVEL_WARN, "server", Trinity::StringFormat("Log queue full (%u messages), dropped " UI64FMTD " messages (" UI64FMTD " in total)",
+                _queueSize, dropped - _reportedDroppedMessages, dropped));
+            logger->write(&message);
+        }
+
+        _reportedDroppedMessages = dropped;
+    }
+
+    if (!processed)
+        return;
+
+    // One flush per batch instead of one per message
+    for (AppenderMap::iterator it = appenders.begin(); it != appenders.end(); ++it)
+        it->second->flush();
+}
+
 std::string Log::GetTimestampStr()
 {
     time_t tt = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
@@ -326,26 +404,27 @@ Log* Log::instance()
     return &instance;
 }
 
-void Log::Initialize(boost::asio::io_service* ioService)
+void Log::Initialize(bool async)
 {
-    if (ioService)
-    {
-        _ioService = ioService;
-        _strand = new boost::asio::strand(*ioService);
-    }
+    _async = async;
 
     LoadFromConfig();
 }
 
 void Log::SetSynchronous()
 {
-    delete _strand;
-    _strand = nullptr;
-    _ioService = nullptr;
+    StopWriter();
+    _async = false;
+
+    // Anything queued after the writer stopped
+    ProcessQueue();
 }
 
 void Log::LoadFromConfig()
 {
+    // Pending messages must reach the old appenders before they are destroyed
+    StopWriter();
+    ProcessQueue();
     Close();
 
     lowestLogLevel = LOG_LEVEL_FATAL;
@@ -355,6 +434,12 @@ void Log::LoadFromConfig()
         if ((m_logsDir.at(m_logsDir.length() - 1) != '/') && (m_logsDir.at(m_logsDir.length() - 1) != '\\'))
             m_logsDir.push_back('/');
 
+    _queueSize = uint32(std::max(0, sConfigMgr->GetIntDefault("Log.Async.QueueSize", 100000)));
+    _flushInterval = uint32(std::max(1, sConfigMgr->GetIntDefault("Log.Async.FlushInterval", 100)));
+
     ReadAppendersFromConfig();
     ReadLoggersFromConfig();
+
+    if (_async)
+        StartWriter();
 }
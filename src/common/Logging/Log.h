@@ -22,12 +22,16 @@
 #include "Define.h"
 #include "Appender.h"
 #include "Logger.h"
+#include "LogOperation.h"
+#include "MPSCQueue.h"
 #include "StringFormat.h"
 #include "Common.h"
-#include <boost/asio/io_service.hpp>
-#include <boost/asio/strand.hpp>
 
 #include <stdarg.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <string>
 #include <memory>
@@ -46,8 +50,9 @@ class TC_COMMON_API Log
 
         static Log* instance();
 
-        void Initialize(boost::asio::io_service* ioService);
+        void Initialize(bool async);
         void SetSynchronous();  // Not threadsafe - should only be called from main() after all threads are joined
+        bool IsAsync() const { return _async; }
         void LoadFromConfig();
         void Close();
         bool ShouldLog(std::string const& type, LogLevel level) const;
@@ -56,6 +61,10 @@ class TC_COMMON_API Log
         template<typename Format, typename... Args>
         inline void outMessage(std::string const& filter, LogLevel const level, Format&& fmt, Args&&... args)
         {
+            // Checked before formatting so that dropping a message costs nothing more than a counter
+            if (ShouldDrop(level))
+                return;
+
             write(Trinity::make_unique<LogMessage>(level, filter,
                 Trinity::StringFormat(std::forward<Format>(fmt), std::forward<Args>(args)...)));
         }
@@ -91,9 +100,18 @@ class TC_COMMON_API Log
         std::string const& GetLogsDir() const { return m_logsDir; }
         std::string const& GetLogsTimestamp() const { return m_logsTimestamp; }
 
+        uint32 GetPendingMessageCount() const { return _pendingMessages.load(std::memory_order_relaxed); }
+        uint64 GetDroppedMessageCount() const { return _droppedMessages.load(std::memory_order_relaxed); }
+
     private:
         static std::string GetTimestampStr();
-        void write(std::unique_ptr<LogMessage>&& msg) const;
+        void write(std::unique_ptr<LogMessage>&& msg);
+        bool ShouldDrop(LogLevel level);
+
+        void StartWriter();
+        void StopWriter();
+        void WriterThread();
+        void ProcessQueue();
 
         Logger const* GetLoggerByType(std::string const& type) const;
         Appender* GetAppenderByName(std::string const& name);
@@ -112,8 +130,18 @@ class TC_COMMON_API Log
         std::string m_logsDir;
         std::string m_logsTimestamp;
 
-        boost::asio::io_service* _ioService;
-        boost::asio::strand* _strand;
+        // Asynchronous mode: producers push into a lock free queue drained in batches by a single writer thread
+        bool _async;
+        uint32 _queueSize;
+        uint32 _flushInterval;
+        MPSCQueue<LogOperation> _queue;
+        std::atomic<uint32> _pendingMessages;
+        std::atomic<uint64> _droppedMessages;
+        uint64 _reportedDroppedMessages;
+        std::thread* _writerThread;
+        std::atomic<bool> _writerStop;
+        std::mutex _writerMutex;
+        std::condition_variable _writerCondition;
 };
 
 inline Logger const* Log::GetLoggerByType(std::string const& type) const
@@ -151,6 +179,19 @@ inline bool Log::ShouldLog(std::string const& type, LogLevel level) const
     return logLevel != LOG_LEVEL_DISABLED && logLevel <= level;
 }
 
+inline bool Log::ShouldDrop(LogLevel level)
+{
+    // Errors are never dropped, everything else is discarded while the writer thread is behind
+    if (!_async || !_queueSize || level >= LOG_LEVEL_ERROR)
+        return false;
+
+    if (_pendingMessages.load(std::memory_order_relaxed) < _queueSize)
+        return false;
+
+    ++_droppedMessages;
+    return true;
+}
+
 #define sLog Log::instance()
 
 #define LOG_EXCEPTION_FREE(filterType__, level__, ...) \
@@ -18,7 +18,10 @@
 #ifndef _CALLBACK_H
 #define _CALLBACK_H
 
+#include <functional>
 #include <future>
+#include <memory>
+#include <vector>
 #include "QueryResult.h"
 
 typedef std::future<QueryResult> QueryResultFuture;
@@ -206,4 +209,62 @@ class QueryCallback_2
         QueryCallback_2& operator=(QueryCallback_2 const& right) = delete;
 };
 
+//! Holds the callbacks of pending async queries until their results arrive.
+//! The owner polls ProcessReadyQueries() from its own update, so every callback resumes on the owner's thread.
+//! A callback may add further queries to the same processor, which turns dependent lookups into a chain
+//! instead of a series of blocking queries.
+class QueryCallbackProcessor
+{
+    public:
+        QueryCallbackProcessor() { }
+
+        template <typename Result, typename Callback>
+        void AddQuery(std::future<Result>&& future, Callback&& callback)
+        {
+            // std::function needs copyable targets, so the future is shared with the wrapper
+            std::shared_ptr<std::future<Result>> pending = std::make_shared<std::future<Result>>(std::move(future));
+            std::function<void(Result)> resultHandler(std::forward<Callback>(callback));
+            _callbacks.push_back([pending, resultHandler]() -> bool
+            {
+                if (pending->wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                    return false;
+
+                resultHandler(pending->get());
+                return true;
+            });
+        }
+
+        void ProcessReadyQueries()
+        {
+            if (_callbacks.empty())
+                return;
+
+            // callbacks may add the next query of their chain, those are only polled in the next call
+            std::vector<std::function<bool()>> callbacks;
+            callbacks.swap(_callbacks);
+
+            for (std::vector<std::function<bool()>>::iterator itr = callbacks.begin(); itr != callbacks.end();)
+            {
+                if ((*itr)())
+                    itr = callbacks.erase(itr);
+                else
+                    ++itr;
+            }
+
+            callbacks.insert(callbacks.end(), _callbacks.begin(), _callbacks.end());
+            _callbacks.swap(callbacks);
+        }
+
+        //! Drops all pending callbacks, the queries themselves still complete in the database workers
+        void CancelAll() { _callbacks.clear(); }
+
+        bool HasPendingQueries() const { return !_callbacks.empty(); }
+
+    private:
+        std::vector<std::function<bool()>> _callbacks;
+
+        QueryCallbackProcessor(QueryCallbackProcessor const& right) = delete;
+        QueryCallbackProcessor& operator=(QueryCallbackProcessor const& right) = delete;
+};
+
 #endif
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2008-2016 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_SMALLVECTOR_H
+#define TRINITY_SMALLVECTOR_H
+
+#include "Define.h"
+#include <algorithm>
+#include <iterator>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace Trinity
+{
+    /**
+     * Vector that keeps up to N elements inside the object itself and only
+     * allocates once it grows beyond that. Like std::vector, growing and
+     * erasing invalidate iterators and references to the elements.
+     */
+    template<class T, size_t N>
+    class SmallVector
+    {
+        public:
+            typedef T value_type;
+            typedef T* iterator;
+            typedef T const* const_iterator;
+            typedef std::reverse_iterator<iterator> reverse_iterator;
+            typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+            typedef size_t size_type;
+
+            SmallVector() : _data(InlineData()), _size(0), _capacity(N) { }
+
+            ~SmallVector()
+            {
+                clear();
+                if (!IsInline())
+                    ::operator delete(_data);
+            }
+
+            SmallVector(SmallVector const&) = delete;
+            SmallVector& operator=(SmallVector const&) = delete;
+
+            iterator begin() { return _data; }
+            iterator end() { return _data + _size; }
+            const_iterator begin() const { return _data; }
+            const_iterator end() const { return _data + _size; }
+            reverse_iterator rbegin() { return reverse_iterator(end()); }
+            reverse_iterator rend() { return reverse_iterator(begin()); }
+            const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+            const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+            size_type size() const { return _size; }
+            size_type capacity() const { return _capacity; }
+            bool empty() const { return _size == 0; }
+            /// true once the elements no longer fit the inline storage
+            bool spilled() const { return !IsInline(); }
+
+            T& operator[](size_type index) { return _data[index]; }
+            T const& operator[](size_type index) const { return _data[index]; }
+            T& front() { return _data[0]; }
+            T const& front() const { return _data[0]; }
+            T& back() { return _data[_size - 1]; }
+            T const& back() const { return _data[_size - 1]; }
+
+            void push_back(T const& value)
+            {
+                if (_size == _capacity)
+                {
+                    // value may live in our own storage
+                    T copy(value);
+                    Grow(_capacity * 2);
+                    new (_data + _size) T(std::move(copy));
+                }
+                else
+                    new (_data + _size) T(value);
+                ++_size;
+            }
+
+            iterator erase(iterator itr)
+            {
+                std::move(itr + 1, end(), itr);
+                --_size;
+                _data[_size].~T();
+                return itr;
+            }
+
+            void clear()
+            {
+                for (size_type i = 0; i < _size; ++i)
+                    _data[i].~T();
+                _size = 0;
+            }
+
+            void reserve(size_type capacity)
+            {
+                if (capacity > _capacity)
+                    Grow(capacity);
+            }
+
+        private:
+            typedef typename std::aligned_storage<sizeof(T), std::alignment_of<T>::value>::type Storage;
+
+            T* InlineData() { return reinterpret_cast<T*>(&_inline[0]); }
+            bool IsInline() const { return _data == reinterpret_cast<T const*>(&_inline[0]); }
+
+            void Grow(size_type capacity)
+            {
+                T* data = static_cast<T*>(::operator new(capacity * sizeof(T)));
+                for (size_type i = 0; i < _size; ++i)
+                {
+                    new (data + i) T(std::move(_data[i]));
+                    _data[i].~T();
+                }
+
+                if (!IsInline())
+                    ::operator delete(_data);
+
+                _data = data;
+                _capacity = capacity;
+            }
+
+            Storage _inline[N];
+            T* _data;
+            size_type _size;
+            size_type _capacity;
+    };
+}
+
+#endif // TRINITY_SMALLVECTOR_H
@@ -105,7 +105,7 @@ int main(int argc, char** argv)
     }
 
     sLog->RegisterAppender<AppenderDB>();
-    sLog->Initialize(nullptr);
+    sLog->Initialize(false);
 
     TC_LOG_INFO("server.authserver", "%s (authserver)", GitRevision::GetFullVersion());
     TC_LOG_INFO("server.authserver", "<Ctrl-C> to stop.\n");
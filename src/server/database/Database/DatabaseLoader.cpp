@@ -52,6 +52,8 @@ DatabaseLoader& DatabaseLoader::AddDatabase(DatabaseWorkerPool<T>& pool, std::st
         uint8 const synchThreads = uint8(sConfigMgr->GetIntDefault(name + "Database.SynchThreads", 1));
 
         pool.SetConnectionInfo(dbString, asyncThreads, synchThreads);
+        pool.SetBulkLoad(sConfigMgr->GetBoolDefault(name + "Database.BulkLoad", true));
+        pool.SetQueryHolderFanOut(uint8(sConfigMgr->GetIntDefault(name + "Database.QueryHolderFanOut", 0)));
         if (uint32 error = pool.Open())
         {
             // Database does not exist
@@ -17,6 +17,8 @@
 
 #include "DatabaseWorkerPool.h"
 #include "DatabaseEnv.h"
+#include "SynchronousQueryWatch.h"
+#include "Timer.h"
 
 #define MIN_MYSQL_SERVER_VERSION 50100u
 #define MIN_MYSQL_CLIENT_VERSION 50100u
@@ -24,7 +26,7 @@
 template <class T>
 DatabaseWorkerPool<T>::DatabaseWorkerPool()
     : _queue(new ProducerConsumerQueue<SQLOperation*>()),
-      _async_threads(0), _synch_threads(0)
+      _async_threads(0), _synch_threads(0), _holderFanOut(0), _bulkLoad(true)
 {
     WPFatal(mysql_thread_safe(), "Used MySQL library isn't thread-safe.");
     WPFatal(mysql_get_client_version() >= MIN_MYSQL_CLIENT_VERSION, "TrinityCore does not support MySQL versions below 5.1");
@@ -115,8 +117,14 @@ QueryResult DatabaseWorkerPool<T>::Query(const char* sql, T* connection /*= null
     if (!connection)
         connection = GetFreeConnection();
 
+    bool const watched = SynchronousQueryWatch::IsWatching();
+    uint32 const startTime = watched ? getMSTime() : 0;
+
     ResultSet* result = connection->Query(sql);
     connection->Unlock();
+
+    if (watched)
+        SynchronousQueryWatch::Report(GetDatabaseName(), sql, GetMSTimeDiffToNow(startTime));
     if (!result || !result->GetRowCount() || !result->NextRow())
     {
         delete result;
@@ -129,10 +137,16 @@ QueryResult DatabaseWorkerPool<T>::Query(const char* sql, T* connection /*= null
 template <class T>
 PreparedQueryResult DatabaseWorkerPool<T>::Query(PreparedStatement* stmt)
 {
+    bool const watched = SynchronousQueryWatch::IsWatching();
+    uint32 const startTime = watched ? getMSTime() : 0;
+
     auto connection = GetFreeConnection();
     PreparedResultSet* ret = connection->Query(stmt);
     connection->Unlock();
 
+    if (watched)
+        SynchronousQueryWatch::Report(GetDatabaseName(), stmt->GetIndex(), GetMSTimeDiffToNow(startTime));
+
     //! Delete proxy-class. Not needed anymore
     delete stmt;
 
@@ -145,6 +159,35 @@ PreparedQueryResult DatabaseWorkerPool<T>::Query(PreparedStatement* stmt)
     return PreparedQueryResult(ret);
 }
 
+template <class T>
+BulkQueryResult DatabaseWorkerPool<T>::BulkQuery(const char* sql)
+{
+    uint32 startTime = getMSTime();
+    if (!_bulkLoad)
+    {
+        QueryResult result = Query(sql);
+        if (!result)
+            return BulkQueryResult(nullptr);
+
+        return BulkQueryResult(new BulkResultSet(result, sql, startTime));
+    }
+
+    auto connection = GetFreeConnection();
+    BulkResultSet* ret = connection->BulkQuery(sql);
+    if (!ret)
+    {
+        connection->Unlock();
+        return BulkQueryResult(nullptr);
+    }
+
+    //! From here on the result set releases the connection
+    BulkQueryResult result(ret);
+    if (!result->NextRow())
+        return BulkQueryResult(nullptr);
+
+    return result;
+}
+
 template <class T>
 QueryResultFuture DatabaseWorkerPool<T>::AsyncQuery(const char* sql)
 {
@@ -166,12 +209,17 @@ PreparedQueryResultFuture DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement* s
 }
 
 template <class T>
-QueryResultHolderFuture DatabaseWorkerPool<T>::DelayQueryHolder(SQLQueryHolder* holder)
+QueryResultHolderFuture DatabaseWorkerPool<T>::DelayQueryHolder(SQLQueryHolder* holder, char const* name)
 {
-    SQLQueryHolderTask* task = new SQLQueryHolderTask(holder);
-    // Store future result before enqueueing - task might get already processed and deleted before returning from this method
-    QueryResultHolderFuture result = task->GetFuture();
-    Enqueue(task);
+    uint32 parts = _holderFanOut ? std::min(_holderFanOut, _async_threads) : _async_threads;
+    parts = std::max<uint32>(1, std::min<uint32>(parts, holder->GetSize()));
+
+    std::shared_ptr<SQLQueryHolderBatch> batch = std::make_shared<SQLQueryHolderBatch>(holder, name, parts, getMSTime());
+    // Store future result before enqueueing - tasks might get already processed and deleted before returning from this method
+    QueryResultHolderFuture result = batch->Result.get_future();
+    for (uint32 i = 0; i < parts; ++i)
+        Enqueue(new SQLQueryHolderTask(batch));
+
     return result;
 }
 
@@ -186,6 +186,23 @@ class DatabaseWorkerPool
         //! Statement must be prepared with CONNECTION_SYNCH flag.
         PreparedQueryResult Query(PreparedStatement* stmt);
 
+        //! Executes an SQL query in string format and streams its rows through the binary protocol.
+        //! Meant for large startup tables. Keeps a synchronous connection reserved until the result is destroyed.
+        BulkQueryResult BulkQuery(const char* sql);
+
+        //! Executes an SQL query in string format -with variable args- and streams its rows through the binary protocol.
+        template<typename Format, typename... Args>
+        BulkQueryResult BulkPQuery(Format&& sql, Args&&... args)
+        {
+            if (!sql)
+                return BulkQueryResult(nullptr);
+
+            return BulkQuery(Trinity::StringFormat(std::forward<Format>(sql), std::forward<Args>(args)...).c_str());
+        }
+
+        //! Falls back to buffered text protocol queries for BulkQuery when disabled
+        void SetBulkLoad(bool enabled) { _bulkLoad = enabled; }
+
         /**
             Asynchronous query (with resultset) methods.
         */
@@ -211,7 +228,12 @@ class DatabaseWorkerPool
         //! return object as soon as the query is executed.
         //! The return value is then processed in ProcessQueryCallback methods.
         //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
-        QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder* holder);
+        //! The queries are spread over up to SetQueryHolderFanOut async connections, so they must not depend on each other.
+        //! Latency percentiles are logged per holder name.
+        QueryResultHolderFuture DelayQueryHolder(SQLQueryHolder* holder, char const* name = "query holder");
+
+        //! Maximum number of async connections a single query holder is spread over, 0 uses all of them
+        void SetQueryHolderFanOut(uint8 fanOut) { _holderFanOut = fanOut; }
 
         /**
             Transaction context methods.
@@ -302,6 +324,8 @@ class DatabaseWorkerPool
         std::array<std::vector<std::unique_ptr<T>>, IDX_SIZE> _connections;
         std::unique_ptr<MySQLConnectionInfo> _connectionInfo;
         uint8 _async_threads, _synch_threads;
+        uint8 _holderFanOut;
+        bool _bulkLoad;
 };
 
 #endif
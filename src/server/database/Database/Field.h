@@ -57,6 +57,7 @@ class TC_DATABASE_API Field
 {
     friend class ResultSet;
     friend class PreparedResultSet;
+    friend class BulkResultSet;
 
     public:
         Field();
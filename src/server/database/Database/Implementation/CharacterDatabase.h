@@ -52,7 +52,6 @@ enum CharacterDatabaseStatements
     CHAR_SEL_ENUM_DECLINED_NAME,
     CHAR_SEL_FREE_NAME,
     CHAR_SEL_GUID_RACE_ACC_BY_NAME,
-    CHAR_SEL_CHAR_RACE,
     CHAR_SEL_CHAR_LEVEL,
     CHAR_SEL_CHAR_ZONE,
     CHAR_SEL_CHARACTER_NAME_DATA,
@@ -99,6 +98,7 @@ enum CharacterDatabaseStatements
     CHAR_SEL_CHARACTER_SPELLCOOLDOWNS,
     CHAR_SEL_CHARACTER_DECLINEDNAMES,
     CHAR_SEL_GUILD_MEMBER,
+    CHAR_SEL_CALENDAR_INVITEE_INFO,
     CHAR_SEL_GUILD_MEMBER_EXTENDED,
     CHAR_SEL_CHARACTER_ARENAINFO,
     CHAR_SEL_CHARACTER_ACHIEVEMENTS,
@@ -126,8 +126,13 @@ enum CharacterDatabaseStatements
     CHAR_DEL_EMPTY_EXPIRED_MAIL,
     CHAR_SEL_EXPIRED_MAIL,
     CHAR_SEL_EXPIRED_MAIL_ITEMS,
+    CHAR_SEL_EXPIRED_MAIL_CHUNK,
+    CHAR_SEL_EXPIRED_MAIL_ITEMS_RANGE,
     CHAR_UPD_MAIL_RETURNED,
-    CHAR_UPD_MAIL_ITEM_RECEIVER,
+    CHAR_DEL_EXPIRED_MAIL_BY_ID,
+    CHAR_UPD_EXPIRED_MAIL_ITEM_RECEIVER,
+    CHAR_UPD_EXPIRED_MAIL_ITEM_OWNER,
+    CHAR_DEL_EXPIRED_MAIL_ITEM_INSTANCE,
     CHAR_UPD_ITEM_OWNER,
     CHAR_SEL_ITEM_REFUNDS,
     CHAR_SEL_ITEM_BOP_TRADE,
@@ -178,6 +183,10 @@ enum CharacterDatabaseStatements
     CHAR_INS_GUILD_EVENTLOG,
     CHAR_DEL_GUILD_EVENTLOG,
     CHAR_DEL_GUILD_EVENTLOGS,
+    CHAR_SEL_GUILD_EVENTLOGS,
+    CHAR_SEL_GUILD_BANK_EVENTLOGS,
+    CHAR_SEL_GUILD_BANK_ITEMS,
+    CHAR_DEL_GUILD_BANK_ITEM_INSTANCES,
     CHAR_UPD_GUILD_MEMBER_PNOTE,
     CHAR_UPD_GUILD_MEMBER_OFFNOTE,
     CHAR_UPD_GUILD_MEMBER_RANK,
@@ -249,7 +258,6 @@ enum CharacterDatabaseStatements
     CHAR_SEL_PETITION_SIGNATURE,
     CHAR_DEL_ALL_PETITION_SIGNATURES,
     CHAR_DEL_PETITION_SIGNATURE,
-    CHAR_SEL_PETITION_BY_OWNER,
     CHAR_SEL_PETITION_TYPE,
     CHAR_SEL_PETITION_SIGNATURES,
     CHAR_SEL_PETITION_SIG_BY_ACCOUNT,
@@ -361,7 +369,7 @@ enum CharacterDatabaseStatements
     CHAR_SEL_CHAR_HOMEBIND,
     CHAR_SEL_CHAR_GUID_NAME_BY_ACC,
     CHAR_SEL_POOL_QUEST_SAVE,
-    CHAR_SEL_CHARACTER_AT_LOGIN,
+    CHAR_SEL_CHAR_CUSTOMIZE_INFO,
     CHAR_SEL_CHAR_CLASS_LVL_AT_LOGIN,
     CHAR_SEL_CHAR_AT_LOGIN_TITLES,
     CHAR_SEL_INSTANCE,
@@ -419,7 +427,6 @@ enum CharacterDatabaseStatements
     CHAR_UPD_CHAR_INVENTORY_FACTION_CHANGE,
     CHAR_DEL_CHAR_SPELL_BY_SPELL,
     CHAR_UPD_CHAR_SPELL_FACTION_CHANGE,
-    CHAR_SEL_CHAR_REP_BY_FACTION,
     CHAR_DEL_CHAR_REP_BY_FACTION,
     CHAR_UPD_CHAR_REP_FACTION_CHANGE,
     CHAR_UPD_CHAR_TITLES_FACTION_CHANGE,
@@ -470,6 +477,7 @@ enum CharacterDatabaseStatements
     CHAR_DEL_PETITION_SIGNATURE_BY_OWNER,
     CHAR_DEL_PETITION_BY_OWNER_AND_TYPE,
     CHAR_DEL_PETITION_SIGNATURE_BY_OWNER_AND_TYPE,
+    CHAR_DEL_PETITION_SIGNATURES_BY_OWNER_PETITIONS,
     CHAR_INS_CHAR_GLYPHS,
     CHAR_DEL_CHAR_TALENT_BY_SPELL_SPEC,
     CHAR_INS_CHAR_TALENT,
@@ -479,6 +487,9 @@ enum CharacterDatabaseStatements
     CHAR_DEL_CALENDAR_EVENT,
     CHAR_REP_CALENDAR_INVITE,
     CHAR_DEL_CALENDAR_INVITE,
+    CHAR_DEL_CALENDAR_INVITES_BY_EVENT,
+    CHAR_INS_CALENDAR_EVENT_ARCHIVE,
+    CHAR_INS_CALENDAR_INVITES_ARCHIVE,
 
     CHAR_SEL_PET_AURA,
     CHAR_SEL_PET_SPELL,
@@ -457,6 +457,46 @@ void MySQLConnection::PrepareStatement(uint32 index, const char* sql, Connection
     }
 }
 
+BulkResultSet* MySQLConnection::BulkQuery(const char* sql)
+{
+    if (!m_Mysql || !sql)
+        return NULL;
+
+    uint32 _s = getMSTime();
+
+    MYSQL_STMT* stmt = mysql_stmt_init(m_Mysql);
+    if (!stmt)
+    {
+        TC_LOG_ERROR("sql.sql", "In mysql_stmt_init() sql: \"%s\"", sql);
+        TC_LOG_ERROR("sql.sql", "%s", mysql_error(m_Mysql));
+        return NULL;
+    }
+
+    // Rows are read unbuffered (no mysql_stmt_store_result), the statement is closed by BulkResultSet
+    if (mysql_stmt_prepare(stmt, sql, static_cast<unsigned long>(strlen(sql))) || mysql_stmt_execute(stmt))
+    {
+        uint32 lErrno = mysql_errno(m_Mysql);
+        TC_LOG_ERROR("sql.sql", "SQL(b): %s\n [ERROR]: [%u] %s", sql, lErrno, mysql_stmt_error(stmt));
+        mysql_stmt_close(stmt);
+
+        if (_HandleMySQLErrno(lErrno))  // If it returns true, an error was handled successfully (i.e. reconnection)
+            return BulkQuery(sql);      // Try again
+
+        return NULL;
+    }
+
+    TC_LOG_DEBUG("sql.sql", "[%u ms] SQL(b): %s", getMSTimeDiff(_s, getMSTime()), sql);
+
+    MYSQL_RES* metadata = mysql_stmt_result_metadata(stmt);
+    if (!metadata)
+    {
+        mysql_stmt_close(stmt);
+        return NULL;
+    }
+
+    return new BulkResultSet(this, stmt, metadata, sql, _s);
+}
+
 PreparedResultSet* MySQLConnection::Query(PreparedStatement* stmt)
 {
     MYSQL_RES *result = NULL;
@@ -94,6 +94,8 @@ class TC_DATABASE_API PreparedStatement
         void setString(const uint8 index, const std::string& value);
         void setNull(const uint8 index);
 
+        uint32 GetIndex() const { return m_index; }
+
     protected:
         void BindParameters();
 
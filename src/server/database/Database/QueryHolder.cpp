@@ -19,6 +19,9 @@
 #include "QueryHolder.h"
 #include "PreparedStatement.h"
 #include "Log.h"
+#include "Timer.h"
+
+#include <algorithm>
 
 bool SQLQueryHolder::SetQuery(size_t index, const char *sql)
 {
@@ -143,47 +146,85 @@ void SQLQueryHolder::SetSize(size_t size)
     m_queries.resize(size);
 }
 
-SQLQueryHolderTask::~SQLQueryHolderTask()
+void SQLQueryHolder::ExecuteQuery(MySQLConnection* conn, size_t index)
 {
-    if (!m_executed)
-        delete m_holder;
+    SQLElementData* data = &m_queries[index].first;
+    switch (data->type)
+    {
+        case SQL_ELEMENT_RAW:
+        {
+            char const* sql = data->element.query;
+            if (sql)
+                SetResult(index, conn->Query(sql));
+            break;
+        }
+        case SQL_ELEMENT_PREPARED:
+        {
+            PreparedStatement* stmt = data->element.stmt;
+            if (stmt)
+                SetPreparedResult(index, conn->Query(stmt));
+            break;
+        }
+    }
 }
 
-bool SQLQueryHolderTask::Execute()
+std::mutex SQLQueryHolderStats::_lock;
+std::map<std::string, SQLQueryHolderStats::Window> SQLQueryHolderStats::_windows;
+
+void SQLQueryHolderStats::Record(char const* name, uint32 queries, uint32 latency)
+{
+    std::vector<uint32> samples;
+    uint64 totalQueries;
+    uint64 total;
+
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        Window& window = _windows[name];
+        window.Samples.push_back(latency);
+        window.Queries += queries;
+        window.Total += latency;
+        if (window.Samples.size() < WINDOW_SIZE)
+            return;
+
+        samples.swap(window.Samples);
+        totalQueries = window.Queries;
+        total = window.Total;
+        window = Window();
+    }
+
+    /// sort outside of the lock, the window is ours now
+    std::sort(samples.begin(), samples.end());
+    size_t const count = samples.size();
+    auto percentile = [&samples, count](uint32 pct) { return samples[std::min(count - 1, count * pct / 100)]; };
+
+    TC_LOG_INFO("sql.holder", "Query holder '%s': %u holders (%.1f queries avg), latency avg %u ms, p50 %u ms, p95 %u ms, p99 %u ms, max %u ms",
+        name, uint32(count), double(totalQueries) / count, uint32(total / count), percentile(50), percentile(95), percentile(99), samples.back());
+}
+
+SQLQueryHolderBatch::~SQLQueryHolderBatch()
 {
-    m_executed = true;
+    /// the queue was cancelled before all parts ran, nobody is going to receive the holder
+    if (!Completed)
+        delete Holder;
+}
 
-    if (!m_holder)
+bool SQLQueryHolderTask::Execute()
+{
+    SQLQueryHolder* holder = m_batch->Holder;
+    if (!holder)
         return false;
 
-    /// we can do this, we are friends
-    std::vector<SQLQueryHolder::SQLResultPair> &queries = m_holder->m_queries;
+    size_t const count = holder->m_queries.size();
+    for (size_t i = m_batch->NextQuery++; i < count; i = m_batch->NextQuery++)
+        holder->ExecuteQuery(m_conn, i);
 
-    for (size_t i = 0; i < queries.size(); i++)
-    {
-        /// execute all queries in the holder and pass the results
-        if (SQLElementData* data = &queries[i].first)
-        {
-            switch (data->type)
-            {
-                case SQL_ELEMENT_RAW:
-                {
-                    char const* sql = data->element.query;
-                    if (sql)
-                        m_holder->SetResult(i, m_conn->Query(sql));
-                    break;
-                }
-                case SQL_ELEMENT_PREPARED:
-                {
-                    PreparedStatement* stmt = data->element.stmt;
-                    if (stmt)
-                        m_holder->SetPreparedResult(i, m_conn->Query(stmt));
-                    break;
-                }
-            }
-        }
-    }
+    /// results of the other parts are visible here through the acq_rel decrement
+    if (m_batch->PendingParts.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        return true;
+
+    SQLQueryHolderStats::Record(m_batch->Name, uint32(count), GetMSTimeDiffToNow(m_batch->StartTime));
 
-    m_result.set_value(m_holder);
+    m_batch->Completed = true;
+    m_batch->Result.set_value(holder);
     return true;
 }
@@ -19,6 +19,11 @@
 #define _QUERYHOLDER_H
 
 #include <future>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <map>
+#include <string>
 
 class TC_DATABASE_API SQLQueryHolder
 {
@@ -26,6 +31,8 @@ class TC_DATABASE_API SQLQueryHolder
     private:
         typedef std::pair<SQLElementData, SQLResultSetUnion> SQLResultPair;
         std::vector<SQLResultPair> m_queries;
+
+        void ExecuteQuery(MySQLConnection* conn, size_t index);
     public:
         SQLQueryHolder() { }
         ~SQLQueryHolder();
@@ -37,6 +44,7 @@ class TC_DATABASE_API SQLQueryHolder
         }
         bool SetPreparedQuery(size_t index, PreparedStatement* stmt);
         void SetSize(size_t size);
+        size_t GetSize() const { return m_queries.size(); }
         QueryResult GetResult(size_t index);
         PreparedQueryResult GetPreparedResult(size_t index);
         void SetResult(size_t index, ResultSet* result);
@@ -46,21 +54,57 @@ class TC_DATABASE_API SQLQueryHolder
 typedef std::future<SQLQueryHolder*> QueryResultHolderFuture;
 typedef std::promise<SQLQueryHolder*> QueryResultHolderPromise;
 
+/// Latency of completed holders (enqueue to last result), logged as percentiles per holder name
+class TC_DATABASE_API SQLQueryHolderStats
+{
+    public:
+        static uint32 const WINDOW_SIZE = 256;
+
+        static void Record(char const* name, uint32 queries, uint32 latency);
+
+    private:
+        struct Window
+        {
+            Window() : Queries(0), Total(0) { }
+
+            std::vector<uint32> Samples;
+            uint64 Queries;
+            uint64 Total;
+        };
+
+        static std::mutex _lock;
+        static std::map<std::string, Window> _windows;
+};
+
+/// State shared by every task a holder has been split into; the last task to finish fulfils the promise
+struct SQLQueryHolderBatch
+{
+    SQLQueryHolderBatch(SQLQueryHolder* holder, char const* name, uint32 parts, uint32 startTime)
+        : Holder(holder), Name(name), NextQuery(0), PendingParts(parts), StartTime(startTime), Completed(false) { }
+
+    ~SQLQueryHolderBatch();
+
+    SQLQueryHolder* Holder;
+    char const* Name;
+    QueryResultHolderPromise Result;
+    std::atomic<size_t> NextQuery;
+    std::atomic<uint32> PendingParts;
+    uint32 StartTime;
+    bool Completed;
+};
+
+/// One of the (possibly several) async operations executing a holder. Every task claims
+/// queries from the shared batch until none are left, so idle connections pick up the slack.
 class TC_DATABASE_API SQLQueryHolderTask : public SQLOperation
 {
     private:
-        SQLQueryHolder* m_holder;
-        QueryResultHolderPromise m_result;
-        bool m_executed;
+        std::shared_ptr<SQLQueryHolderBatch> m_batch;
 
     public:
-        SQLQueryHolderTask(SQLQueryHolder* holder)
-            : m_holder(holder), m_executed(false) { }
-
-        ~SQLQueryHolderTask();
+        SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBatch> batch)
+            : m_batch(std::move(batch)) { }
 
         bool Execute() override;
-        QueryResultHolderFuture GetFuture() { return m_result.get_future(); }
 };
 
 #endif
@@ -18,6 +18,7 @@
 
 #include "DatabaseEnv.h"
 #include "Log.h"
+#include "Timer.h"
 
 ResultSet::ResultSet(MYSQL_RES *result, MYSQL_FIELD *fields, uint64 rowCount, uint32 fieldCount) :
 _rowCount(rowCount),
@@ -214,6 +215,215 @@ bool PreparedResultSet::_NextRow()
     return retval == 0 || retval == MYSQL_DATA_TRUNCATED;
 }
 
+namespace
+{
+    std::string GetQueryTableName(char const* sql)
+    {
+        char const* from = strstr(sql, " FROM ");
+        if (!from)
+            return "<unknown>";
+
+        from += strlen(" FROM ");
+        return std::string(from, strcspn(from, " ,;"));
+    }
+}
+
+BulkResultSet::BulkResultSet(MySQLConnection* connection, MYSQL_STMT* stmt, MYSQL_RES* metadata, char const* sql, uint32 startTime) :
+m_rowCount(0),
+m_fieldCount(mysql_stmt_field_count(stmt)),
+m_startTime(startTime),
+m_table(GetQueryTableName(sql)),
+m_currentRow(new Field[m_fieldCount]),
+m_connection(connection),
+m_stmt(stmt),
+m_metadataResult(metadata),
+m_rBind(m_fieldCount),
+m_buffers(m_fieldCount),
+m_types(m_fieldCount),
+m_length(m_fieldCount, 0),
+m_isNull(m_fieldCount, 0),
+m_error(m_fieldCount, 0)
+{
+    memset(m_rBind.data(), 0, sizeof(MYSQL_BIND) * m_fieldCount);
+
+    MYSQL_FIELD* field = mysql_fetch_fields(m_metadataResult);
+    for (uint32 i = 0; i < m_fieldCount; ++i)
+    {
+        enum_field_types bufferType = field[i].type;
+        uint32 size;
+        switch (field[i].type)
+        {
+#if TRINITY_ENDIAN == TRINITY_LITTLEENDIAN
+            // Integers are widened so that reading them with a getter of a smaller or larger type still yields the value
+            case MYSQL_TYPE_TINY:
+            case MYSQL_TYPE_SHORT:
+            case MYSQL_TYPE_YEAR:
+            case MYSQL_TYPE_INT24:
+            case MYSQL_TYPE_LONG:
+            case MYSQL_TYPE_LONGLONG:
+                bufferType = MYSQL_TYPE_LONGLONG;
+                size = 8;
+                break;
+#endif
+            case MYSQL_TYPE_TINY_BLOB:
+            case MYSQL_TYPE_MEDIUM_BLOB:
+            case MYSQL_TYPE_LONG_BLOB:
+            case MYSQL_TYPE_BLOB:
+            case MYSQL_TYPE_STRING:
+            case MYSQL_TYPE_VAR_STRING:
+                // max_length is not known without buffering the result, longer values grow the buffer when fetched
+                size = uint32(std::min<unsigned long>(field[i].length, 256)) + 1;
+                break;
+            default:
+                size = Field::SizeForType(&field[i]);
+                break;
+        }
+
+        m_types[i] = field[i].type;
+        m_buffers[i].resize(std::max<uint32>(size, 1));
+
+        m_rBind[i].buffer_type = bufferType;
+        m_rBind[i].buffer = m_buffers[i].data();
+        m_rBind[i].buffer_length = size;
+        m_rBind[i].length = &m_length[i];
+        m_rBind[i].is_null = &m_isNull[i];
+        m_rBind[i].error = &m_error[i];
+        m_rBind[i].is_unsigned = field[i].flags & UNSIGNED_FLAG;
+
+#ifdef TRINITY_DEBUG
+        m_currentRow[i].SetMetadata(&field[i], i);
+#endif
+    }
+
+    if (mysql_stmt_bind_result(m_stmt, m_rBind.data()))
+    {
+        TC_LOG_WARN("sql.sql", "%s:mysql_stmt_bind_result, cannot bind result from MySQL server. Error: %s", __FUNCTION__, mysql_stmt_error(m_stmt));
+        CleanUp();
+    }
+}
+
+BulkResultSet::BulkResultSet(QueryResult result, char const* sql, uint32 startTime) :
+m_rowCount(1),
+m_fieldCount(result->GetFieldCount()),
+m_startTime(startTime),
+m_table(GetQueryTableName(sql)),
+m_currentRow(NULL),
+m_result(result),
+m_connection(NULL),
+m_stmt(NULL),
+m_metadataResult(NULL)
+{
+}
+
+BulkResultSet::~BulkResultSet()
+{
+    TC_LOG_INFO("server.loading", ">> Streamed " UI64FMTD " rows of `%s` through the %s protocol in %u ms",
+        m_rowCount, m_table.c_str(), m_result ? "text" : "binary", GetMSTimeDiffToNow(m_startTime));
+
+    CleanUp();
+    delete[] m_currentRow;
+}
+
+bool BulkResultSet::NextRow()
+{
+    if (m_result)
+    {
+        if (!m_result->NextRow())
+            return false;
+
+        ++m_rowCount;
+        return true;
+    }
+
+    if (!m_stmt)
+        return false;
+
+    int retval = mysql_stmt_fetch(m_stmt);
+    if (retval == MYSQL_DATA_TRUNCATED && !_FetchTruncatedColumns())
+        retval = 1;
+
+    if (retval == 1)
+        TC_LOG_ERROR("sql.sql", "%s:mysql_stmt_fetch, cannot fetch row from MySQL server. Error: %s", __FUNCTION__, mysql_stmt_error(m_stmt));
+
+    if (retval != 0 && retval != MYSQL_DATA_TRUNCATED)
+    {
+        CleanUp();
+        return false;
+    }
+
+    for (uint32 i = 0; i < m_fieldCount; ++i)
+    {
+        if (m_isNull[i])
+        {
+            m_currentRow[i].SetByteValue(nullptr, m_types[i], 0);
+            continue;
+        }
+
+        switch (m_types[i])
+        {
+            case MYSQL_TYPE_TINY_BLOB:
+            case MYSQL_TYPE_MEDIUM_BLOB:
+            case MYSQL_TYPE_LONG_BLOB:
+            case MYSQL_TYPE_BLOB:
+            case MYSQL_TYPE_STRING:
+            case MYSQL_TYPE_VAR_STRING:
+                // buffer always has room for the terminator, see _FetchTruncatedColumns
+                m_buffers[i][m_length[i]] = '\0';
+                break;
+            default:
+                break;
+        }
+
+        m_currentRow[i].SetByteValue(m_buffers[i].data(), m_types[i], m_length[i]);
+    }
+
+    ++m_rowCount;
+    return true;
+}
+
+bool BulkResultSet::_FetchTruncatedColumns()
+{
+    for (uint32 i = 0; i < m_fieldCount; ++i)
+    {
+        // Only variable length columns can be longer than their buffer
+        if (!m_error[i] || m_length[i] < m_rBind[i].buffer_length)
+            continue;
+
+        m_buffers[i].resize(m_length[i] + 1);
+        m_rBind[i].buffer = m_buffers[i].data();
+        m_rBind[i].buffer_length = m_length[i] + 1;
+
+        if (mysql_stmt_fetch_column(m_stmt, &m_rBind[i], i, 0))
+            return false;
+    }
+
+    // Rebind grown buffers for the following rows
+    return !mysql_stmt_bind_result(m_stmt, m_rBind.data());
+}
+
+void BulkResultSet::CleanUp()
+{
+    if (m_metadataResult)
+    {
+        mysql_free_result(m_metadataResult);
+        m_metadataResult = NULL;
+    }
+
+    if (m_stmt)
+    {
+        mysql_stmt_free_result(m_stmt);
+        mysql_stmt_close(m_stmt);
+        m_stmt = NULL;
+    }
+
+    // Connection is reserved until the statement was closed
+    if (m_connection)
+    {
+        m_connection->Unlock();
+        m_connection = NULL;
+    }
+}
+
 void ResultSet::CleanUp()
 {
     if (_currentRow)
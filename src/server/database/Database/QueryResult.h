@@ -27,6 +27,8 @@
 #endif
 #include <mysql.h>
 
+class MySQLConnection;
+
 class TC_DATABASE_API ResultSet
 {
     public:
@@ -106,5 +108,61 @@ class TC_DATABASE_API PreparedResultSet
 
 typedef std::shared_ptr<PreparedResultSet> PreparedQueryResult;
 
+/**
+    @class BulkResultSet
+
+    @brief Streams rows of a large query one at a time
+
+    Rows are read with the binary prepared statement protocol and are not buffered
+    client side, so integers are never parsed from text and no field is copied.
+    The fields returned by Fetch() are only valid until the next call to NextRow().
+    The connection stays reserved until the result set is destroyed, do not run
+    other synchronous queries on the same database while iterating.
+*/
+class TC_DATABASE_API BulkResultSet
+{
+    public:
+        BulkResultSet(MySQLConnection* connection, MYSQL_STMT* stmt, MYSQL_RES* metadata, char const* sql, uint32 startTime);
+        BulkResultSet(QueryResult result, char const* sql, uint32 startTime);   ///< Text protocol, used when bulk loading is disabled
+        ~BulkResultSet();
+
+        bool NextRow();
+        uint64 GetRowCount() const { return m_rowCount; }       ///< Rows fetched so far
+        uint32 GetFieldCount() const { return m_fieldCount; }
+
+        Field* Fetch() const { return m_result ? m_result->Fetch() : m_currentRow; }
+        Field const& operator[](uint32 index) const
+        {
+            ASSERT(index < m_fieldCount);
+            return Fetch()[index];
+        }
+
+    private:
+        uint64 m_rowCount;
+        uint32 m_fieldCount;
+        uint32 m_startTime;
+        std::string m_table;                                    ///< Table of the FROM clause, for logging
+        Field* m_currentRow;
+        QueryResult m_result;
+
+        MySQLConnection* m_connection;
+        MYSQL_STMT* m_stmt;
+        MYSQL_RES* m_metadataResult;
+        std::vector<MYSQL_BIND> m_rBind;
+        std::vector<std::vector<char>> m_buffers;
+        std::vector<enum_field_types> m_types;
+        std::vector<unsigned long> m_length;
+        std::vector<my_bool> m_isNull;
+        std::vector<my_bool> m_error;
+
+        bool _FetchTruncatedColumns();
+        void CleanUp();
+
+        BulkResultSet(BulkResultSet const& right) = delete;
+        BulkResultSet& operator=(BulkResultSet const& right) = delete;
+};
+
+typedef std::unique_ptr<BulkResultSet> BulkQueryResult;
+
 #endif
 
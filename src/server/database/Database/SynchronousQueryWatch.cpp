@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2008-2016 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SynchronousQueryWatch.h"
+#include "Log.h"
+
+std::atomic<bool> SynchronousQueryWatch::_enabled(false);
+
+// not a class member, thread local data can not be exported from a shared library
+static thread_local char const* _context = nullptr;
+
+SynchronousQueryWatch::Scope::Scope(char const* context) : _previousContext(_context)
+{
+    _context = context;
+}
+
+SynchronousQueryWatch::Scope::~Scope()
+{
+    _context = _previousContext;
+}
+
+void SynchronousQueryWatch::SetEnabled(bool enabled)
+{
+    _enabled = enabled;
+}
+
+bool SynchronousQueryWatch::IsWatching()
+{
+    return _enabled && _context;
+}
+
+void SynchronousQueryWatch::Report(char const* database, char const* query, uint32 duration)
+{
+    TC_LOG_INFO("sql.synchronous", "Synchronous query on '%s' from %s took %u ms: %s", database, _context, duration, query);
+}
+
+void SynchronousQueryWatch::Report(char const* database, uint32 statementIndex, uint32 duration)
+{
+    TC_LOG_INFO("sql.synchronous", "Synchronous prepared statement %u on '%s' from %s took %u ms", statementIndex, database, _context, duration);
+}
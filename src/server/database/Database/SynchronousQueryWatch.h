@@ -0,0 +1,54 @@
+/*
+ * Copyright (C) 2008-2016 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SYNCHRONOUSQUERYWATCH_H
+#define _SYNCHRONOUSQUERYWATCH_H
+
+#include "Define.h"
+#include <atomic>
+
+/// Reports synchronous queries issued while an update context (world update, map update, opcode handler) is active on the calling thread
+class TC_DATABASE_API SynchronousQueryWatch
+{
+    public:
+        /// Marks the calling thread as running inside the named context, restores the previous one when destroyed
+        class TC_DATABASE_API Scope
+        {
+            public:
+                explicit Scope(char const* context);
+                ~Scope();
+
+            private:
+                char const* _previousContext;
+
+                Scope(Scope const& right) = delete;
+                Scope& operator=(Scope const& right) = delete;
+        };
+
+        static void SetEnabled(bool enabled);
+
+        /// True if queries issued from the calling thread right now have to be reported
+        static bool IsWatching();
+
+        static void Report(char const* database, char const* query, uint32 duration);
+        static void Report(char const* database, uint32 statementIndex, uint32 duration);
+
+    private:
+        static std::atomic<bool> _enabled;
+};
+
+#endif
@@ -699,6 +699,26 @@ enum RBACPermissions
     RBAC_PERM_COMMAND_DEBUG_BOUNDARY                         = 836,
 
     // custom permissions 1000+
+    RBAC_PERM_COMMAND_SERVER_PACKETLOG                       = 1000,
+    RBAC_PERM_COMMAND_SERVER_PACKETLOG_STATUS                = 1001,
+    RBAC_PERM_COMMAND_SERVER_PACKETLOG_START                 = 1002,
+    RBAC_PERM_COMMAND_SERVER_PACKETLOG_STOP                  = 1003,
+    RBAC_PERM_COMMAND_SERVER_PACKETLOG_FILTER                = 1004,
+    RBAC_PERM_COMMAND_SERVER_PACKETLOG_FILTER_ACCOUNT        = 1005,
+    RBAC_PERM_COMMAND_SERVER_PACKETLOG_FILTER_ADDRESS        = 1006,
+    RBAC_PERM_COMMAND_SERVER_PACKETLOG_FILTER_CLEAR          = 1007,
+    RBAC_PERM_COMMAND_SERVER_SCRIPTHOOKS                     = 1008,
+    RBAC_PERM_COMMAND_SERVER_SCRIPTHOOKS_RESET               = 1009,
+    RBAC_PERM_COMMAND_GUILD_STATS                            = 1010,
+    RBAC_PERM_COMMAND_DEBUG_SPELLALLOC                       = 1011,
+    RBAC_PERM_COMMAND_DEBUG_GRIDLOAD                         = 1012,
+    RBAC_PERM_COMMAND_DEBUG_ACHIEVEMENTCRITERIA              = 1013,
+    RBAC_PERM_COMMAND_DEBUG_BGUPDATE                         = 1014,
+    RBAC_PERM_COMMAND_DEBUG_GAMEEVENTSPAWNS                  = 1015,
+    RBAC_PERM_COMMAND_DEBUG_RESPAWNQUEUE                     = 1016,
+    RBAC_PERM_COMMAND_DEBUG_QUERYCACHE                       = 1017,
+    RBAC_PERM_COMMAND_DEBUG_OPCODESTATS                      = 1018,
+    RBAC_PERM_COMMAND_DEBUG_MAILEXPIRY                       = 1019,
     RBAC_PERM_MAX
 };
 
@@ -458,6 +458,7 @@ void AchievementMgr::Reset()
 
     m_completedAchievements.clear();
     m_criteriaProgress.clear();
+    m_completedCriteria.clear();
     DeleteFromDB(m_player->GetGUID());
 
     // re-fill data
@@ -724,13 +725,32 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
     TC_LOG_DEBUG("achievement", "UpdateAchievementCriteria: %s, %s (%u), %u, %u"
         , m_player->GetGUID().ToString().c_str(), AchievementGlobalMgr::GetCriteriaTypeString(type), type, miscValue1, miscValue2);
 
-    AchievementCriteriaEntryList const& achievementCriteriaList = sAchievementMgr->GetAchievementCriteriaByType(type);
+    // a given asset can only progress the criteria registered for it
+    AchievementCriteriaEntryList const& achievementCriteriaList = miscValue1 && AchievementGlobalMgr::IsCriteriaTypeIndexedByAsset(type)
+        ? sAchievementMgr->GetAchievementCriteriaByAsset(type, miscValue1)
+        : sAchievementMgr->GetAchievementCriteriaByType(type);
+
+    AchievementCriteriaUpdateStats* stats = sAchievementMgr->IsCriteriaUpdateStatsEnabled() ? &sAchievementMgr->GetCriteriaUpdateStats(type) : NULL;
+    if (stats)
+        ++stats->Events;
+
     for (AchievementCriteriaEntry const* achievementCriteria : achievementCriteriaList)
     {
+        // CanUpdateCriteria would reject it last, after all the expensive checks
+        if (m_completedCriteria.find(achievementCriteria->ID) != m_completedCriteria.end())
+        {
+            if (stats)
+                ++stats->SkippedCompleted;
+            continue;
+        }
+
         AchievementEntry const* achievement = sAchievementMgr->GetAchievement(achievementCriteria->referredAchievement);
         if (!achievement)
             continue;
 
+        if (stats)
+            ++stats->Evaluated;
+
         if (!CanUpdateCriteria(achievementCriteria, achievement, miscValue1, miscValue2, unit))
             continue;
 
@@ -1113,10 +1133,26 @@ bool AchievementMgr::IsCompletedCriteria(AchievementCriteriaEntry const* achieve
             return false;
     }
 
+    if (m_completedCriteria.find(achievementCriteria->ID) != m_completedCriteria.end())
+        return true;
+
     CriteriaProgress const* progress = GetCriteriaProgress(achievementCriteria);
     if (!progress)
         return false;
 
+    if (IsCompletedCriteriaProgress(achievementCriteria, progress))
+    {
+        // realm first state can change with no progress of this player, don't remember it
+        if (!(achievement->flags & (ACHIEVEMENT_FLAG_REALM_FIRST_REACH | ACHIEVEMENT_FLAG_REALM_FIRST_KILL)))
+            m_completedCriteria.insert(achievementCriteria->ID);
+        return true;
+    }
+
+    return false;
+}
+
+bool AchievementMgr::IsCompletedCriteriaProgress(AchievementCriteriaEntry const* achievementCriteria, CriteriaProgress const* progress) const
+{
     switch (achievementCriteria->requiredType)
     {
         case ACHIEVEMENT_CRITERIA_TYPE_WIN_BG:
@@ -1393,6 +1429,9 @@ void AchievementMgr::SetCriteriaProgress(AchievementCriteriaEntry const* entry,
         if (progress->counter == newValue && !entry->timeLimit)
             return;
 
+        if (newValue < progress->counter)
+            m_completedCriteria.erase(entry->ID);
+
         progress->counter = newValue;
     }
 
@@ -1431,6 +1470,7 @@ void AchievementMgr::RemoveCriteriaProgress(AchievementCriteriaEntry const* entr
     m_player->SendDirectMessage(&data);
 
     m_criteriaProgress.erase(criteriaProgress);
+    m_completedCriteria.erase(entry->ID);
 }
 
 void AchievementMgr::UpdateTimedAchievements(uint32 timeDiff)
@@ -2246,6 +2286,54 @@ char const* AchievementGlobalMgr::GetCriteriaTypeString(AchievementCriteriaTypes
     return "MISSING_TYPE";
 }
 
+bool AchievementGlobalMgr::IsCriteriaTypeIndexedByAsset(AchievementCriteriaTypes type)
+{
+    // RequirementsSatisfied rejects these when a non zero miscValue1 differs from the asset (raw.field3)
+    switch (type)
+    {
+        case ACHIEVEMENT_CRITERIA_TYPE_KILL_CREATURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_REACH_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUESTS_IN_ZONE:
+        case ACHIEVEMENT_CRITERIA_TYPE_KILLED_BY_CREATURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_COMPLETE_QUEST:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_BG_OBJECTIVE_CAPTURE:
+        case ACHIEVEMENT_CRITERIA_TYPE_HONORABLE_KILL_AT_AREA:
+        case ACHIEVEMENT_CRITERIA_TYPE_WIN_ARENA:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SPELL:
+        case ACHIEVEMENT_CRITERIA_TYPE_OWN_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LEVEL:
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_GAIN_REPUTATION:
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_CLASS:
+        case ACHIEVEMENT_CRITERIA_TYPE_HK_RACE:
+        case ACHIEVEMENT_CRITERIA_TYPE_DO_EMOTE:
+        case ACHIEVEMENT_CRITERIA_TYPE_EQUIP_ITEM:
+        case ACHIEVEMENT_CRITERIA_TYPE_USE_GAMEOBJECT:
+        case ACHIEVEMENT_CRITERIA_TYPE_BE_SPELL_TARGET2:
+        case ACHIEVEMENT_CRITERIA_TYPE_FISH_IN_GAMEOBJECT:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILLLINE_SPELLS:
+        case ACHIEVEMENT_CRITERIA_TYPE_LOOT_TYPE:
+        case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL2:
+        case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void AchievementGlobalMgr::ResetCriteriaUpdateStats()
+{
+    for (AchievementCriteriaUpdateStats& stats : m_criteriaUpdateStats)
+    {
+        stats.Events = 0;
+        stats.Evaluated = 0;
+        stats.SkippedCompleted = 0;
+    }
+}
+
 AchievementGlobalMgr* AchievementGlobalMgr::instance()
 {
     static AchievementGlobalMgr instance;
@@ -2271,6 +2359,8 @@ void AchievementGlobalMgr::LoadAchievementCriteriaList()
             continue;
 
         m_AchievementCriteriasByType[criteria->requiredType].push_back(criteria);
+        if (IsCriteriaTypeIndexedByAsset(AchievementCriteriaTypes(criteria->requiredType)))
+            m_AchievementCriteriasByAsset[criteria->requiredType][criteria->raw.field3].push_back(criteria);
         m_AchievementCriteriaListByAchievement[criteria->referredAchievement].push_back(criteria);
 
         if (criteria->timeLimit)
@@ -19,8 +19,10 @@
 #ifndef __TRINITY_ACHIEVEMENTMGR_H
 #define __TRINITY_ACHIEVEMENTMGR_H
 
+#include <atomic>
 #include <map>
 #include <string>
+#include <unordered_set>
 
 #include "Common.h"
 #include "DatabaseEnv.h"
@@ -36,6 +38,7 @@ typedef std::vector<AchievementCriteriaEntry const*> AchievementCriteriaEntryLis
 typedef std::vector<AchievementEntry const*>         AchievementEntryList;
 
 typedef std::unordered_map<uint32, AchievementCriteriaEntryList> AchievementCriteriaListByAchievement;
+typedef std::unordered_map<uint32, AchievementCriteriaEntryList> AchievementCriteriaListByAsset;
 typedef std::unordered_map<uint32, AchievementEntryList>         AchievementListByReferencedId;
 
 struct CriteriaProgress
@@ -255,6 +258,17 @@ struct CompletedAchievementData
 typedef std::unordered_map<uint32, CriteriaProgress> CriteriaProgressMap;
 typedef std::unordered_map<uint32, CompletedAchievementData> CompletedAchievementMap;
 
+// Per criteria type counters of UpdateAchievementCriteria, shared by all players.
+// Only counted with Debug.AchievementCriteriaStats enabled, the shared counters are too costly on every event otherwise
+struct AchievementCriteriaUpdateStats
+{
+    AchievementCriteriaUpdateStats() : Events(0), Evaluated(0), SkippedCompleted(0) { }
+
+    std::atomic<uint64> Events;
+    std::atomic<uint64> Evaluated;                          // criteria that went through CanUpdateCriteria
+    std::atomic<uint64> SkippedCompleted;                   // criteria skipped because already completed by the player
+};
+
 enum ProgressType
 {
     PROGRESS_SET,
@@ -292,6 +306,7 @@ class TC_GAME_API AchievementMgr
         void RemoveCriteriaProgress(AchievementCriteriaEntry const* entry);
         void CompletedCriteriaFor(AchievementEntry const* achievement);
         bool IsCompletedCriteria(AchievementCriteriaEntry const* achievementCriteria, AchievementEntry const* achievement);
+        bool IsCompletedCriteriaProgress(AchievementCriteriaEntry const* achievementCriteria, CriteriaProgress const* progress) const;
         bool IsCompletedAchievement(AchievementEntry const* entry);
         bool CanUpdateCriteria(AchievementCriteriaEntry const* criteria, AchievementEntry const* achievement, uint32 miscValue1, uint32 miscValue2, Unit const* unit);
         void BuildAllDataPacket(WorldPacket* data) const;
@@ -302,13 +317,14 @@ class TC_GAME_API AchievementMgr
         Player* m_player;
         CriteriaProgressMap m_criteriaProgress;
         CompletedAchievementMap m_completedAchievements;
+        std::unordered_set<uint32> m_completedCriteria;     // criteria known to be completed, they can't progress anymore until their progress drops
         typedef std::map<uint32, uint32> TimedAchievementMap;
         TimedAchievementMap m_timedAchievements;      // Criteria id/time left in MS
 };
 
 class TC_GAME_API AchievementGlobalMgr
 {
-        AchievementGlobalMgr() { }
+        AchievementGlobalMgr() : m_criteriaUpdateStatsEnabled(false) { }
         ~AchievementGlobalMgr() { }
 
     public:
@@ -322,6 +338,21 @@ class TC_GAME_API AchievementGlobalMgr
             return m_AchievementCriteriasByType[type];
         }
 
+        // Only the criteria of the given type whose asset matches, for types where a mismatched asset can never progress
+        AchievementCriteriaEntryList const& GetAchievementCriteriaByAsset(AchievementCriteriaTypes type, uint32 asset) const
+        {
+            static AchievementCriteriaEntryList const emptyList;
+            AchievementCriteriaListByAsset::const_iterator itr = m_AchievementCriteriasByAsset[type].find(asset);
+            return itr != m_AchievementCriteriasByAsset[type].end() ? itr->second : emptyList;
+        }
+
+        static bool IsCriteriaTypeIndexedByAsset(AchievementCriteriaTypes type);
+
+        AchievementCriteriaUpdateStats& GetCriteriaUpdateStats(AchievementCriteriaTypes type) { return m_criteriaUpdateStats[type]; }
+        void ResetCriteriaUpdateStats();
+        void SetCriteriaUpdateStatsEnabled(bool enabled) { m_criteriaUpdateStatsEnabled = enabled; }
+        bool IsCriteriaUpdateStatsEnabled() const { return m_criteriaUpdateStatsEnabled.load(std::memory_order_relaxed); }
+
         AchievementCriteriaEntryList const& GetTimedAchievementCriteriaByType(AchievementCriteriaTimedTypes type) const
         {
             return m_AchievementCriteriasByTimedType[type];
@@ -394,6 +425,12 @@ class TC_GAME_API AchievementGlobalMgr
         // store achievement criterias by type to speed up lookup
         AchievementCriteriaEntryList m_AchievementCriteriasByType[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
 
+        // same by type and asset (miscValue1) for types checking the asset in RequirementsSatisfied
+        AchievementCriteriaListByAsset m_AchievementCriteriasByAsset[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+
+        AchievementCriteriaUpdateStats m_criteriaUpdateStats[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+        std::atomic<bool> m_criteriaUpdateStatsEnabled;
+
         AchievementCriteriaEntryList m_AchievementCriteriasByTimedType[ACHIEVEMENT_TIMED_TYPE_MAX];
 
         // store achievement criterias by achievement to speed up lookup
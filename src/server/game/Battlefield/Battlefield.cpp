@@ -198,7 +198,7 @@ void Battlefield::InvitePlayersInZoneToQueue()
 {
     for (uint8 team = 0; team < 2; ++team)
         for (GuidSet::const_iterator itr = m_players[team].begin(); itr != m_players[team].end(); ++itr)
-            if (Player* player = ObjectAccessor::FindPlayer(*itr))
+            if (Player* player = ObjectAccessor::GetPlayer(m_Map, *itr))
                 InvitePlayerToQueue(player);
 }
 
@@ -215,19 +215,26 @@ void Battlefield::InvitePlayersInQueueToWar()
 {
     for (uint8 team = 0; team < BG_TEAMS_COUNT; ++team)
     {
-        for (GuidSet::const_iterator itr = m_PlayersInQueue[team].begin(); itr != m_PlayersInQueue[team].end(); ++itr)
+        // InvitePlayerToWar removes players in arenas from the queue
+        GuidSet queue;
+        queue.swap(m_PlayersInQueue[team]);
+
+        for (GuidSet::const_iterator itr = queue.begin(); itr != queue.end(); ++itr)
         {
-            if (Player* player = ObjectAccessor::FindPlayer(*itr))
+            // queued players outside of the battlefield map are invited from the world thread
+            DoForPlayer(*itr, [this](Player* player)
             {
+                if (!IsWarTime())
+                    return;
+
                 if (m_PlayersInWar[player->GetTeamId()].size() + m_InvitedPlayers[player->GetTeamId()].size() < m_MaxPlayer)
                     InvitePlayerToWar(player);
                 else
                 {
                     //Full
                 }
-            }
+            });
         }
-        m_PlayersInQueue[team].clear();
     }
 }
 
@@ -236,7 +243,7 @@ void Battlefield::InvitePlayersInZoneToWar()
     for (uint8 team = 0; team < BG_TEAMS_COUNT; ++team)
         for (GuidSet::const_iterator itr = m_players[team].begin(); itr != m_players[team].end(); ++itr)
         {
-            if (Player* player = ObjectAccessor::FindPlayer(*itr))
+            if (Player* player = ObjectAccessor::GetPlayer(m_Map, *itr))
             {
                 if (m_PlayersInWar[player->GetTeamId()].count(player->GetGUID()) || m_InvitedPlayers[player->GetTeamId()].count(player->GetGUID()))
                     continue;
@@ -292,14 +299,14 @@ void Battlefield::KickAfkPlayers()
 {
     for (uint8 team = 0; team < BG_TEAMS_COUNT; ++team)
         for (GuidSet::const_iterator itr = m_PlayersInWar[team].begin(); itr != m_PlayersInWar[team].end(); ++itr)
-            if (Player* player = ObjectAccessor::FindPlayer(*itr))
+            if (Player* player = ObjectAccessor::GetPlayer(m_Map, *itr))
                 if (player->isAFK())
                     KickPlayerFromBattlefield(*itr);
 }
 
 void Battlefield::KickPlayerFromBattlefield(ObjectGuid guid)
 {
-    if (Player* player = ObjectAccessor::FindPlayer(guid))
+    if (Player* player = ObjectAccessor::GetPlayer(m_Map, guid))
         if (player->GetZoneId() == GetZoneId())
             player->TeleportTo(KickPosition);
 }
@@ -397,13 +404,13 @@ void Battlefield::TeamCastSpell(TeamId team, int32 spellId)
     if (spellId > 0)
     {
         for (GuidSet::const_iterator itr = m_PlayersInWar[team].begin(); itr != m_PlayersInWar[team].end(); ++itr)
-            if (Player* player = ObjectAccessor::FindPlayer(*itr))
+            if (Player* player = ObjectAccessor::GetPlayer(m_Map, *itr))
                 player->CastSpell(player, uint32(spellId), true);
     }
     else
     {
         for (GuidSet::const_iterator itr = m_PlayersInWar[team].begin(); itr != m_PlayersInWar[team].end(); ++itr)
-            if (Player* player = ObjectAccessor::FindPlayer(*itr))
+            if (Player* player = ObjectAccessor::GetPlayer(m_Map, *itr))
                 player->RemoveAuraFromStack(uint32(-spellId));
     }
 }
@@ -412,24 +419,59 @@ void Battlefield::BroadcastPacketToZone(WorldPacket& data) const
 {
     for (uint8 team = 0; team < BG_TEAMS_COUNT; ++team)
         for (GuidSet::const_iterator itr = m_players[team].begin(); itr != m_players[team].end(); ++itr)
-            if (Player* player = ObjectAccessor::FindPlayer(*itr))
+            if (Player* player = ObjectAccessor::GetPlayer(m_Map, *itr))
                 player->SendDirectMessage(&data);
 }
 
 void Battlefield::BroadcastPacketToQueue(WorldPacket& data) const
 {
-    for (uint8 team = 0; team < BG_TEAMS_COUNT; ++team)
-        for (GuidSet::const_iterator itr = m_PlayersInQueue[team].begin(); itr != m_PlayersInQueue[team].end(); ++itr)
-            if (Player* player = ObjectAccessor::FindConnectedPlayer(*itr))
-                player->SendDirectMessage(&data);
+    BroadcastPacketToPlayers(m_PlayersInQueue, data);
 }
 
 void Battlefield::BroadcastPacketToWar(WorldPacket& data) const
 {
+    BroadcastPacketToPlayers(m_PlayersInWar, data);
+}
+
+void Battlefield::BroadcastPacketToPlayers(GuidSet const* players, WorldPacket const& data) const
+{
+    GuidVector elsewhere;
     for (uint8 team = 0; team < BG_TEAMS_COUNT; ++team)
-        for (GuidSet::const_iterator itr = m_PlayersInWar[team].begin(); itr != m_PlayersInWar[team].end(); ++itr)
-            if (Player* player = ObjectAccessor::FindPlayer(*itr))
+    {
+        for (GuidSet::const_iterator itr = players[team].begin(); itr != players[team].end(); ++itr)
+        {
+            if (Player* player = ObjectAccessor::GetPlayer(m_Map, *itr))
                 player->SendDirectMessage(&data);
+            else
+                elsewhere.push_back(*itr);
+        }
+    }
+
+    if (elsewhere.empty())
+        return;
+
+    WorldPacket packet(data);
+    sBattlefieldMgr->AddWorldTask([elsewhere, packet]()
+    {
+        for (ObjectGuid const& guid : elsewhere)
+            if (Player* player = ObjectAccessor::FindConnectedPlayer(guid))
+                player->SendDirectMessage(&packet);
+    });
+}
+
+void Battlefield::DoForPlayer(ObjectGuid guid, std::function<void(Player*)> const& worker) const
+{
+    if (Player* player = ObjectAccessor::GetPlayer(m_Map, guid))
+    {
+        worker(player);
+        return;
+    }
+
+    sBattlefieldMgr->AddWorldTask([guid, worker]()
+    {
+        if (Player* player = ObjectAccessor::FindPlayer(guid))
+            worker(player);
+    });
 }
 
 void Battlefield::SendWarning(uint8 id, WorldObject const* target /*= nullptr*/)
@@ -442,7 +484,7 @@ void Battlefield::SendUpdateWorldState(uint32 field, uint32 value)
 {
     for (uint8 i = 0; i < BG_TEAMS_COUNT; ++i)
         for (GuidSet::iterator itr = m_players[i].begin(); itr != m_players[i].end(); ++itr)
-            if (Player* player = ObjectAccessor::FindPlayer(*itr))
+            if (Player* player = ObjectAccessor::GetPlayer(m_Map, *itr))
                 player->SendUpdateWorldState(field, value);
 }
 
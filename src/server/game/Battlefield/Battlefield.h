@@ -20,6 +20,7 @@
 
 #include "SharedDefines.h"
 #include "ZoneScript.h"
+#include <functional>
 
 enum BattlefieldTypes
 {
@@ -222,6 +223,7 @@ class TC_GAME_API Battlefield : public ZoneScript
 
         uint32 GetTypeId() const { return m_TypeId; }
         uint32 GetZoneId() const { return m_ZoneId; }
+        uint32 GetMapId() const { return m_MapId; }
 
         void TeamApplyBuff(TeamId team, uint32 spellId, uint32 spellId2 = 0);
 
@@ -336,6 +338,7 @@ class TC_GAME_API Battlefield : public ZoneScript
         void DoPlaySoundToAll(uint32 SoundID);
 
         void InvitePlayerToQueue(Player* player);
+        // from the battlefield map thread only for players on that map, otherwise from the world thread
         void InvitePlayerToWar(Player* player);
 
         void InitStalker(uint32 entry, Position const& pos);
@@ -396,6 +399,11 @@ class TC_GAME_API Battlefield : public ZoneScript
         void BroadcastPacketToZone(WorldPacket& data) const;
         void BroadcastPacketToQueue(WorldPacket& data) const;
         void BroadcastPacketToWar(WorldPacket& data) const;
+        void BroadcastPacketToPlayers(GuidSet const* players, WorldPacket const& data) const;
+
+        // players in the queue or in the war may be on other maps: the worker runs at once
+        // for a player on the battlefield map and from the world thread for the others
+        void DoForPlayer(ObjectGuid guid, std::function<void(Player*)> const& worker) const;
 
         // CapturePoint system
         void AddCapturePoint(BfCapturePoint* cp) { m_capturePoints[cp->GetCapturePointEntry()] = cp; }
@@ -21,7 +21,6 @@
 
 BattlefieldMgr::BattlefieldMgr()
 {
-    _updateTimer = 0;
 }
 
 BattlefieldMgr::~BattlefieldMgr()
@@ -53,6 +52,10 @@ void BattlefieldMgr::InitBattlefield()
         TC_LOG_INFO("bg.battlefield", "Battlefield: Wintergrasp successfully initiated.");
     }
 
+    // created here so the map threads only ever change existing timers
+    for (BattlefieldSet::const_iterator itr = _battlefieldSet.begin(); itr != _battlefieldSet.end(); ++itr)
+        _updateTimers[(*itr)->GetMapId()] = 0;
+
     /*
     For Cataclysm: Tol Barad
     Battlefield* tb = new BattlefieldTB;
@@ -137,14 +140,36 @@ ZoneScript* BattlefieldMgr::GetZoneScript(uint32 zoneId)
     return NULL;
 }
 
-void BattlefieldMgr::Update(uint32 diff)
+void BattlefieldMgr::Update(Map* map, uint32 diff)
 {
-    _updateTimer += diff;
-    if (_updateTimer > BATTLEFIELD_OBJECTIVE_UPDATE_INTERVAL)
+    std::unordered_map<uint32, uint32>::iterator timer = _updateTimers.find(map->GetId());
+    if (timer == _updateTimers.end())
+        return;
+
+    timer->second += diff;
+    if (timer->second > BATTLEFIELD_OBJECTIVE_UPDATE_INTERVAL)
     {
         for (BattlefieldSet::iterator itr = _battlefieldSet.begin(); itr != _battlefieldSet.end(); ++itr)
-            if ((*itr)->IsEnabled())
-                (*itr)->Update(_updateTimer);
-        _updateTimer = 0;
+            if ((*itr)->GetMapId() == map->GetId() && (*itr)->IsEnabled())
+                (*itr)->Update(timer->second);
+        timer->second = 0;
+    }
+}
+
+void BattlefieldMgr::AddWorldTask(std::function<void()>&& task)
+{
+    std::lock_guard<std::mutex> lock(_worldTasksLock);
+    _worldTasks.push_back(std::move(task));
+}
+
+void BattlefieldMgr::ProcessWorldTasks()
+{
+    std::vector<std::function<void()>> tasks;
+    {
+        std::lock_guard<std::mutex> lock(_worldTasksLock);
+        tasks.swap(_worldTasks);
     }
+
+    for (std::function<void()> const& task : tasks)
+        task();
 }
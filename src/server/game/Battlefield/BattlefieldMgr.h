@@ -19,7 +19,10 @@
 #define BATTLEFIELD_MGR_H_
 
 #include "Battlefield.h"
+#include <functional>
+#include <mutex>
 
+class Map;
 class Player;
 class ZoneScript;
 
@@ -45,7 +48,13 @@ class TC_GAME_API BattlefieldMgr
 
         void AddZone(uint32 zoneId, Battlefield* bf);
 
-        void Update(uint32 diff);
+        // called by the base maps from their update threads, updates the battlefields located on them
+        void Update(Map* map, uint32 diff);
+
+        // queued and invited players can be on any map, work on them is handed from the
+        // battlefield map thread to the world thread, which runs it between map updates
+        void AddWorldTask(std::function<void()>&& task);
+        void ProcessWorldTasks();
 
     private:
         BattlefieldMgr();
@@ -59,8 +68,11 @@ class TC_GAME_API BattlefieldMgr
         // maps the zone ids to an battlefield event
         // used in player event handling
         BattlefieldMap _battlefieldMap;
-        // update interval
-        uint32 _updateTimer;
+        // update interval, per map id so maps updating in parallel do not share it
+        std::unordered_map<uint32 /*mapId*/, uint32> _updateTimers;
+        // work for players outside of the battlefield maps
+        std::vector<std::function<void()>> _worldTasks;
+        std::mutex _worldTasksLock;
 };
 
 #define sBattlefieldMgr BattlefieldMgr::instance()
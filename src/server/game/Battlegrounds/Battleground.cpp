@@ -136,6 +136,9 @@ Battleground::Battleground()
     m_LevelMax          = 0;
     m_InBGFreeSlotQueue = false;
     m_SetDeleteThis     = false;
+    m_UpdateCount       = 0;
+    m_UpdateTimeTotal   = 0;
+    m_UpdateTimeMax     = 0;
 
     m_MaxPlayersPerTeam = 0;
     m_MaxPlayers        = 0;
@@ -206,6 +209,14 @@ Battleground::~Battleground()
         delete itr->second;
 }
 
+void Battleground::RecordUpdateTime(uint32 updateTime)
+{
+    ++m_UpdateCount;
+    m_UpdateTimeTotal += updateTime;
+    if (updateTime > m_UpdateTimeMax)
+        m_UpdateTimeMax = updateTime;
+}
+
 void Battleground::Update(uint32 diff)
 {
     if (!PreUpdateImpl(diff))
@@ -937,11 +948,21 @@ void Battleground::RemovePlayerAtLeave(ObjectGuid guid, bool Transport, bool Sen
         }
 
         // remove from raid group if player is member
-        if (Group* group = GetBgRaid(team))
+        // this can run on the map update thread, removing and disbanding touch GroupMgr and the player's own group
+        uint32 instanceId = GetInstanceID();
+        BattlegroundTypeId typeId = GetTypeID();
+        sBattlegroundMgr->AddWorldTask([instanceId, typeId, team, guid]()
         {
-            if (!group->RemoveMember(guid))                // group was disbanded
-                SetBgRaid(team, NULL);
-        }
+            Battleground* bg = sBattlegroundMgr->GetBattleground(instanceId, typeId);
+            if (!bg)
+                return;
+
+            if (Group* group = bg->GetBgRaid(team))
+            {
+                if (!group->RemoveMember(guid))            // group was disbanded
+                    bg->SetBgRaid(team, NULL);
+            }
+        });
         DecreaseInvitedCount(team);
         //we should update battleground queue, but only if bg isn't ending
         if (isBattleground() && GetStatus() < STATUS_WAIT_LEAVE)
@@ -464,6 +464,12 @@ class TC_GAME_API Battleground
         bool ToBeDeleted() const { return m_SetDeleteThis; }
         void SetDeleteThis() { m_SetDeleteThis = true; }
 
+        // Update() timings, measured by the BattlegroundMap update
+        void RecordUpdateTime(uint32 updateTime);
+        uint32 GetUpdateCount() const { return m_UpdateCount; }
+        uint64 GetUpdateTimeTotal() const { return m_UpdateTimeTotal; }
+        uint32 GetUpdateTimeMax() const { return m_UpdateTimeMax; }
+
         void RewardXPAtKill(Player* killer, Player* victim);
         bool CanAwardArenaPoints() const { return m_LevelMin >= BG_AWARD_ARENA_POINTS_MIN_LEVEL; }
 
@@ -536,6 +542,9 @@ class TC_GAME_API Battleground
         uint8  m_ArenaType;                                 // 2=2v2, 3=3v3, 5=5v5
         bool   m_InBGFreeSlotQueue;                         // used to make sure that BG is only once inserted into the BattlegroundMgr.BGFreeSlotQueue[bgTypeId] deque
         bool   m_SetDeleteThis;                             // used for safe deletion of the bg after end / all players leave
+        uint32 m_UpdateCount;
+        uint64 m_UpdateTimeTotal;                           // microseconds
+        uint32 m_UpdateTimeMax;                             // microseconds
         bool   m_IsArena;
         BattlegroundTeamId _winnerTeamId;
         int32  m_StartDelayTime;
@@ -85,6 +85,9 @@ BattlegroundMgr* BattlegroundMgr::instance()
 // used to update running battlegrounds, and delete finished ones
 void BattlegroundMgr::Update(uint32 diff)
 {
+    // before deleting battlegrounds, the tasks may refer to ones that ended during the map updates
+    ProcessWorldTasks();
+
     for (BattlegroundDataContainer::iterator itr1 = bgDataStore.begin(); itr1 != bgDataStore.end(); ++itr1)
     {
         BattlegroundContainer& bgs = itr1->second.m_Battlegrounds;
@@ -95,7 +98,10 @@ void BattlegroundMgr::Update(uint32 diff)
             itrDelete = itr++;
             Battleground* bg = itrDelete->second;
 
-            bg->Update(diff);
+            // battlegrounds with a map are updated by BattlegroundMap::Update in the map update threads
+            if (!bg->FindBgMap())
+                bg->Update(diff);
+
             if (bg->ToBeDeleted())
             {
                 itrDelete->second = NULL;
@@ -114,11 +120,14 @@ void BattlegroundMgr::Update(uint32 diff)
         m_BattlegroundQueues[qtype].UpdateEvents(diff);
 
     // update scheduled queues
-    if (!m_QueueUpdateScheduler.empty())
+    std::vector<uint64> scheduled;
     {
-        std::vector<uint64> scheduled;
+        std::lock_guard<std::mutex> lock(m_QueueUpdateSchedulerLock);
         std::swap(scheduled, m_QueueUpdateScheduler);
+    }
 
+    if (!scheduled.empty())
+    {
         for (uint8 i = 0; i < scheduled.size(); i++)
         {
             uint32 arenaMMRating = scheduled[i] >> 32;
@@ -833,11 +842,30 @@ void BattlegroundMgr::SetHolidayWeekends(uint32 mask)
             bg->SetHoliday((mask & (1 << bgtype)) != 0);
 }
 
+void BattlegroundMgr::AddWorldTask(std::function<void()>&& task)
+{
+    std::lock_guard<std::mutex> lock(m_WorldTasksLock);
+    m_WorldTasks.push_back(std::move(task));
+}
+
+void BattlegroundMgr::ProcessWorldTasks()
+{
+    std::vector<std::function<void()>> tasks;
+    {
+        std::lock_guard<std::mutex> lock(m_WorldTasksLock);
+        tasks.swap(m_WorldTasks);
+    }
+
+    for (std::function<void()> const& task : tasks)
+        task();
+}
+
 void BattlegroundMgr::ScheduleQueueUpdate(uint32 arenaMatchmakerRating, uint8 arenaType, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id)
 {
-    //This method must be atomic, @todo add mutex
+    // called from the battleground map update threads
     //we will use only 1 number created of bgTypeId and bracket_id
     uint64 const scheduleId = ((uint64)arenaMatchmakerRating << 32) | (uint32(arenaType) << 24) | (bgQueueTypeId << 16) | (bgTypeId << 8) | bracket_id;
+    std::lock_guard<std::mutex> lock(m_QueueUpdateSchedulerLock);
     if (std::find(m_QueueUpdateScheduler.begin(), m_QueueUpdateScheduler.end(), scheduleId) == m_QueueUpdateScheduler.end())
         m_QueueUpdateScheduler.push_back(scheduleId);
 }
@@ -1005,11 +1033,14 @@ BGFreeSlotQueueContainer& BattlegroundMgr::GetBGFreeSlotQueueStore(BattlegroundT
 
 void BattlegroundMgr::AddToBGFreeSlotQueue(BattlegroundTypeId bgTypeId, Battleground* bg)
 {
+    // battlegrounds of the same type can leave players at the same time from different map threads
+    std::lock_guard<std::mutex> lock(m_FreeSlotQueueLock);
     bgDataStore[bgTypeId].BGFreeSlotQueue.push_front(bg);
 }
 
 void BattlegroundMgr::RemoveFromBGFreeSlotQueue(BattlegroundTypeId bgTypeId, uint32 instanceId)
 {
+    std::lock_guard<std::mutex> lock(m_FreeSlotQueueLock);
     BGFreeSlotQueueContainer& queues = bgDataStore[bgTypeId].BGFreeSlotQueue;
     for (BGFreeSlotQueueContainer::iterator itr = queues.begin(); itr != queues.end(); ++itr)
         if ((*itr)->GetInstanceID() == instanceId)
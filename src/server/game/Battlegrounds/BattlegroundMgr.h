@@ -24,6 +24,9 @@
 #include "Battleground.h"
 #include "BattlegroundQueue.h"
 
+#include <functional>
+#include <mutex>
+
 typedef std::map<uint32, Battleground*> BattlegroundContainer;
 typedef std::set<uint32> BattlegroundClientIdsContainer;
 
@@ -91,8 +94,26 @@ class TC_GAME_API BattlegroundMgr
         void LoadBattlegroundTemplates();
         void DeleteAllBattlegrounds();
 
+        template<typename Worker>
+        void DoForAllBattlegrounds(Worker&& worker)
+        {
+            for (BattlegroundDataContainer::iterator itr = bgDataStore.begin(); itr != bgDataStore.end(); ++itr)
+            {
+                BattlegroundContainer& bgs = itr->second.m_Battlegrounds;
+                if (bgs.empty())
+                    continue;
+
+                // first one is template
+                for (BattlegroundContainer::iterator bgItr = ++bgs.begin(); bgItr != bgs.end(); ++bgItr)
+                    worker(bgItr->second);
+            }
+        }
+
         void SendToBattleground(Player* player, uint32 InstanceID, BattlegroundTypeId bgTypeId);
 
+        /// Work a battleground map thread must not do itself (shared groups), run at the start of the next Update
+        void AddWorldTask(std::function<void()>&& task);
+
         /* Battleground queues */
         BattlegroundQueue& GetBattlegroundQueue(BattlegroundQueueTypeId bgQueueTypeId) { return m_BattlegroundQueues[bgQueueTypeId]; }
         void ScheduleQueueUpdate(uint32 arenaMatchmakerRating, uint8 arenaType, BattlegroundQueueTypeId bgQueueTypeId, BattlegroundTypeId bgTypeId, BattlegroundBracketId bracket_id);
@@ -138,7 +159,13 @@ class TC_GAME_API BattlegroundMgr
 
         BattlegroundQueue m_BattlegroundQueues[MAX_BATTLEGROUND_QUEUE_TYPES];
 
+        void ProcessWorldTasks();
+
         std::vector<uint64> m_QueueUpdateScheduler;
+        std::mutex m_QueueUpdateSchedulerLock;
+        std::vector<std::function<void()>> m_WorldTasks;
+        std::mutex m_WorldTasksLock;
+        std::mutex m_FreeSlotQueueLock;
         uint32 m_NextRatedArenaUpdate;
         time_t m_NextAutoDistributionTime;
         uint32 m_AutoDistributionTimeChecker;
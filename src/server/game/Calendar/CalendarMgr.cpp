@@ -22,6 +22,7 @@
 #include "GuildMgr.h"
 #include "ObjectAccessor.h"
 #include "Opcodes.h"
+#include "World.h"
 
 CalendarInvite::~CalendarInvite()
 {
@@ -79,6 +80,7 @@ void CalendarMgr::LoadFromDB()
 
             CalendarEvent* calendarEvent = new CalendarEvent(eventId, creatorGUID, guildId, type, dungeonId, time_t(eventTime), flags, time_t(timezoneTime), title, description);
             _events.insert(calendarEvent);
+            IndexEvent(calendarEvent);
 
             _maxEventId = std::max(_maxEventId, eventId);
 
@@ -106,6 +108,7 @@ void CalendarMgr::LoadFromDB()
 
             CalendarInvite* invite = new CalendarInvite(inviteId, eventId, invitee, senderGUID, time_t(statusTime), status, rank, text);
             _invites[eventId].push_back(invite);
+            IndexInvite(invite);
 
             _maxInviteId = std::max(_maxInviteId, inviteId);
 
@@ -122,11 +125,14 @@ void CalendarMgr::LoadFromDB()
     for (uint64 i = 1; i < _maxInviteId; ++i)
         if (!GetInvite(i))
             _freeInviteIds.push_back(i);
+
+    ArchiveOldEvents();
 }
 
 void CalendarMgr::AddEvent(CalendarEvent* calendarEvent, CalendarSendEventType sendType)
 {
     _events.insert(calendarEvent);
+    IndexEvent(calendarEvent);
     UpdateEvent(calendarEvent);
     SendCalendarEvent(calendarEvent->GetCreatorGUID(), *calendarEvent, sendType);
 }
@@ -148,6 +154,7 @@ void CalendarMgr::AddInvite(CalendarEvent* calendarEvent, CalendarInvite* invite
     if (!calendarEvent->IsGuildAnnouncement())
     {
         _invites[invite->GetEventId()].push_back(invite);
+        IndexInvite(invite);
         UpdateInvite(invite, trans);
     }
 }
@@ -181,6 +188,7 @@ void CalendarMgr::RemoveEvent(uint64 eventId, ObjectGuid remover)
         if (remover && invite->GetInviteeGUID() != remover)
             mail.SendMailTo(trans, MailReceiver(invite->GetInviteeGUID().GetCounter()), calendarEvent, MAIL_CHECK_MASK_COPIED);
 
+        UnindexInvite(invite);
         delete invite;
     }
 
@@ -191,6 +199,7 @@ void CalendarMgr::RemoveEvent(uint64 eventId, ObjectGuid remover)
     trans->Append(stmt);
     CharacterDatabase.CommitTransaction(trans);
 
+    UnindexEvent(calendarEvent);
     delete calendarEvent;
     _events.erase(calendarEvent);
 }
@@ -226,6 +235,7 @@ void CalendarMgr::RemoveInvite(uint64 inviteId, uint64 eventId, ObjectGuid /*rem
     //    MailDraft(calendarEvent->BuildCalendarMailSubject(remover), calendarEvent->BuildCalendarMailBody())
     //        .SendMailTo(trans, MailReceiver((*itr)->GetInvitee()), calendarEvent, MAIL_CHECK_MASK_COPIED);
 
+    UnindexInvite(*itr);
     delete *itr;
     _invites[eventId].erase(itr);
 }
@@ -289,11 +299,110 @@ void CalendarMgr::RemovePlayerGuildEventsAndSignups(ObjectGuid guid, ObjectGuid:
                 RemoveInvite((*itr)->GetInviteId(), (*itr)->GetEventId(), guid);
 }
 
-CalendarEvent* CalendarMgr::GetEvent(uint64 eventId) const
+void CalendarMgr::ArchiveOldEvents()
 {
+    uint32 archiveDays = sWorld->getIntConfig(CONFIG_CALENDAR_ARCHIVE_DAYS);
+    if (!archiveDays)
+        return;
+
+    time_t cutoff = time(NULL) - time_t(archiveDays) * DAY;
+
+    std::vector<CalendarEvent*> oldEvents;
     for (CalendarEventStore::const_iterator itr = _events.begin(); itr != _events.end(); ++itr)
-        if ((*itr)->GetEventId() == eventId)
-            return *itr;
+        if ((*itr)->GetEventTime() < cutoff)
+            oldEvents.push_back(*itr);
+
+    if (oldEvents.empty())
+        return;
+
+    SQLTransaction trans = CharacterDatabase.BeginTransaction();
+    for (CalendarEvent* calendarEvent : oldEvents)
+    {
+        uint64 eventId = calendarEvent->GetEventId();
+
+        PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CALENDAR_EVENT_ARCHIVE);
+        stmt->setUInt64(0, eventId);
+        trans->Append(stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CALENDAR_INVITES_ARCHIVE);
+        stmt->setUInt64(0, eventId);
+        trans->Append(stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CALENDAR_INVITES_BY_EVENT);
+        stmt->setUInt64(0, eventId);
+        trans->Append(stmt);
+
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CALENDAR_EVENT);
+        stmt->setUInt64(0, eventId);
+        trans->Append(stmt);
+
+        CalendarEventInviteStore::iterator invites = _invites.find(eventId);
+        if (invites != _invites.end())
+        {
+            for (CalendarInvite* invite : invites->second)
+            {
+                UnindexInvite(invite);
+                delete invite;
+            }
+
+            _invites.erase(invites);
+        }
+
+        UnindexEvent(calendarEvent);
+        _events.erase(calendarEvent);
+        delete calendarEvent;
+    }
+    CharacterDatabase.CommitTransaction(trans);
+
+    TC_LOG_INFO("calendar", "CalendarMgr::ArchiveOldEvents: archived %u events older than %u days", uint32(oldEvents.size()), archiveDays);
+}
+
+void CalendarMgr::IndexEvent(CalendarEvent* calendarEvent)
+{
+    _eventIndex[calendarEvent->GetEventId()] = calendarEvent;
+
+    if (calendarEvent->GetGuildId())
+        _guildEvents[calendarEvent->GetGuildId()].insert(calendarEvent);
+}
+
+void CalendarMgr::UnindexEvent(CalendarEvent* calendarEvent)
+{
+    _eventIndex.erase(calendarEvent->GetEventId());
+
+    CalendarGuildEventIndex::iterator itr = _guildEvents.find(calendarEvent->GetGuildId());
+    if (itr != _guildEvents.end())
+    {
+        itr->second.erase(calendarEvent);
+        if (itr->second.empty())
+            _guildEvents.erase(itr);
+    }
+}
+
+void CalendarMgr::IndexInvite(CalendarInvite* invite)
+{
+    _inviteIndex[invite->GetInviteId()] = invite;
+    _playerInvites[invite->GetInviteeGUID()].push_back(invite);
+}
+
+void CalendarMgr::UnindexInvite(CalendarInvite* invite)
+{
+    _inviteIndex.erase(invite->GetInviteId());
+
+    CalendarPlayerInviteIndex::iterator itr = _playerInvites.find(invite->GetInviteeGUID());
+    if (itr == _playerInvites.end())
+        return;
+
+    CalendarInviteStore& invites = itr->second;
+    invites.erase(std::remove(invites.begin(), invites.end(), invite), invites.end());
+    if (invites.empty())
+        _playerInvites.erase(itr);
+}
+
+CalendarEvent* CalendarMgr::GetEvent(uint64 eventId) const
+{
+    CalendarEventIndex::const_iterator itr = _eventIndex.find(eventId);
+    if (itr != _eventIndex.end())
+        return itr->second;
 
     TC_LOG_DEBUG("calendar", "CalendarMgr::GetEvent: [" UI64FMTD "] not found!", eventId);
     return NULL;
@@ -301,10 +410,9 @@ CalendarEvent* CalendarMgr::GetEvent(uint64 eventId) const
 
 CalendarInvite* CalendarMgr::GetInvite(uint64 inviteId) const
 {
-    for (CalendarEventInviteStore::const_iterator itr = _invites.begin(); itr != _invites.end(); ++itr)
-        for (CalendarInviteStore::const_iterator itr2 = itr->second.begin(); itr2 != itr->second.end(); ++itr2)
-            if ((*itr2)->GetInviteId() == inviteId)
-                return *itr2;
+    CalendarInviteIndex::const_iterator itr = _inviteIndex.find(inviteId);
+    if (itr != _inviteIndex.end())
+        return itr->second;
 
     TC_LOG_DEBUG("calendar", "CalendarMgr::GetInvite: [" UI64FMTD "] not found!", inviteId);
     return NULL;
@@ -350,16 +458,18 @@ CalendarEventStore CalendarMgr::GetPlayerEvents(ObjectGuid guid)
 {
     CalendarEventStore events;
 
-    for (CalendarEventInviteStore::const_iterator itr = _invites.begin(); itr != _invites.end(); ++itr)
-        for (CalendarInviteStore::const_iterator itr2 = itr->second.begin(); itr2 != itr->second.end(); ++itr2)
-            if ((*itr2)->GetInviteeGUID() == guid)
-                if (CalendarEvent* event = GetEvent(itr->first)) // NULL check added as attempt to fix #11512
-                    events.insert(event);
+    CalendarPlayerInviteIndex::const_iterator invites = _playerInvites.find(guid);
+    if (invites != _playerInvites.end())
+        for (CalendarInviteStore::const_iterator itr = invites->second.begin(); itr != invites->second.end(); ++itr)
+            if (CalendarEvent* event = GetEvent((*itr)->GetEventId())) // NULL check added as attempt to fix #11512
+                events.insert(event);
 
     if (Player* player = ObjectAccessor::FindConnectedPlayer(guid))
-        for (CalendarEventStore::const_iterator itr = _events.begin(); itr != _events.end(); ++itr)
-            if ((*itr)->GetGuildId() == player->GetGuildId())
-                events.insert(*itr);
+    {
+        CalendarGuildEventIndex::const_iterator guildEvents = _guildEvents.find(player->GetGuildId());
+        if (player->GetGuildId() && guildEvents != _guildEvents.end())
+            events.insert(guildEvents->second.begin(), guildEvents->second.end());
+    }
 
     return events;
 }
@@ -371,14 +481,11 @@ CalendarInviteStore const& CalendarMgr::GetEventInvites(uint64 eventId)
 
 CalendarInviteStore CalendarMgr::GetPlayerInvites(ObjectGuid guid)
 {
-    CalendarInviteStore invites;
-
-    for (CalendarEventInviteStore::const_iterator itr = _invites.begin(); itr != _invites.end(); ++itr)
-        for (CalendarInviteStore::const_iterator itr2 = itr->second.begin(); itr2 != itr->second.end(); ++itr2)
-            if ((*itr2)->GetInviteeGUID() == guid)
-                invites.push_back(*itr2);
+    CalendarPlayerInviteIndex::const_iterator itr = _playerInvites.find(guid);
+    if (itr == _playerInvites.end())
+        return CalendarInviteStore();
 
-    return invites;
+    return itr->second;
 }
 
 uint32 CalendarMgr::GetPlayerNumPending(ObjectGuid guid)
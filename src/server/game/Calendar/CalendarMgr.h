@@ -22,6 +22,7 @@
 #include "DatabaseEnv.h"
 #include "WorldPacket.h"
 #include "ObjectGuid.h"
+#include <unordered_map>
 
 enum CalendarMailAnswers
 {
@@ -265,6 +266,10 @@ struct TC_GAME_API CalendarEvent
 typedef std::vector<CalendarInvite*> CalendarInviteStore;
 typedef std::set<CalendarEvent*> CalendarEventStore;
 typedef std::map<uint64 /* eventId */, CalendarInviteStore > CalendarEventInviteStore;
+typedef std::unordered_map<uint64 /* eventId */, CalendarEvent*> CalendarEventIndex;
+typedef std::unordered_map<uint64 /* inviteId */, CalendarInvite*> CalendarInviteIndex;
+typedef std::unordered_map<ObjectGuid /* invitee */, CalendarInviteStore> CalendarPlayerInviteIndex;
+typedef std::unordered_map<ObjectGuid::LowType /* guildId */, CalendarEventStore> CalendarGuildEventIndex;
 
 class TC_GAME_API CalendarMgr
 {
@@ -275,6 +280,17 @@ class TC_GAME_API CalendarMgr
         CalendarEventStore _events;
         CalendarEventInviteStore _invites;
 
+        // lookups by id, invitee and guild, maintained together with _events and _invites
+        CalendarEventIndex _eventIndex;
+        CalendarInviteIndex _inviteIndex;
+        CalendarPlayerInviteIndex _playerInvites;
+        CalendarGuildEventIndex _guildEvents;
+
+        void IndexEvent(CalendarEvent* calendarEvent);
+        void UnindexEvent(CalendarEvent* calendarEvent);
+        void IndexInvite(CalendarInvite* invite);
+        void UnindexInvite(CalendarInvite* invite);
+
         std::deque<uint64> _freeEventIds;
         std::deque<uint64> _freeInviteIds;
         uint64 _maxEventId;
@@ -311,6 +327,9 @@ class TC_GAME_API CalendarMgr
         void UpdateInvite(CalendarInvite* invite);
         void UpdateInvite(CalendarInvite* invite, SQLTransaction& trans);
 
+        /// Moves events older than Calendar.ArchiveAfterDays with their invites to the archive tables
+        void ArchiveOldEvents();
+
         void RemoveAllPlayerEventsAndInvites(ObjectGuid guid);
         void RemovePlayerGuildEventsAndSignups(ObjectGuid guid, ObjectGuid::LowType guildId);
 
@@ -202,6 +202,7 @@ void Channel::JoinChannel(Player* player, std::string const& pass)
     pinfo.player = guid;
     pinfo.flags = MEMBER_FLAG_NONE;
     playersStore[guid] = pinfo;
+    AddMember(player);
 
     WorldPacket data;
     MakeYouJoined(&data);
@@ -251,6 +252,7 @@ void Channel::LeaveChannel(Player* player, bool send)
     bool changeowner = playersStore[guid].IsOwner();
 
     playersStore.erase(guid);
+    RemoveMember(guid);
 
     if (_announce && !player->GetSession()->HasPermission(rbac::RBAC_PERM_SILENTLY_JOIN_CHANNEL))
     {
@@ -336,6 +338,7 @@ void Channel::KickOrBan(Player const* player, std::string const& badname, bool b
     }
 
     playersStore.erase(victim);
+    RemoveMember(victim);
     bad->LeftChannel(this);
 
     if (changeowner && _ownership && !playersStore.empty())
@@ -722,18 +725,21 @@ void Channel::SetOwner(ObjectGuid guid, bool exclaim)
 
 void Channel::SendToAll(WorldPacket* data, ObjectGuid guid)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (Player* player = ObjectAccessor::FindConnectedPlayer(i->first))
-            if (!guid || !player->GetSocial()->HasIgnore(guid.GetCounter()))
-                player->GetSession()->SendPacket(data);
+    std::shared_ptr<WorldPacket const> packet = std::make_shared<WorldPacket const>(*data);
+    for (MemberContainer::const_iterator i = _members.begin(); i != _members.end(); ++i)
+    {
+        PlayerSocial* social = i->player->GetSocial();
+        if (!guid || !social->HasIgnores() || !social->HasIgnore(guid.GetCounter()))
+            i->player->GetSession()->SendSharedPacket(packet);
+    }
 }
 
 void Channel::SendToAllButOne(WorldPacket* data, ObjectGuid who)
 {
-    for (PlayerContainer::const_iterator i = playersStore.begin(); i != playersStore.end(); ++i)
-        if (i->first != who)
-            if (Player* player = ObjectAccessor::FindConnectedPlayer(i->first))
-                player->GetSession()->SendPacket(data);
+    std::shared_ptr<WorldPacket const> packet = std::make_shared<WorldPacket const>(*data);
+    for (MemberContainer::const_iterator i = _members.begin(); i != _members.end(); ++i)
+        if (i->guid != who)
+            i->player->GetSession()->SendSharedPacket(packet);
 }
 
 void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
@@ -742,6 +748,27 @@ void Channel::SendToOne(WorldPacket* data, ObjectGuid who)
         player->GetSession()->SendPacket(data);
 }
 
+void Channel::AddMember(Player* player)
+{
+    MemberInfo member;
+    member.guid = player->GetGUID();
+    member.player = player;
+    _members.push_back(member);
+}
+
+void Channel::RemoveMember(ObjectGuid guid)
+{
+    for (MemberContainer::iterator i = _members.begin(); i != _members.end(); ++i)
+    {
+        if (i->guid == guid)
+        {
+            *i = _members.back();
+            _members.pop_back();
+            return;
+        }
+    }
+}
+
 void Channel::Voice(ObjectGuid /*guid1*/, ObjectGuid /*guid2*/)
 {
 
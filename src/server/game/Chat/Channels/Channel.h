@@ -22,6 +22,7 @@
 #include <list>
 #include <map>
 #include <string>
+#include <vector>
 
 #include "Common.h"
 
@@ -230,6 +231,9 @@ class TC_GAME_API Channel
         void SendToAllButOne(WorldPacket* data, ObjectGuid who);
         void SendToOne(WorldPacket* data, ObjectGuid who);
 
+        void AddMember(Player* player);
+        void RemoveMember(ObjectGuid guid);
+
         bool IsOn(ObjectGuid who) const { return playersStore.find(who) != playersStore.end(); }
         bool IsBanned(ObjectGuid guid) const { return bannedStore.find(guid) != bannedStore.end(); }
 
@@ -271,6 +275,15 @@ class TC_GAME_API Channel
         typedef std::map<ObjectGuid, PlayerInfo> PlayerContainer;
         typedef GuidSet BannedContainer;
 
+        // members with their Player, valid until Player::CleanupChannels() makes them leave on logout
+        struct MemberInfo
+        {
+            ObjectGuid guid;
+            Player* player;
+        };
+
+        typedef std::vector<MemberInfo> MemberContainer;
+
         bool _announce;
         bool _ownership;
         bool _IsSaved;
@@ -281,6 +294,7 @@ class TC_GAME_API Channel
         std::string _name;
         std::string _password;
         PlayerContainer playersStore;
+        MemberContainer _members;                    // same players as playersStore, contiguous for broadcasts
         BannedContainer bannedStore;
 };
 #endif
@@ -26,7 +26,11 @@
 #include "ObjectDefines.h"
 
 #include <boost/regex.hpp>
+#include <atomic>
+#include <functional>
 #include <map>
+#include <mutex>
+#include <thread>
 
 typedef std::map<uint16, uint32> AreaFlagByAreaID;
 typedef std::map<uint32, uint32> AreaFlagByMapID;
@@ -229,51 +233,118 @@ static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, const std::string&
     return false;
 }
 
-template<class T>
-inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCStorage<T>& storage, std::string const& dbcPath, std::string const& filename, std::string const* customFormat = NULL, std::string const* customIndexName = NULL)
+struct DBCStoreLoadInfo
 {
-    // compatibility format and C++ structure sizes
-    ASSERT(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDBC_assert_print(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
+    std::string Filename;
+    uint32 LoadTime;                                        // microseconds
+    uint32 Rows;
+    size_t AllocatedSize;
+    bool InPlace;
+};
 
-    ++DBCFileCount;
-    std::string dbcFilename = dbcPath + filename;
-    SqlDbc * sql = NULL;
-    if (customFormat)
-        sql = new SqlDbc(&filename, customFormat, customIndexName, storage.GetFormat());
+// Loads the registered stores from a few threads, every store is independent from the others
+class DBCStoreLoader
+{
+    public:
+        explicit DBCStoreLoader(std::string const& dbcPath) : _dbcPath(dbcPath), _availableDbcLocales(0xFFFFFFFF) { }
 
-    if (storage.Load(dbcFilename.c_str(), sql))
-    {
-        for (uint8 i = 0; i < TOTAL_LOCALES; ++i)
+        template<class T>
+        void Add(DBCStorage<T>& storage, std::string const& filename, std::string const* customFormat = NULL, std::string const* customIndexName = NULL)
         {
-            if (!(availableDbcLocales & (1 << i)))
-                continue;
+            // compatibility format and C++ structure sizes
+            ASSERT(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()) == sizeof(T) || LoadDBC_assert_print(DBCFileLoader::GetFormatRecordSize(storage.GetFormat()), sizeof(T), filename));
 
-            std::string localizedName(dbcPath);
-            localizedName.append(localeNames[i]);
-            localizedName.push_back('/');
-            localizedName.append(filename);
+            size_t index = _stores.size();
+            _stores.push_back({ filename, 0, 0, 0, false });
+            _tasks.push_back([this, &storage, filename, customFormat, customIndexName, index]()
+            {
+                LoadStore(storage, filename, customFormat, customIndexName, _stores[index]);
+            });
+        }
 
-            if (!storage.LoadStringsFrom(localizedName.c_str()))
-                availableDbcLocales &= ~(1<<i);             // mark as not available for speedup next checks
+        void LoadAll(uint32 threadCount)
+        {
+            std::atomic<size_t> next(0);
+            auto worker = [this, &next]()
+            {
+                for (size_t i = next++; i < _tasks.size(); i = next++)
+                    _tasks[i]();
+            };
+
+            std::vector<std::thread> threads;
+            for (uint32 i = 1; i < threadCount && i < _tasks.size(); ++i)
+                threads.emplace_back(worker);
+
+            worker();
+
+            for (std::thread& thread : threads)
+                thread.join();
         }
-    }
-    else
-    {
-        // sort problematic dbc to (1) non compatible and (2) non-existed
-        if (FILE* f = fopen(dbcFilename.c_str(), "rb"))
+
+        uint32 GetStoreCount() const { return uint32(_stores.size()); }
+        std::vector<DBCStoreLoadInfo> const& GetLoadInfo() const { return _stores; }
+        StoreProblemList const& GetErrors() const { return _errors; }
+
+    private:
+        template<class T>
+        void LoadStore(DBCStorage<T>& storage, std::string const& filename, std::string const* customFormat, std::string const* customIndexName, DBCStoreLoadInfo& info)
         {
-            std::ostringstream stream;
-            stream << dbcFilename << " exists, and has " << storage.GetFieldCount() << " field(s) (expected " << strlen(storage.GetFormat()) << "). Extracted file might be from wrong client version or a database-update has been forgotten.";
-            std::string buf = stream.str();
-            errors.push_back(buf);
-            fclose(f);
+            auto start = std::chrono::steady_clock::now();
+
+            std::string dbcFilename = _dbcPath + filename;
+            SqlDbc * sql = NULL;
+            if (customFormat)
+                sql = new SqlDbc(&filename, customFormat, customIndexName, storage.GetFormat());
+
+            if (storage.Load(dbcFilename.c_str(), sql))
+            {
+                // only string fields are localized
+                bool hasStrings = strchr(storage.GetFormat(), FT_STRING) != NULL;
+                for (uint8 i = 0; i < TOTAL_LOCALES && hasStrings; ++i)
+                {
+                    if (!(_availableDbcLocales & (1 << i)))
+                        continue;
+
+                    std::string localizedName(_dbcPath);
+                    localizedName.append(localeNames[i]);
+                    localizedName.push_back('/');
+                    localizedName.append(filename);
+
+                    if (!storage.LoadStringsFrom(localizedName.c_str()))
+                        _availableDbcLocales &= ~(1<<i);    // mark as not available for speedup next checks
+                }
+            }
+            else
+            {
+                // sort problematic dbc to (1) non compatible and (2) non-existed
+                std::lock_guard<std::mutex> lock(_errorsLock);
+                if (FILE* f = fopen(dbcFilename.c_str(), "rb"))
+                {
+                    std::ostringstream stream;
+                    stream << dbcFilename << " exists, and has " << storage.GetFieldCount() << " field(s) (expected " << strlen(storage.GetFormat()) << "). Extracted file might be from wrong client version or a database-update has been forgotten.";
+                    std::string buf = stream.str();
+                    _errors.push_back(buf);
+                    fclose(f);
+                }
+                else
+                    _errors.push_back(dbcFilename);
+            }
+
+            delete sql;
+
+            info.LoadTime = uint32(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count());
+            info.Rows = storage.GetNumRows();
+            info.AllocatedSize = storage.GetAllocatedSize();
+            info.InPlace = storage.IsMappedInPlace();
         }
-        else
-            errors.push_back(dbcFilename);
-    }
 
-    delete sql;
-}
+        std::string _dbcPath;
+        std::atomic<uint32> _availableDbcLocales;
+        std::vector<DBCStoreLoadInfo> _stores;
+        std::vector<std::function<void()>> _tasks;
+        std::mutex _errorsLock;
+        StoreProblemList _errors;
+};
 
 void LoadDBCStores(const std::string& dataPath)
 {
@@ -281,55 +352,138 @@ void LoadDBCStores(const std::string& dataPath)
 
     std::string dbcPath = dataPath+"dbc/";
 
-    StoreProblemList bad_dbc_files;
-    uint32 availableDbcLocales = 0xFFFFFFFF;
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAreaTableStore,                   dbcPath, "AreaTable.dbc");
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAchievementStore,            dbcPath, "Achievement.dbc", &CustomAchievementfmt, &CustomAchievementIndex);
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAchievementCriteriaStore,    dbcPath, "Achievement_Criteria.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAreaTriggerStore,            dbcPath, "AreaTrigger.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAreaGroupStore,              dbcPath, "AreaGroup.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAreaPOIStore,                dbcPath, "AreaPOI.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sAuctionHouseStore,           dbcPath, "AuctionHouse.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sBankBagSlotPricesStore,      dbcPath, "BankBagSlotPrices.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sBannedAddOnsStore,           dbcPath, "BannedAddOns.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sBattlemasterListStore,       dbcPath, "BattlemasterList.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sBarberShopStyleStore,        dbcPath, "BarberShopStyle.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCharStartOutfitStore,        dbcPath, "CharStartOutfit.dbc");
+    DBCStoreLoader loader(dbcPath);
+
+    loader.Add(sAreaTableStore,                   "AreaTable.dbc");
+    loader.Add(sAchievementStore,            "Achievement.dbc", &CustomAchievementfmt, &CustomAchievementIndex);
+    loader.Add(sAchievementCriteriaStore,    "Achievement_Criteria.dbc");
+    loader.Add(sAreaTriggerStore,            "AreaTrigger.dbc");
+    loader.Add(sAreaGroupStore,              "AreaGroup.dbc");
+    loader.Add(sAreaPOIStore,                "AreaPOI.dbc");
+    loader.Add(sAuctionHouseStore,           "AuctionHouse.dbc");
+    loader.Add(sBankBagSlotPricesStore,      "BankBagSlotPrices.dbc");
+    loader.Add(sBannedAddOnsStore,           "BannedAddOns.dbc");
+    loader.Add(sBattlemasterListStore,       "BattlemasterList.dbc");
+    loader.Add(sBarberShopStyleStore,        "BarberShopStyle.dbc");
+    loader.Add(sCharStartOutfitStore,        "CharStartOutfit.dbc");
+    loader.Add(sCharSectionsStore,           "CharSections.dbc");
+    loader.Add(sCharTitlesStore,             "CharTitles.dbc");
+    loader.Add(sChatChannelsStore,           "ChatChannels.dbc");
+    loader.Add(sChrClassesStore,             "ChrClasses.dbc");
+    loader.Add(sChrRacesStore,               "ChrRaces.dbc");
+    loader.Add(sCinematicSequencesStore,     "CinematicSequences.dbc");
+    loader.Add(sCreatureDisplayInfoStore,    "CreatureDisplayInfo.dbc");
+    loader.Add(sCreatureDisplayInfoExtraStore, "CreatureDisplayInfoExtra.dbc");
+    loader.Add(sCreatureFamilyStore,         "CreatureFamily.dbc");
+    loader.Add(sCreatureModelDataStore,      "CreatureModelData.dbc");
+    loader.Add(sCreatureSpellDataStore,      "CreatureSpellData.dbc");
+    loader.Add(sCreatureTypeStore,           "CreatureType.dbc");
+    loader.Add(sCurrencyTypesStore,          "CurrencyTypes.dbc");
+    loader.Add(sDestructibleModelDataStore,  "DestructibleModelData.dbc");
+    loader.Add(sDungeonEncounterStore,       "DungeonEncounter.dbc");
+    loader.Add(sDurabilityCostsStore,        "DurabilityCosts.dbc");
+    loader.Add(sDurabilityQualityStore,      "DurabilityQuality.dbc");
+    loader.Add(sEmotesStore,                 "Emotes.dbc");
+    loader.Add(sEmotesTextStore,             "EmotesText.dbc");
+    loader.Add(sEmotesTextSoundStore,        "EmotesTextSound.dbc");
+    loader.Add(sFactionStore,                "Faction.dbc");
+    loader.Add(sFactionTemplateStore,        "FactionTemplate.dbc");
+    loader.Add(sGameObjectDisplayInfoStore,  "GameObjectDisplayInfo.dbc");
+    loader.Add(sGemPropertiesStore,          "GemProperties.dbc");
+    loader.Add(sGlyphPropertiesStore,        "GlyphProperties.dbc");
+    loader.Add(sGlyphSlotStore,              "GlyphSlot.dbc");
+    loader.Add(sGtBarberShopCostBaseStore,   "gtBarberShopCostBase.dbc");
+    loader.Add(sGtCombatRatingsStore,        "gtCombatRatings.dbc");
+    loader.Add(sGtChanceToMeleeCritBaseStore, "gtChanceToMeleeCritBase.dbc");
+    loader.Add(sGtChanceToMeleeCritStore,    "gtChanceToMeleeCrit.dbc");
+    loader.Add(sGtChanceToSpellCritBaseStore, "gtChanceToSpellCritBase.dbc");
+    loader.Add(sGtChanceToSpellCritStore,    "gtChanceToSpellCrit.dbc");
+    loader.Add(sGtNPCManaCostScalerStore,    "gtNPCManaCostScaler.dbc");
+    loader.Add(sGtOCTClassCombatRatingScalarStore,    "gtOCTClassCombatRatingScalar.dbc");
+    loader.Add(sGtOCTRegenHPStore,           "gtOCTRegenHP.dbc");
+    //loader.Add(sGtOCTRegenMPStore,           "gtOCTRegenMP.dbc");       -- not used currently
+    loader.Add(sGtRegenHPPerSptStore,        "gtRegenHPPerSpt.dbc");
+    loader.Add(sGtRegenMPPerSptStore,        "gtRegenMPPerSpt.dbc");
+    loader.Add(sHolidaysStore,               "Holidays.dbc");
+    loader.Add(sItemStore,                   "Item.dbc");
+    loader.Add(sItemBagFamilyStore,          "ItemBagFamily.dbc");
+    //loader.Add(sItemDisplayInfoStore,        "ItemDisplayInfo.dbc");     -- not used currently
+    //loader.Add(sItemCondExtCostsStore,       "ItemCondExtCosts.dbc");
+    loader.Add(sItemExtendedCostStore,       "ItemExtendedCost.dbc");
+    loader.Add(sItemLimitCategoryStore,      "ItemLimitCategory.dbc");
+    loader.Add(sItemRandomPropertiesStore,   "ItemRandomProperties.dbc");
+    loader.Add(sItemRandomSuffixStore,       "ItemRandomSuffix.dbc");
+    loader.Add(sItemSetStore,                "ItemSet.dbc");
+    loader.Add(sLFGDungeonStore,             "LFGDungeons.dbc");
+    loader.Add(sLightStore,                  "Light.dbc");
+    loader.Add(sLiquidTypeStore,             "LiquidType.dbc");
+    loader.Add(sLockStore,                   "Lock.dbc");
+    loader.Add(sMailTemplateStore,           "MailTemplate.dbc");
+    loader.Add(sMapStore,                    "Map.dbc");
+    loader.Add(sMapDifficultyStore,          "MapDifficulty.dbc");
+    loader.Add(sMovieStore,                  "Movie.dbc");
+    loader.Add(sNamesProfanityStore, "NamesProfanity.dbc");
+    loader.Add(sNamesReservedStore, "NamesReserved.dbc");
+    loader.Add(sOverrideSpellDataStore,      "OverrideSpellData.dbc");
+    loader.Add(sPowerDisplayStore,           "PowerDisplay.dbc");
+    loader.Add(sPvPDifficultyStore,          "PvpDifficulty.dbc");
+    loader.Add(sQuestXPStore,                "QuestXP.dbc");
+    loader.Add(sQuestFactionRewardStore,     "QuestFactionReward.dbc");
+    loader.Add(sQuestSortStore,              "QuestSort.dbc");
+    loader.Add(sRandomPropertiesPointsStore, "RandPropPoints.dbc");
+    loader.Add(sScalingStatDistributionStore, "ScalingStatDistribution.dbc");
+    loader.Add(sScalingStatValuesStore,      "ScalingStatValues.dbc");
+    loader.Add(sSkillLineStore,              "SkillLine.dbc");
+    loader.Add(sSkillLineAbilityStore,       "SkillLineAbility.dbc");
+    loader.Add(sSkillRaceClassInfoStore,     "SkillRaceClassInfo.dbc");
+    loader.Add(sSkillTiersStore,             "SkillTiers.dbc");
+    loader.Add(sSoundEntriesStore,           "SoundEntries.dbc");
+    loader.Add(sSpellStore,                  "Spell.dbc", &CustomSpellEntryfmt, &CustomSpellEntryIndex);
+    loader.Add(sSpellCastTimesStore,         "SpellCastTimes.dbc");
+    loader.Add(sSpellCategoryStore,          "SpellCategory.dbc");
+    loader.Add(sSpellDifficultyStore,        "SpellDifficulty.dbc", &CustomSpellDifficultyfmt, &CustomSpellDifficultyIndex);
+    loader.Add(sSpellDurationStore,          "SpellDuration.dbc");
+    loader.Add(sSpellFocusObjectStore,       "SpellFocusObject.dbc");
+    loader.Add(sSpellItemEnchantmentStore,   "SpellItemEnchantment.dbc");
+    loader.Add(sSpellItemEnchantmentConditionStore, "SpellItemEnchantmentCondition.dbc");
+    loader.Add(sSpellRadiusStore,            "SpellRadius.dbc");
+    loader.Add(sSpellRangeStore,             "SpellRange.dbc");
+    loader.Add(sSpellRuneCostStore,          "SpellRuneCost.dbc");
+    loader.Add(sSpellShapeshiftStore,        "SpellShapeshiftForm.dbc");
+    loader.Add(sStableSlotPricesStore,       "StableSlotPrices.dbc");
+    loader.Add(sSummonPropertiesStore,       "SummonProperties.dbc");
+    loader.Add(sTalentStore,                 "Talent.dbc");
+    loader.Add(sTalentTabStore,              "TalentTab.dbc");
+    loader.Add(sTaxiNodesStore,              "TaxiNodes.dbc");
+    loader.Add(sTaxiPathStore,               "TaxiPath.dbc");
+    loader.Add(sTaxiPathNodeStore,           "TaxiPathNode.dbc");
+    loader.Add(sTeamContributionPointsStore, "TeamContributionPoints.dbc");
+    loader.Add(sTotemCategoryStore,          "TotemCategory.dbc");
+    loader.Add(sTransportAnimationStore,     "TransportAnimation.dbc");
+    loader.Add(sTransportRotationStore,     "TransportRotation.dbc");
+    loader.Add(sVehicleStore,                "Vehicle.dbc");
+    loader.Add(sVehicleSeatStore,            "VehicleSeat.dbc");
+    loader.Add(sWMOAreaTableStore,           "WMOAreaTable.dbc");
+    loader.Add(sWorldMapAreaStore,           "WorldMapArea.dbc");
+    loader.Add(sWorldMapOverlayStore,        "WorldMapOverlay.dbc");
+    loader.Add(sWorldSafeLocsStore,          "WorldSafeLocs.dbc");
+
+    loader.LoadAll(std::max(1u, std::min(std::thread::hardware_concurrency(), 8u)));
+    DBCFileCount = loader.GetStoreCount();
+    StoreProblemList const& bad_dbc_files = loader.GetErrors();
+
     for (uint32 i = 0; i < sCharStartOutfitStore.GetNumRows(); ++i)
         if (CharStartOutfitEntry const* outfit = sCharStartOutfitStore.LookupEntry(i))
             sCharStartOutfitMap[outfit->Race | (outfit->Class << 8) | (outfit->Gender << 16)] = outfit;
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCharSectionsStore,           dbcPath, "CharSections.dbc");
     for (uint32 i = 0; i < sCharSectionsStore.GetNumRows(); ++i)
         if (CharSectionsEntry const* entry = sCharSectionsStore.LookupEntry(i))
             if (entry->Race && ((1 << (entry->Race - 1)) & RACEMASK_ALL_PLAYABLE) != 0) //ignore Nonplayable races
                 sCharSectionMap.insert({ entry->GenType | (entry->Gender << 8) | (entry->Race << 16), entry });
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCharTitlesStore,             dbcPath, "CharTitles.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sChatChannelsStore,           dbcPath, "ChatChannels.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sChrClassesStore,             dbcPath, "ChrClasses.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sChrRacesStore,               dbcPath, "ChrRaces.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCinematicSequencesStore,     dbcPath, "CinematicSequences.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureDisplayInfoStore,    dbcPath, "CreatureDisplayInfo.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureDisplayInfoExtraStore, dbcPath, "CreatureDisplayInfoExtra.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureFamilyStore,         dbcPath, "CreatureFamily.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureModelDataStore,      dbcPath, "CreatureModelData.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureSpellDataStore,      dbcPath, "CreatureSpellData.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCreatureTypeStore,           dbcPath, "CreatureType.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sCurrencyTypesStore,          dbcPath, "CurrencyTypes.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sDestructibleModelDataStore,  dbcPath, "DestructibleModelData.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sDungeonEncounterStore,       dbcPath, "DungeonEncounter.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sDurabilityCostsStore,        dbcPath, "DurabilityCosts.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sDurabilityQualityStore,      dbcPath, "DurabilityQuality.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sEmotesStore,                 dbcPath, "Emotes.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sEmotesTextStore,             dbcPath, "EmotesText.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sEmotesTextSoundStore,        dbcPath, "EmotesTextSound.dbc");
     for (uint32 i = 0; i < sEmotesTextSoundStore.GetNumRows(); ++i)
         if (EmotesTextSoundEntry const* entry = sEmotesTextSoundStore.LookupEntry(i))
             sEmotesTextSoundMap[EmotesTextSoundKey(entry->EmotesTextId, entry->RaceId, entry->SexId)] = entry;
-    LoadDBC(availableDbcLocales, bad_dbc_files, sFactionStore,                dbcPath, "Faction.dbc");
     for (uint32 i=0; i<sFactionStore.GetNumRows(); ++i)
     {
         FactionEntry const* faction = sFactionStore.LookupEntry(i);
@@ -340,8 +494,6 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sFactionTemplateStore,        dbcPath, "FactionTemplate.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGameObjectDisplayInfoStore,  dbcPath, "GameObjectDisplayInfo.dbc");
     for (uint32 i = 0; i < sGameObjectDisplayInfoStore.GetNumRows(); ++i)
     {
         if (GameObjectDisplayInfoEntry const* info = sGameObjectDisplayInfoStore.LookupEntry(i))
@@ -355,52 +507,12 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGemPropertiesStore,          dbcPath, "GemProperties.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGlyphPropertiesStore,        dbcPath, "GlyphProperties.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGlyphSlotStore,              dbcPath, "GlyphSlot.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtBarberShopCostBaseStore,   dbcPath, "gtBarberShopCostBase.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtCombatRatingsStore,        dbcPath, "gtCombatRatings.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtChanceToMeleeCritBaseStore, dbcPath, "gtChanceToMeleeCritBase.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtChanceToMeleeCritStore,    dbcPath, "gtChanceToMeleeCrit.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtChanceToSpellCritBaseStore, dbcPath, "gtChanceToSpellCritBase.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtChanceToSpellCritStore,    dbcPath, "gtChanceToSpellCrit.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtNPCManaCostScalerStore,    dbcPath, "gtNPCManaCostScaler.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtOCTClassCombatRatingScalarStore,    dbcPath, "gtOCTClassCombatRatingScalar.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtOCTRegenHPStore,           dbcPath, "gtOCTRegenHP.dbc");
-    //LoadDBC(dbcCount, availableDbcLocales, bad_dbc_files, sGtOCTRegenMPStore,           dbcPath, "gtOCTRegenMP.dbc");       -- not used currently
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtRegenHPPerSptStore,        dbcPath, "gtRegenHPPerSpt.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sGtRegenMPPerSptStore,        dbcPath, "gtRegenMPPerSpt.dbc");
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sHolidaysStore,               dbcPath, "Holidays.dbc");
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemStore,                   dbcPath, "Item.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemBagFamilyStore,          dbcPath, "ItemBagFamily.dbc");
-    //LoadDBC(dbcCount, availableDbcLocales, bad_dbc_files, sItemDisplayInfoStore,        dbcPath, "ItemDisplayInfo.dbc");     -- not used currently
-    //LoadDBC(dbcCount, availableDbcLocales, bad_dbc_files, sItemCondExtCostsStore,       dbcPath, "ItemCondExtCosts.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemExtendedCostStore,       dbcPath, "ItemExtendedCost.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemLimitCategoryStore,      dbcPath, "ItemLimitCategory.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemRandomPropertiesStore,   dbcPath, "ItemRandomProperties.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemRandomSuffixStore,       dbcPath, "ItemRandomSuffix.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sItemSetStore,                dbcPath, "ItemSet.dbc");
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sLFGDungeonStore,             dbcPath, "LFGDungeons.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sLightStore,                  dbcPath, "Light.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sLiquidTypeStore,             dbcPath, "LiquidType.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sLockStore,                   dbcPath, "Lock.dbc");
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMailTemplateStore,           dbcPath, "MailTemplate.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMapStore,                    dbcPath, "Map.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMapDifficultyStore,          dbcPath, "MapDifficulty.dbc");
     // fill data
     for (uint32 i = 1; i < sMapDifficultyStore.GetNumRows(); ++i)
         if (MapDifficultyEntry const* entry = sMapDifficultyStore.LookupEntry(i))
             sMapDifficultyMap[MAKE_PAIR32(entry->MapId, entry->Difficulty)] = MapDifficulty(entry->resetTime, entry->maxPlayers, entry->areaTriggerText[0] != '\0');
     sMapDifficultyStore.Clear();
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sMovieStore,                  dbcPath, "Movie.dbc");
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sNamesProfanityStore, dbcPath, "NamesProfanity.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sNamesReservedStore, dbcPath, "NamesReserved.dbc");
     for (uint32 i = 0; i < sNamesProfanityStore.GetNumRows(); ++i)
     {
         NamesProfanityEntry const* namesProfanity = sNamesProfanityStore.LookupEntry(i);
@@ -429,36 +541,16 @@ void LoadDBCStores(const std::string& dataPath)
                 NamesReservedValidators[i].emplace_back(namesReserved->Name, boost::regex::perl | boost::regex::icase | boost::regex::optimize);
     }
 
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sOverrideSpellDataStore,      dbcPath, "OverrideSpellData.dbc");
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sPowerDisplayStore,           dbcPath, "PowerDisplay.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sPvPDifficultyStore,          dbcPath, "PvpDifficulty.dbc");
     for (uint32 i = 0; i < sPvPDifficultyStore.GetNumRows(); ++i)
         if (PvPDifficultyEntry const* entry = sPvPDifficultyStore.LookupEntry(i))
             if (entry->bracketId > MAX_BATTLEGROUND_BRACKETS)
                 ASSERT(false && "Need update MAX_BATTLEGROUND_BRACKETS by DBC data");
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sQuestXPStore,                dbcPath, "QuestXP.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sQuestFactionRewardStore,     dbcPath, "QuestFactionReward.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sQuestSortStore,              dbcPath, "QuestSort.dbc");
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sRandomPropertiesPointsStore, dbcPath, "RandPropPoints.dbc");
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sScalingStatDistributionStore, dbcPath, "ScalingStatDistribution.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sScalingStatValuesStore,      dbcPath, "ScalingStatValues.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSkillLineStore,              dbcPath, "SkillLine.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSkillLineAbilityStore,       dbcPath, "SkillLineAbility.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSkillRaceClassInfoStore,     dbcPath, "SkillRaceClassInfo.dbc");
     for (uint32 i = 0; i < sSkillRaceClassInfoStore.GetNumRows(); ++i)
         if (SkillRaceClassInfoEntry const* entry = sSkillRaceClassInfoStore.LookupEntry(i))
             if (sSkillLineStore.LookupEntry(entry->SkillId))
                 SkillRaceClassInfoBySkill.emplace(entry->SkillId, entry);
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSkillTiersStore,             dbcPath, "SkillTiers.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSoundEntriesStore,           dbcPath, "SoundEntries.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellStore,                  dbcPath, "Spell.dbc", &CustomSpellEntryfmt, &CustomSpellEntryIndex);
-
     for (uint32 j = 0; j < sSkillLineAbilityStore.GetNumRows(); ++j)
     {
         SkillLineAbilityEntry const* skillLine = sSkillLineAbilityStore.LookupEntry(j);
@@ -489,22 +581,6 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellCastTimesStore,         dbcPath, "SpellCastTimes.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellCategoryStore,          dbcPath, "SpellCategory.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellDifficultyStore,        dbcPath, "SpellDifficulty.dbc", &CustomSpellDifficultyfmt, &CustomSpellDifficultyIndex);
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellDurationStore,          dbcPath, "SpellDuration.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellFocusObjectStore,       dbcPath, "SpellFocusObject.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellItemEnchantmentStore,   dbcPath, "SpellItemEnchantment.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellItemEnchantmentConditionStore, dbcPath, "SpellItemEnchantmentCondition.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellRadiusStore,            dbcPath, "SpellRadius.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellRangeStore,             dbcPath, "SpellRange.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellRuneCostStore,          dbcPath, "SpellRuneCost.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSpellShapeshiftStore,        dbcPath, "SpellShapeshiftForm.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sStableSlotPricesStore,       dbcPath, "StableSlotPrices.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sSummonPropertiesStore,       dbcPath, "SummonProperties.dbc");
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTalentStore,                 dbcPath, "Talent.dbc");
-
     // Create Spelldifficulty searcher
     for (uint32 i = 0; i < sSpellDifficultyStore.GetNumRows(); ++i)
     {
@@ -545,8 +621,6 @@ void LoadDBCStores(const std::string& dataPath)
                 sTalentSpellPosMap[talentInfo->RankID[j]] = TalentSpellPos(i, j);
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTalentTabStore,              dbcPath, "TalentTab.dbc");
-
     // prepare fast data access to bit pos of talent ranks for use at inspecting
     {
         // now have all max ranks (and then bit amount used for store talent ranks in inspect)
@@ -567,15 +641,12 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTaxiNodesStore,              dbcPath, "TaxiNodes.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTaxiPathStore,               dbcPath, "TaxiPath.dbc");
     for (uint32 i = 1; i < sTaxiPathStore.GetNumRows(); ++i)
         if (TaxiPathEntry const* entry = sTaxiPathStore.LookupEntry(i))
             sTaxiPathSetBySource[entry->from][entry->to] = TaxiPathBySourceAndDestination(entry->ID, entry->price);
     uint32 pathCount = sTaxiPathStore.GetNumRows();
 
     //## TaxiPathNode.dbc ## Loaded only for initialization different structures
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTaxiPathNodeStore,           dbcPath, "TaxiPathNode.dbc");
     // Calculate path nodes count
     std::vector<uint32> pathLength;
     pathLength.resize(pathCount);                           // 0 and some other indexes not used
@@ -655,9 +726,6 @@ void LoadDBCStores(const std::string& dataPath)
         }
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTeamContributionPointsStore, dbcPath, "TeamContributionPoints.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTotemCategoryStore,          dbcPath, "TotemCategory.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTransportAnimationStore,     dbcPath, "TransportAnimation.dbc");
     for (uint32 i = 0; i < sTransportAnimationStore.GetNumRows(); ++i)
     {
         TransportAnimationEntry const* anim = sTransportAnimationStore.LookupEntry(i);
@@ -667,7 +735,6 @@ void LoadDBCStores(const std::string& dataPath)
         sTransportMgr->AddPathNodeToTransport(anim->TransportEntry, anim->TimeSeg, anim);
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sTransportRotationStore,     dbcPath, "TransportRotation.dbc");
     for (uint32 i = 0; i < sTransportRotationStore.GetNumRows(); ++i)
     {
         TransportRotationEntry const* rot = sTransportRotationStore.LookupEntry(i);
@@ -677,16 +744,9 @@ void LoadDBCStores(const std::string& dataPath)
         sTransportMgr->AddPathRotationToTransport(rot->TransportEntry, rot->TimeSeg, rot);
     }
 
-    LoadDBC(availableDbcLocales, bad_dbc_files, sVehicleStore,                dbcPath, "Vehicle.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sVehicleSeatStore,            dbcPath, "VehicleSeat.dbc");
-
-    LoadDBC(availableDbcLocales, bad_dbc_files, sWMOAreaTableStore,           dbcPath, "WMOAreaTable.dbc");
     for (uint32 i = 0; i < sWMOAreaTableStore.GetNumRows(); ++i)
         if (WMOAreaTableEntry const* entry = sWMOAreaTableStore.LookupEntry(i))
             sWMOAreaInfoByTripple.insert(WMOAreaInfoByTripple::value_type(WMOAreaTableTripple(entry->rootId, entry->adtId, entry->groupId), entry));
-    LoadDBC(availableDbcLocales, bad_dbc_files, sWorldMapAreaStore,           dbcPath, "WorldMapArea.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sWorldMapOverlayStore,        dbcPath, "WorldMapOverlay.dbc");
-    LoadDBC(availableDbcLocales, bad_dbc_files, sWorldSafeLocsStore,          dbcPath, "WorldSafeLocs.dbc");
 
     // error checks
     if (bad_dbc_files.size() >= DBCFileCount)
@@ -697,7 +757,7 @@ void LoadDBCStores(const std::string& dataPath)
     else if (!bad_dbc_files.empty())
     {
         std::string str;
-        for (StoreProblemList::iterator i = bad_dbc_files.begin(); i != bad_dbc_files.end(); ++i)
+        for (StoreProblemList::const_iterator i = bad_dbc_files.begin(); i != bad_dbc_files.end(); ++i)
             str += *i + "\n";
 
         TC_LOG_ERROR("misc", "Some required *.dbc files (%u from %d) not found or not compatible:\n%s", (uint32)bad_dbc_files.size(), DBCFileCount, str.c_str());
@@ -717,7 +777,24 @@ void LoadDBCStores(const std::string& dataPath)
         exit(1);
     }
 
-    TC_LOG_INFO("server.loading", ">> Initialized %d data stores in %u ms", DBCFileCount, GetMSTimeDiffToNow(oldMSTime));
+    // slowest stores first
+    std::vector<DBCStoreLoadInfo> loadInfo = loader.GetLoadInfo();
+    std::sort(loadInfo.begin(), loadInfo.end(), [](DBCStoreLoadInfo const& left, DBCStoreLoadInfo const& right) { return left.LoadTime > right.LoadTime; });
+
+    uint32 inPlaceStores = 0;
+    size_t allocatedSize = 0;
+    for (DBCStoreLoadInfo const& info : loadInfo)
+    {
+        TC_LOG_DEBUG("server.loading", "%-36s %6u rows %8u us %10u bytes%s", info.Filename.c_str(), info.Rows, info.LoadTime,
+            uint32(info.AllocatedSize), info.InPlace ? " (in place)" : "");
+
+        if (info.InPlace)
+            ++inPlaceStores;
+        allocatedSize += info.AllocatedSize;
+    }
+
+    TC_LOG_INFO("server.loading", ">> Initialized %d data stores in %u ms (%u used in place from mapped files, %u KB allocated)", DBCFileCount, GetMSTimeDiffToNow(oldMSTime),
+        inPlaceStores, uint32(allocatedSize / 1024));
 
 }
 
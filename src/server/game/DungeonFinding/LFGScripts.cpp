@@ -32,7 +32,10 @@
 namespace lfg
 {
 
-LFGPlayerScript::LFGPlayerScript() : PlayerScript("LFGPlayerScript") { }
+LFGPlayerScript::LFGPlayerScript() : PlayerScript("LFGPlayerScript")
+{
+    RegisterHooks({ "OnPlayerLogout", "OnPlayerLogin", "OnPlayerMapChanged" });
+}
 
 void LFGPlayerScript::OnLogout(Player* player)
 {
@@ -114,7 +117,10 @@ void LFGPlayerScript::OnMapChanged(Player* player)
     }
 }
 
-LFGGroupScript::LFGGroupScript() : GroupScript("LFGGroupScript") { }
+LFGGroupScript::LFGGroupScript() : GroupScript("LFGGroupScript")
+{
+    RegisterHooks({ "OnGroupAddMember", "OnGroupRemoveMember", "OnGroupDisband", "OnGroupChangeLeader", "OnGroupInviteMember" });
+}
 
 void LFGGroupScript::OnAddMember(Group* group, ObjectGuid guid)
 {
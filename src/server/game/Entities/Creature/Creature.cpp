@@ -180,7 +180,7 @@ bool ForcedDespawnDelayEvent::Execute(uint64 /*e_time*/, uint32 /*p_time*/)
 Creature::Creature(bool isWorldObject): Unit(isWorldObject), MapObject(),
 m_groupLootTimer(0), lootingGroupLowGUID(0), m_PlayerDamageReq(0),
 m_lootRecipient(), m_lootRecipientGroup(0), _skinner(), _pickpocketLootRestore(0), m_corpseRemoveTime(0), m_respawnTime(0),
-m_respawnDelay(300), m_corpseDelay(60), m_respawnradius(0.0f), m_boundaryCheckTime(2500), m_combatPulseTime(0), m_combatPulseDelay(0), m_reactState(REACT_AGGRESSIVE),
+m_respawnScheduledTime(0), m_respawnScheduled(false), m_respawnDelay(300), m_corpseDelay(60), m_respawnradius(0.0f), m_boundaryCheckTime(2500), m_combatPulseTime(0), m_combatPulseDelay(0), m_reactState(REACT_AGGRESSIVE),
 m_defaultMovementType(IDLE_MOTION_TYPE), m_spawnId(0), m_equipmentId(0), m_originalEquipmentId(0), m_AlreadyCallAssistance(false),
 m_AlreadySearchedAssistance(false), m_regenHealth(true), m_AI_locked(false), m_meleeDamageSchoolMask(SPELL_SCHOOL_MASK_NORMAL),
 m_originalEntry(0), m_homePosition(), m_transportHomePosition(), m_creatureInfo(nullptr), m_creatureData(nullptr), m_waypointID(0), m_path_id(0), m_formation(nullptr), m_focusSpell(nullptr), m_focusDelay(0)
@@ -247,6 +247,13 @@ void Creature::RemoveFromWorld()
         if (m_spawnId)
             Trinity::Containers::MultimapErasePair(GetMap()->GetCreatureBySpawnIdStore(), m_spawnId, this);
 
+        // creatures loaded again with their grid queue their respawn anew
+        if (m_respawnScheduled)
+        {
+            GetMap()->RemoveFromRespawnQueue(this, m_respawnScheduledTime);
+            m_respawnScheduled = false;
+        }
+
         TC_LOG_DEBUG("entities.unit", "Removing creature %u with entry %u and DBGUID %u to world in map %u", GetGUID().GetCounter(), GetEntry(), m_spawnId, GetMap()->GetId());
         GetMap()->GetObjectsStore().Remove<Creature>(GetGUID());
     }
@@ -294,6 +301,9 @@ void Creature::RemoveCorpse(bool setSpawnTime)
     if (setSpawnTime)
         m_respawnTime = time(NULL) + respawnDelay;
 
+    // respawn time may have changed since setDeathState(DEAD) queued it
+    ScheduleRespawn();
+
     float x, y, z, o;
     GetRespawnPosition(x, y, z, &o);
     SetHomePosition(x, y, z, o);
@@ -496,6 +506,10 @@ void Creature::Update(uint32 diff)
             m_vehicleKit->Reset();
     }
 
+    // woken by the map respawn queue
+    if (m_respawnScheduled)
+        return;
+
     UpdateMovementFlags();
 
     switch (m_deathState)
@@ -510,27 +524,11 @@ void Creature::Update(uint32 diff)
             break;
         case DEAD:
         {
-            time_t now = time(NULL);
-            if (m_respawnTime <= now)
-            {
-                bool allowed = IsAIEnabled ? AI()->CanRespawn() : true;     // First check if there are any scripts that object to us respawning
-                if (!allowed)                                               // Will be rechecked on next Update call
-                    break;
-
-                ObjectGuid dbtableHighGuid(HighGuid::Unit, GetEntry(), m_spawnId);
-                time_t linkedRespawntime = GetMap()->GetLinkedRespawnTime(dbtableHighGuid);
-                if (!linkedRespawntime)             // Can respawn
-                    Respawn();
-                else                                // the master is dead
-                {
-                    ObjectGuid targetGuid = sObjectMgr->GetLinkedRespawnGuid(dbtableHighGuid);
-                    if (targetGuid == dbtableHighGuid) // if linking self, never respawn (check delayed to next day)
-                        SetRespawnTime(DAY);
-                    else
-                        m_respawnTime = (now > linkedRespawntime ? now : linkedRespawntime) + urand(5, MINUTE); // else copy time from master and add a little
-                    SaveRespawnTime(); // also save to DB immediately
-                }
-            }
+            // summons are not queued and still poll their respawn time
+            GetMap()->CountPolledRespawn();
+
+            if (m_respawnTime <= time(NULL))
+                RespawnIfAllowed();                                         // Will be rechecked on next Update call if not allowed
             break;
         }
         case CORPSE:
@@ -1350,9 +1348,10 @@ bool Creature::LoadCreatureFromDB(ObjectGuid::LowType spawnId, Map* map, bool ad
     m_deathState = ALIVE;
 
     m_respawnTime  = GetMap()->GetCreatureRespawnTime(m_spawnId);
-    if (m_respawnTime)                          // respawn on Update
+    if (m_respawnTime)                          // respawn from the map respawn queue
     {
         m_deathState = DEAD;
+        ScheduleRespawn();
         if (CanFly())
         {
             float tz = map->GetHeight(GetPhaseMask(), data->posX, data->posY, data->posZ, true, MAX_FALL_DISTANCE);
@@ -1597,6 +1596,11 @@ void Creature::setDeathState(DeathState s)
 {
     Unit::setDeathState(s);
 
+    if (s == DEAD)
+        ScheduleRespawn();
+    else
+        m_respawnScheduled = false;
+
     if (s == JUST_DIED)
     {
         m_corpseRemoveTime = time(NULL) + m_corpseDelay;
@@ -1668,6 +1672,73 @@ void Creature::setDeathState(DeathState s)
     }
 }
 
+void Creature::SetRespawnTime(uint32 respawn)
+{
+    m_respawnTime = respawn ? time(NULL) + respawn : 0;
+
+    if (m_deathState == DEAD)
+        ScheduleRespawn();
+}
+
+void Creature::ScheduleRespawn()
+{
+    // summons have their own despawn handling in TempSummon::Update
+    if (!m_spawnId || m_deathState != DEAD)
+        return;
+
+    if (m_respawnScheduled)
+    {
+        if (m_respawnScheduledTime == m_respawnTime)
+            return;
+
+        GetMap()->RemoveFromRespawnQueue(this, m_respawnScheduledTime);
+    }
+
+    m_respawnScheduled = true;
+    m_respawnScheduledTime = m_respawnTime;
+    GetMap()->AddToRespawnQueue(this, m_respawnTime);
+}
+
+void Creature::HandleScheduledRespawn()
+{
+    m_respawnScheduled = false;
+
+    if (m_respawnTime > time(NULL))
+    {
+        ScheduleRespawn();
+        return;
+    }
+
+    // rechecked at next map update if not allowed
+    if (!RespawnIfAllowed())
+        ScheduleRespawn();
+}
+
+bool Creature::RespawnIfAllowed()
+{
+    // First check if there are any scripts that object to us respawning
+    if (IsAIEnabled && !AI()->CanRespawn())
+        return false;
+
+    ObjectGuid dbtableHighGuid(HighGuid::Unit, GetEntry(), m_spawnId);
+    time_t linkedRespawntime = GetMap()->GetLinkedRespawnTime(dbtableHighGuid);
+    if (!linkedRespawntime)             // Can respawn
+        Respawn();
+    else                                // the master is dead
+    {
+        time_t now = time(NULL);
+        ObjectGuid targetGuid = sObjectMgr->GetLinkedRespawnGuid(dbtableHighGuid);
+        if (targetGuid == dbtableHighGuid) // if linking self, never respawn (check delayed to next day)
+            SetRespawnTime(DAY);
+        else
+            m_respawnTime = (now > linkedRespawntime ? now : linkedRespawntime) + urand(5, MINUTE); // else copy time from master and add a little
+        SaveRespawnTime(); // also save to DB immediately
+        ScheduleRespawn();
+    }
+
+    return true;
+}
+
 void Creature::Respawn(bool force)
 {
     DestroyForNearbyPlayers();
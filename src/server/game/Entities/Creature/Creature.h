@@ -597,8 +597,15 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
 
         time_t const& GetRespawnTime() const { return m_respawnTime; }
         time_t GetRespawnTimeEx() const;
-        void SetRespawnTime(uint32 respawn) { m_respawnTime = respawn ? time(NULL) + respawn : 0; }
+        void SetRespawnTime(uint32 respawn);
         void Respawn(bool force = false);
+        // dead spawns wait in the map respawn queue instead of being updated
+        void ScheduleRespawn();
+        bool IsRespawnScheduled() const { return m_respawnScheduled; }
+        time_t GetScheduledRespawnTime() const { return m_respawnScheduledTime; }
+        void HandleScheduledRespawn();
+        // respawns now unless a script objects or the linked master is dead, false if a script objects
+        bool RespawnIfAllowed();
         void SaveRespawnTime() override;
 
         uint32 GetRespawnDelay() const { return m_respawnDelay; }
@@ -699,6 +706,8 @@ class TC_GAME_API Creature : public Unit, public GridObject<Creature>, public Ma
         time_t _pickpocketLootRestore;
         time_t m_corpseRemoveTime;                          // (msecs)timer for death or corpse disappearance
         time_t m_respawnTime;                               // (secs) time of next respawn
+        time_t m_respawnScheduledTime;                      // (secs) m_respawnTime when queued in the map respawn queue
+        bool m_respawnScheduled;
         uint32 m_respawnDelay;                              // (secs) delay between corpse disappearance and respawning
         uint32 m_corpseDelay;                               // (secs) delay between death and corpse disappearance
         float m_respawnradius;
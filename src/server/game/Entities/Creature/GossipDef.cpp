@@ -21,6 +21,7 @@
 #include "ObjectMgr.h"
 #include "WorldSession.h"
 #include "Formulas.h"
+#include "QueryResponseCache.h"
 
 GossipMenu::GossipMenu()
 {
@@ -489,6 +490,9 @@ void PlayerMenu::SendQuestGiverQuestDetails(Quest const* quest, ObjectGuid npcGU
 
 void PlayerMenu::SendQuestQueryResponse(Quest const* quest) const
 {
+    if (_session->SendCachedQueryResponse(QUERY_RESPONSE_QUEST, quest->GetQuestId()))
+        return;
+
     std::string questTitle            = quest->GetTitle();
     std::string questDetails          = quest->GetDetails();
     std::string questObjectives       = quest->GetObjectives();
@@ -621,6 +625,7 @@ void PlayerMenu::SendQuestQueryResponse(Quest const* quest) const
         data << questObjectiveText[i];
 
     _session->SendPacket(&data);
+    sQueryResponseCache->Store(QUERY_RESPONSE_QUEST, quest->GetQuestId(), _session->GetSessionDbLocaleIndex(), data);
     TC_LOG_DEBUG("network", "WORLD: Sent SMSG_QUEST_QUERY_RESPONSE questid=%u", quest->GetQuestId());
 }
 
@@ -2137,6 +2137,10 @@ void GameObject::EnableCollision(bool enable)
         GetMap()->InsertGameObjectModel(*m_model);*/
 
     m_model->enable(enable ? GetPhaseMask() : 0);
+
+    // doors opening or closing change what can be seen through them
+    if (IsInWorld())
+        GetMap()->InvalidateLineOfSightCache(m_model->getBounds());
 }
 
 void GameObject::UpdateModel()
@@ -2096,6 +2096,10 @@ class TC_GAME_API Player : public Unit, public GridObject<Player>
 
         // currently visible objects at player client
         GuidUnorderedSet m_clientGUIDs;
+        // point of view position of the last full visibility update
+        Position m_visibilityUpdatePosition;
+        // point of view position of the last visibility update of any kind
+        Position m_visibilityNotifyPosition;
 
         bool HaveAtClient(Object const* u) const;
 
@@ -27,7 +27,7 @@
 #include "Util.h"
 #include "AccountMgr.h"
 
-PlayerSocial::PlayerSocial(): m_playerGUID()
+PlayerSocial::PlayerSocial(): m_playerGUID(), m_ignoreCount(0)
 { }
 
 uint32 PlayerSocial::GetNumberOfSocialsWithFlag(SocialFlag flag)
@@ -85,6 +85,9 @@ bool PlayerSocial::AddToSocialList(ObjectGuid::LowType friendGuid, bool ignore)
         fi.Flags |= flag;
         m_playerSocialMap[friendGuid] = fi;
     }
+
+    if (ignore)
+        UpdateIgnoreCount();
     return true;
 }
 
@@ -120,6 +123,9 @@ void PlayerSocial::RemoveFromSocialList(ObjectGuid::LowType friendGuid, bool ign
 
         CharacterDatabase.Execute(stmt);
     }
+
+    if (ignore)
+        UpdateIgnoreCount();
 }
 
 void PlayerSocial::SetFriendNote(ObjectGuid::LowType friendGuid, std::string note)
@@ -344,5 +350,6 @@ PlayerSocial* SocialMgr::LoadFromDB(PreparedQueryResult result, ObjectGuid::LowT
     }
     while (result->NextRow());
 
+    social->UpdateIgnoreCount();
     return social;
 }
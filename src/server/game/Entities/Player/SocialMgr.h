@@ -113,12 +113,17 @@ class TC_GAME_API PlayerSocial
         // Misc
         bool HasFriend(ObjectGuid::LowType friend_guid);
         bool HasIgnore(ObjectGuid::LowType ignore_guid);
+        /// Lets broadcasts skip the ignore lookup for the many players that ignore nobody
+        bool HasIgnores() const { return m_ignoreCount != 0; }
         ObjectGuid::LowType GetPlayerGUID() const { return m_playerGUID; }
         void SetPlayerGUID(ObjectGuid::LowType guid) { m_playerGUID = guid; }
         uint32 GetNumberOfSocialsWithFlag(SocialFlag flag);
     private:
+        void UpdateIgnoreCount() { m_ignoreCount = GetNumberOfSocialsWithFlag(SOCIAL_FLAG_IGNORED); }
+
         PlayerSocialMap m_playerSocialMap;
         ObjectGuid::LowType m_playerGUID;
+        uint32 m_ignoreCount;
 };
 
 class SocialMgr
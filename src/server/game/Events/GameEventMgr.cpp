@@ -1189,16 +1189,11 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
         {
             sObjectMgr->AddCreatureToGrid(*itr, data);
 
-            // Spawn if necessary (loaded grids only)
+            // Spawn if necessary (loaded grids only), the map does it in its own update
             Map* map = sMapMgr->CreateBaseMap(data->mapid);
             // We use spawn coords to spawn
             if (!map->Instanceable() && map->IsGridLoaded(data->posX, data->posY))
-            {
-                Creature* creature = new Creature();
-                //TC_LOG_DEBUG("misc", "Spawning creature %u", *itr);
-                if (!creature->LoadCreatureFromDB(*itr, map))
-                    delete creature;
-            }
+                map->AddGameEventSpawn(TYPEID_UNIT, *itr, true);
         }
     }
 
@@ -1215,23 +1210,11 @@ void GameEventMgr::GameEventSpawn(int16 event_id)
         if (GameObjectData const* data = sObjectMgr->GetGOData(*itr))
         {
             sObjectMgr->AddGameobjectToGrid(*itr, data);
-            // Spawn if necessary (loaded grids only)
+            // Spawn if necessary (loaded grids only), the map does it in its own update
             // this base map checked as non-instanced and then only existed
             Map* map = sMapMgr->CreateBaseMap(data->mapid);
-            // We use current coords to unspawn, not spawn coords since creature can have changed grid
             if (!map->Instanceable() && map->IsGridLoaded(data->posX, data->posY))
-            {
-                GameObject* pGameobject = new GameObject;
-                //TC_LOG_DEBUG("misc", "Spawning gameobject %u", *itr);
-                /// @todo find out when it is add to map
-                if (!pGameobject->LoadGameObjectFromDB(*itr, map, false))
-                    delete pGameobject;
-                else
-                {
-                    if (pGameobject->isSpawnedByDefault())
-                        map->AddToMap(pGameobject);
-                }
-            }
+                map->AddGameEventSpawn(TYPEID_GAMEOBJECT, *itr, true);
         }
     }
 
@@ -1269,13 +1252,8 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
 
             sMapMgr->DoForAllMapsWithMapId(data->mapid, [&itr](Map* map)
             {
-                auto creatureBounds = map->GetCreatureBySpawnIdStore().equal_range(*itr);
-                for (auto itr2 = creatureBounds.first; itr2 != creatureBounds.second;)
-                {
-                    Creature* creature = itr2->second;
-                    ++itr2;
-                    creature->AddObjectToRemoveList();
-                }
+                if (map->GetCreatureBySpawnIdStore().count(*itr))
+                    map->AddGameEventSpawn(TYPEID_UNIT, *itr, false);
             });
         }
     }
@@ -1299,13 +1277,8 @@ void GameEventMgr::GameEventUnspawn(int16 event_id)
 
             sMapMgr->DoForAllMapsWithMapId(data->mapid, [&itr](Map* map)
             {
-                auto gameobjectBounds = map->GetGameObjectBySpawnIdStore().equal_range(*itr);
-                for (auto itr2 = gameobjectBounds.first; itr2 != gameobjectBounds.second;)
-                {
-                    GameObject* go = itr2->second;
-                    ++itr2;
-                    go->AddObjectToRemoveList();
-                }
+                if (map->GetGameObjectBySpawnIdStore().count(*itr))
+                    map->AddGameEventSpawn(TYPEID_GAMEOBJECT, *itr, false);
             });
         }
     }
@@ -36,6 +36,7 @@
 #include "Object.h"
 #include "ObjectMgr.h"
 #include "PoolMgr.h"
+#include "QueryResponseCache.h"
 #include "ReputationMgr.h"
 #include "ScriptMgr.h"
 #include "SpellAuras.h"
@@ -225,6 +226,8 @@ ObjectMgr::ObjectMgr():
     _hiPetNumber(1),
     _creatureSpawnId(1),
     _gameObjectSpawnId(1),
+    _mailExpiryTime(0),
+    _mailExpiryLastChunk(true),
     DBCLocaleIndex(LOCALE_enUS)
 {
     for (uint8 i = 0; i < MAX_CLASSES; ++i)
@@ -295,6 +298,7 @@ void ObjectMgr::LoadCreatureLocales()
 {
     uint32 oldMSTime = getMSTime();
 
+    sQueryResponseCache->Invalidate(QUERY_RESPONSE_CREATURE);
     _creatureLocaleStore.clear();                              // need for reload case
 
     //                                               0      1       2     3
@@ -1678,7 +1682,7 @@ void ObjectMgr::LoadCreatures()
     uint32 oldMSTime = getMSTime();
 
     //                                               0              1   2    3        4             5           6           7           8            9              10
-    QueryResult result = WorldDatabase.Query("SELECT creature.guid, id, map, modelid, equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, spawndist, "
+    BulkQueryResult result = WorldDatabase.BulkQuery("SELECT creature.guid, id, map, modelid, equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, spawndist, "
     //   11               12         13       14            15         16         17          18          19                20                   21
         "currentwaypoint, curhealth, curmana, MovementType, spawnMask, phaseMask, eventEntry, pool_entry, creature.npcflag, creature.unit_flags, creature.dynamicflags "
         "FROM creature "
@@ -1699,8 +1703,6 @@ void ObjectMgr::LoadCreatures()
                 if (GetMapDifficultyData(i, Difficulty(k)))
                     spawnMasks[i] |= (1 << k);
 
-    _creatureDataStore.rehash(result->GetRowCount());
-
     do
     {
         Field* fields = result->Fetch();
@@ -1973,7 +1975,7 @@ void ObjectMgr::LoadGameobjects()
     uint32 oldMSTime = getMSTime();
 
     //                                                0                1   2    3           4           5           6
-    QueryResult result = WorldDatabase.Query("SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
+    BulkQueryResult result = WorldDatabase.BulkQuery("SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
     //   7          8          9          10         11             12            13     14         15         16          17
         "rotation0, rotation1, rotation2, rotation3, spawntimesecs, animprogress, state, spawnMask, phaseMask, eventEntry, pool_entry "
         "FROM gameobject LEFT OUTER JOIN game_event_gameobject ON gameobject.guid = game_event_gameobject.guid "
@@ -1993,8 +1995,6 @@ void ObjectMgr::LoadGameobjects()
                 if (GetMapDifficultyData(i, Difficulty(k)))
                     spawnMasks[i] |= (1 << k);
 
-    _gameObjectDataStore.rehash(result->GetRowCount());
-
     do
     {
         Field* fields = result->Fetch();
@@ -2164,16 +2164,7 @@ Player* ObjectMgr::GetPlayerByLowGUID(ObjectGuid::LowType lowguid) const
 // name must be checked to correctness (if received) before call this function
 ObjectGuid ObjectMgr::GetPlayerGUIDByName(std::string const& name) const
 {
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUID_BY_NAME);
-
-    stmt->setString(0, name);
-
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-    if (result)
-        return ObjectGuid(HighGuid::Player, (*result)[0].GetUInt32());
-
-    return ObjectGuid::Empty;
+    return sWorld->GetCharacterGuidByName(name);
 }
 
 bool ObjectMgr::GetPlayerNameByGUID(ObjectGuid guid, std::string& name) const
@@ -2208,17 +2199,8 @@ uint32 ObjectMgr::GetPlayerTeamByGUID(ObjectGuid guid) const
         return Player::TeamForRace(player->getRace());
     }
 
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_RACE);
-
-    stmt->setUInt32(0, guid.GetCounter());
-
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-    if (result)
-    {
-        uint8 race = (*result)[0].GetUInt8();
-        return Player::TeamForRace(race);
-    }
+    if (CharacterInfo const* characterInfo = sWorld->GetCharacterInfo(guid))
+        return Player::TeamForRace(characterInfo->Race);
 
     return 0;
 }
@@ -2254,6 +2236,7 @@ void ObjectMgr::LoadItemLocales()
 {
     uint32 oldMSTime = getMSTime();
 
+    sQueryResponseCache->Invalidate(QUERY_RESPONSE_ITEM);
     _itemLocaleStore.clear();                                 // need for reload case
 
     QueryResult result = WorldDatabase.Query("SELECT entry, name_loc1, description_loc1, name_loc2, description_loc2, name_loc3, description_loc3, name_loc4, description_loc4, name_loc5, description_loc5, name_loc6, description_loc6, name_loc7, description_loc7, name_loc8, description_loc8 FROM locales_item");
@@ -3930,6 +3913,8 @@ void ObjectMgr::LoadQuests()
 {
     uint32 oldMSTime = getMSTime();
 
+    sQueryResponseCache->Invalidate(QUERY_RESPONSE_QUEST);
+
     // For reload case
     for (QuestMap::const_iterator itr=_questTemplates.begin(); itr != _questTemplates.end(); ++itr)
         delete itr->second;
@@ -4659,6 +4644,7 @@ void ObjectMgr::LoadQuestLocales()
 {
     uint32 oldMSTime = getMSTime();
 
+    sQueryResponseCache->Invalidate(QUERY_RESPONSE_QUEST);
     _questLocaleStore.clear();                                // need for reload case
 
     QueryResult result = WorldDatabase.Query("SELECT Id, "
@@ -5241,6 +5227,8 @@ void ObjectMgr::LoadPageTexts()
 {
     uint32 oldMSTime = getMSTime();
 
+    sQueryResponseCache->Invalidate(QUERY_RESPONSE_PAGE_TEXT);
+
     //                                               0     1       2
     QueryResult result = WorldDatabase.Query("SELECT ID, Text, NextPageID FROM page_text");
 
@@ -5291,6 +5279,7 @@ void ObjectMgr::LoadPageTextLocales()
 {
     uint32 oldMSTime = getMSTime();
 
+    sQueryResponseCache->Invalidate(QUERY_RESPONSE_PAGE_TEXT);
     _pageTextLocaleStore.clear();                             // need for reload case
 
     QueryResult result = WorldDatabase.Query("SELECT entry, text_loc1, text_loc2, text_loc3, text_loc4, text_loc5, text_loc6, text_loc7, text_loc8 FROM locales_page_text");
@@ -5568,6 +5557,96 @@ void ObjectMgr::LoadNpcTextLocales()
     TC_LOG_INFO("server.loading", ">> Loaded %u NpcText locale strings in %u ms", uint32(_npcTextLocaleStore.size()), GetMSTimeDiffToNow(oldMSTime));
 }
 
+void ObjectMgr::ReadExpiredMail(Field* fields, ExpiredMail& mail)
+{
+    mail.MessageId   = fields[0].GetUInt32();
+    mail.MessageType = fields[1].GetUInt8();
+    mail.Sender      = fields[2].GetUInt32();
+    mail.Receiver    = fields[3].GetUInt32();
+    mail.HasItems    = fields[4].GetBool();
+    mail.Checked     = fields[7].GetUInt8();
+}
+
+void ObjectMgr::ReturnOrDeleteOldMail(ExpiredMail& mail, uint64 basetime, bool serverUp, MailExpiryProgress& progress)
+{
+    if (serverUp)
+    {
+        // this code will run very improbably (the time is between 4 and 5 am, in game is online a player, who has old mail
+        // his in mailbox and he has already listed his mails)
+        Player* player = ObjectAccessor::FindConnectedPlayer(ObjectGuid(HighGuid::Player, mail.Receiver));
+        if (player && player->m_mailsLoaded)
+        {
+            ++progress.Skipped;
+            return;
+        }
+    }
+
+    // The receiver may have taken items or money, or read the mail, since it was fetched. Every
+    // statement is limited to the mail while it is still expired and its items still attached to it,
+    // so a mail changed in between is left alone. Items go first, the mail update ends the expiry.
+    SQLTransaction trans = CharacterDatabase.BeginTransaction();
+    PreparedStatement* stmt = NULL;
+
+    // Delete or return mail
+    if (mail.HasItems)
+    {
+        // if it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
+        if (mail.MessageType != MAIL_NORMAL || (mail.Checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
+        {
+            // mail open and then not returned
+            for (MailItemInfoVec::iterator itr = mail.Items.begin(); itr != mail.Items.end(); ++itr)
+            {
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EXPIRED_MAIL_ITEM_INSTANCE);
+                stmt->setUInt32(0, itr->item_guid);
+                stmt->setUInt32(1, mail.MessageId);
+                stmt->setUInt64(2, basetime);
+                trans->Append(stmt);
+            }
+        }
+        else
+        {
+            // Mail will be returned
+            for (MailItemInfoVec::iterator itr = mail.Items.begin(); itr != mail.Items.end(); ++itr)
+            {
+                // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_EXPIRED_MAIL_ITEM_RECEIVER);
+                stmt->setUInt32(0, mail.Sender);
+                stmt->setUInt32(1, itr->item_guid);
+                stmt->setUInt32(2, mail.MessageId);
+                stmt->setUInt64(3, basetime);
+                trans->Append(stmt);
+
+                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_EXPIRED_MAIL_ITEM_OWNER);
+                stmt->setUInt32(0, mail.Sender);
+                stmt->setUInt32(1, itr->item_guid);
+                stmt->setUInt32(2, mail.MessageId);
+                stmt->setUInt64(3, basetime);
+                trans->Append(stmt);
+            }
+
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_RETURNED);
+            stmt->setUInt32(0, mail.Receiver);
+            stmt->setUInt32(1, mail.Sender);
+            stmt->setUInt32(2, basetime + 30 * DAY);
+            stmt->setUInt32(3, basetime);
+            stmt->setUInt8 (4, uint8(MAIL_CHECK_MASK_RETURNED));
+            stmt->setUInt32(5, mail.MessageId);
+            stmt->setUInt64(6, basetime);
+            trans->Append(stmt);
+            CharacterDatabase.CommitTransaction(trans);
+            ++progress.Returned;
+            return;
+        }
+    }
+
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EXPIRED_MAIL_BY_ID);
+    stmt->setUInt32(0, mail.MessageId);
+    stmt->setUInt64(1, basetime);
+    trans->Append(stmt);
+    CharacterDatabase.CommitTransaction(trans);
+    ++progress.Deleted;
+}
+
 //not very fast function but it is called only once a day, or on starting-up
 void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
 {
@@ -5579,14 +5658,30 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
     uint64 basetime(curTime);
     TC_LOG_INFO("misc", "Returning mails current time: hour: %d, minute: %d, second: %d ", lt.tm_hour, lt.tm_min, lt.tm_sec);
 
-    // Delete all old mails without item and without body immediately, if starting server
-    if (!serverUp)
+    // While the server is up the mails are paged through by id and applied in UpdateExpiredMails, a few per world update
+    if (serverUp)
     {
-        PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EMPTY_EXPIRED_MAIL);
-        stmt->setUInt64(0, basetime);
-        CharacterDatabase.Execute(stmt);
+        if (_mailExpiry.Running)
+        {
+            TC_LOG_INFO("misc", "Expired mail job started %u ms ago is still running, last mail id %u", GetMSTimeDiffToNow(_mailExpiry.StartTime), _mailExpiry.LastMailId);
+            return;
+        }
+
+        _mailExpiry = MailExpiryProgress();
+        _mailExpiry.Running = true;
+        _mailExpiry.StartTime = oldMSTime;
+        _mailExpiryTime = basetime;
+        _mailExpiryLastChunk = false;
+        QueryExpiredMailChunk();
+        return;
     }
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL);
+
+    // Delete all old mails without item and without body immediately, if starting server
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_EMPTY_EXPIRED_MAIL);
+    stmt->setUInt64(0, basetime);
+    CharacterDatabase.Execute(stmt);
+
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL);
     stmt->setUInt64(0, basetime);
     PreparedQueryResult result = CharacterDatabase.Query(stmt);
     if (!result)
@@ -5611,90 +5706,120 @@ void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
         } while (items->NextRow());
     }
 
-    uint32 deletedCount = 0;
-    uint32 returnedCount = 0;
+    MailExpiryProgress progress;
     do
     {
-        Field* fields = result->Fetch();
-        Mail* m = new Mail;
-        m->messageID      = fields[0].GetUInt32();
-        m->messageType    = fields[1].GetUInt8();
-        m->sender         = fields[2].GetUInt32();
-        m->receiver       = fields[3].GetUInt32();
-        bool has_items    = fields[4].GetBool();
-        m->expire_time    = time_t(fields[5].GetUInt32());
-        m->deliver_time   = 0;
-        m->COD            = fields[6].GetUInt32();
-        m->checked        = fields[7].GetUInt8();
-        m->mailTemplateId = fields[8].GetInt16();
-
-        Player* player = NULL;
-        if (serverUp)
-            player = ObjectAccessor::FindConnectedPlayer(ObjectGuid(HighGuid::Player, m->receiver));
+        ExpiredMail mail;
+        ReadExpiredMail(result->Fetch(), mail);
+        if (mail.HasItems)
+            mail.Items.swap(itemsCache[mail.MessageId]);    // read items from cache
 
-        if (player && player->m_mailsLoaded)
-        {                                                   // this code will run very improbably (the time is between 4 and 5 am, in game is online a player, who has old mail
-            // his in mailbox and he has already listed his mails)
-            delete m;
-            continue;
-        }
+        ReturnOrDeleteOldMail(mail, basetime, false, progress);
+    }
+    while (result->NextRow());
 
-        // Delete or return mail
-        if (has_items)
-        {
-            // read items from cache
-            m->items.swap(itemsCache[m->messageID]);
+    TC_LOG_INFO("server.loading", ">> Processed %u expired mails: %u deleted and %u returned in %u ms", progress.Deleted + progress.Returned, progress.Deleted, progress.Returned, GetMSTimeDiffToNow(oldMSTime));
+}
 
-            // if it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
-            if (m->messageType != MAIL_NORMAL || (m->checked & (MAIL_CHECK_MASK_COD_PAYMENT | MAIL_CHECK_MASK_RETURNED)))
-            {
-                // mail open and then not returned
-                for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
-                {
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_INSTANCE);
-                    stmt->setUInt32(0, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
-                }
-            }
-            else
+void ObjectMgr::QueryExpiredMailChunk()
+{
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_CHUNK);
+    stmt->setUInt64(0, _mailExpiryTime);
+    stmt->setUInt32(1, _mailExpiry.LastMailId);
+    stmt->setUInt32(2, sWorld->getIntConfig(CONFIG_MAIL_EXPIRY_CHUNK_SIZE));
+    _mailExpiryCallbacks.AddQuery(CharacterDatabase.AsyncQuery(stmt), std::bind(&ObjectMgr::HandleExpiredMailChunk, this, std::placeholders::_1));
+}
+
+void ObjectMgr::HandleExpiredMailChunk(PreparedQueryResult result)
+{
+    if (!result)
+    {
+        _mailExpiryLastChunk = true;
+        return;
+    }
+
+    ++_mailExpiry.Chunks;
+    _mailExpiryLastChunk = result->GetRowCount() < sWorld->getIntConfig(CONFIG_MAIL_EXPIRY_CHUNK_SIZE);
+
+    uint32 firstMailId = _mailExpiry.LastMailId;
+    std::shared_ptr<std::vector<ExpiredMail>> mails = std::make_shared<std::vector<ExpiredMail>>();
+    mails->reserve(result->GetRowCount());
+    bool hasItems = false;
+    do
+    {
+        ExpiredMail mail;
+        ReadExpiredMail(result->Fetch(), mail);
+        hasItems |= mail.HasItems;
+        mails->push_back(mail);
+    }
+    while (result->NextRow());
+
+    _mailExpiry.LastMailId = mails->back().MessageId;
+
+    if (!hasItems)
+    {
+        _expiredMails.insert(_expiredMails.end(), mails->begin(), mails->end());
+        return;
+    }
+
+    // items of the chunk are fetched by mail id range, the mails are queued for UpdateExpiredMails once they arrived
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS_RANGE);
+    stmt->setUInt64(0, _mailExpiryTime);
+    stmt->setUInt32(1, firstMailId);
+    stmt->setUInt32(2, _mailExpiry.LastMailId);
+    _mailExpiryCallbacks.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, mails](PreparedQueryResult items)
+    {
+        if (items)
+        {
+            std::unordered_map<uint32 /*messageId*/, MailItemInfoVec> itemsCache;
+            MailItemInfo item;
+            do
             {
-                // Mail will be returned
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_RETURNED);
-                stmt->setUInt32(0, m->receiver);
-                stmt->setUInt32(1, m->sender);
-                stmt->setUInt32(2, basetime + 30 * DAY);
-                stmt->setUInt32(3, basetime);
-                stmt->setUInt8 (4, uint8(MAIL_CHECK_MASK_RETURNED));
-                stmt->setUInt32(5, m->messageID);
-                CharacterDatabase.Execute(stmt);
-                for (MailItemInfoVec::iterator itr2 = m->items.begin(); itr2 != m->items.end(); ++itr2)
-                {
-                    // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_ITEM_RECEIVER);
-                    stmt->setUInt32(0, m->sender);
-                    stmt->setUInt32(1, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
-
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ITEM_OWNER);
-                    stmt->setUInt32(0, m->sender);
-                    stmt->setUInt32(1, itr2->item_guid);
-                    CharacterDatabase.Execute(stmt);
-                }
-                delete m;
-                ++returnedCount;
-                continue;
-            }
+                Field* fields = items->Fetch();
+                item.item_guid = fields[0].GetUInt32();
+                item.item_template = fields[1].GetUInt32();
+                itemsCache[fields[2].GetUInt32()].push_back(item);
+            } while (items->NextRow());
+
+            for (ExpiredMail& mail : *mails)
+                if (mail.HasItems)
+                    mail.Items.swap(itemsCache[mail.MessageId]);
         }
 
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
-        stmt->setUInt32(0, m->messageID);
-        CharacterDatabase.Execute(stmt);
-        delete m;
-        ++deletedCount;
+        _expiredMails.insert(_expiredMails.end(), mails->begin(), mails->end());
+    });
+}
+
+void ObjectMgr::UpdateExpiredMails()
+{
+    if (!_mailExpiry.Running)
+        return;
+
+    _mailExpiryCallbacks.ProcessReadyQueries();
+
+    // keep one chunk fetched ahead of the one being applied
+    uint32 chunkSize = sWorld->getIntConfig(CONFIG_MAIL_EXPIRY_CHUNK_SIZE);
+    if (!_mailExpiryLastChunk && !_mailExpiryCallbacks.HasPendingQueries() && _expiredMails.size() < chunkSize)
+        QueryExpiredMailChunk();
+
+    uint32 budget = sWorld->getIntConfig(CONFIG_MAIL_EXPIRY_UPDATE_BUDGET);
+    uint32 oldMSTime = getMSTime();
+    while (!_expiredMails.empty())
+    {
+        ReturnOrDeleteOldMail(_expiredMails.front(), _mailExpiryTime, true, _mailExpiry);
+        _expiredMails.pop_front();
+
+        if (budget && GetMSTimeDiffToNow(oldMSTime) >= budget)
+            break;
     }
-    while (result->NextRow());
 
-    TC_LOG_INFO("server.loading", ">> Processed %u expired mails: %u deleted and %u returned in %u ms", deletedCount + returnedCount, deletedCount, returnedCount, GetMSTimeDiffToNow(oldMSTime));
+    if (!_expiredMails.empty() || !_mailExpiryLastChunk || _mailExpiryCallbacks.HasPendingQueries())
+        return;
+
+    _mailExpiry.Running = false;
+    _mailExpiry.Duration = GetMSTimeDiffToNow(_mailExpiry.StartTime);
+    TC_LOG_INFO("misc", "Processed %u expired mails in %u chunks: %u deleted, %u returned and %u skipped in %u ms",
+        _mailExpiry.Deleted + _mailExpiry.Returned + _mailExpiry.Skipped, _mailExpiry.Chunks, _mailExpiry.Deleted, _mailExpiry.Returned, _mailExpiry.Skipped, _mailExpiry.Duration);
 }
 
 void ObjectMgr::LoadQuestAreaTriggers()
@@ -6540,6 +6665,7 @@ void ObjectMgr::LoadGameObjectLocales()
 {
     uint32 oldMSTime = getMSTime();
 
+    sQueryResponseCache->Invalidate(QUERY_RESPONSE_GAMEOBJECT);
     _gameObjectLocaleStore.clear(); // need for reload case
 
     //                                               0      1       2     3
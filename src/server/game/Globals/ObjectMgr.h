@@ -44,6 +44,7 @@
 #include <limits>
 #include <functional>
 #include <memory>
+#include <deque>
 
 class Item;
 struct AccessRequirement;
@@ -669,6 +670,21 @@ struct DungeonEncounter
 typedef std::list<DungeonEncounter const*> DungeonEncounterList;
 typedef std::unordered_map<uint32, DungeonEncounterList> DungeonEncounterContainer;
 
+/// Progress of the expired mail job, see ObjectMgr::ReturnOrDeleteOldMails
+struct MailExpiryProgress
+{
+    MailExpiryProgress() : Running(false), StartTime(0), Duration(0), LastMailId(0), Chunks(0), Returned(0), Deleted(0), Skipped(0) { }
+
+    bool Running;
+    uint32 StartTime;                                       // getMSTime() when the job was started
+    uint32 Duration;                                        // in ms, set once all chunks were applied
+    uint32 LastMailId;                                      // highest mail id fetched so far
+    uint32 Chunks;
+    uint32 Returned;
+    uint32 Deleted;
+    uint32 Skipped;                                         // receiver online and already listed his mailbox
+};
+
 class PlayerDumpReader;
 
 class TC_GAME_API ObjectMgr
@@ -1055,7 +1071,11 @@ class TC_GAME_API ObjectMgr
             return itr != _fishingBaseForAreaStore.end() ? itr->second : 0;
         }
 
+        /// Synchronous at startup, while the server is up expired mails are fetched in chunks by async queries
         void ReturnOrDeleteOldMails(bool serverUp);
+        /// Applies fetched expired mails within the Mail.Expiry.UpdateBudget and requests the next chunk
+        void UpdateExpiredMails();
+        MailExpiryProgress const& GetMailExpiryProgress() const { return _mailExpiry; }
 
         CreatureBaseStats const* GetCreatureBaseStats(uint8 level, uint8 unitClass);
 
@@ -1336,6 +1356,28 @@ class TC_GAME_API ObjectMgr
         uint32 _creatureSpawnId;
         uint32 _gameObjectSpawnId;
 
+        struct ExpiredMail
+        {
+            uint32 MessageId;
+            uint8 MessageType;
+            ObjectGuid::LowType Sender;
+            ObjectGuid::LowType Receiver;
+            bool HasItems;
+            uint8 Checked;
+            MailItemInfoVec Items;
+        };
+
+        static void ReadExpiredMail(Field* fields, ExpiredMail& mail);
+        static void ReturnOrDeleteOldMail(ExpiredMail& mail, uint64 basetime, bool serverUp, MailExpiryProgress& progress);
+        void QueryExpiredMailChunk();
+        void HandleExpiredMailChunk(PreparedQueryResult result);
+
+        QueryCallbackProcessor _mailExpiryCallbacks;
+        std::deque<ExpiredMail> _expiredMails;
+        MailExpiryProgress _mailExpiry;
+        uint64 _mailExpiryTime;
+        bool _mailExpiryLastChunk;
+
         // first free low guid for selected guid type
         template<HighGuid high>
         inline ObjectGuidGeneratorBase& GetGuidSequenceGenerator()
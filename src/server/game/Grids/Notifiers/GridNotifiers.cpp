@@ -29,6 +29,9 @@ using namespace Trinity;
 
 void VisibleNotifier::SendToSelf()
 {
+    i_player.m_visibilityUpdatePosition.Relocate(i_player.m_seer);
+    i_player.m_visibilityNotifyPosition.Relocate(i_player.m_seer);
+
     // at this moment i_clientGUIDs have guids that not iterate at grid level checks
     // but exist one case when this possible and object not out of range: transports
     if (Transport* transport = i_player.GetTransport())
@@ -175,6 +178,50 @@ void PlayerRelocationNotifier::Visit(CreatureMapType &m)
     }
 }
 
+void PlayerRelocationDeltaNotifier::Visit(PlayerMapType &m)
+{
+    for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        Player* player = iter->GetSource();
+
+        i_player.UpdateVisibilityOf(player, i_data, i_visibleNow);
+
+        if (player->m_seer->isNeedNotify(NOTIFY_VISIBILITY_CHANGED))
+            continue;
+
+        player->UpdateVisibilityOf(&i_player);
+    }
+}
+
+void PlayerRelocationDeltaNotifier::Visit(CreatureMapType &m)
+{
+    for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+    {
+        Creature* c = iter->GetSource();
+
+        if (i_cellChanged)
+            i_player.UpdateVisibilityOf(c, i_data, i_visibleNow);
+
+        if (!c->isNeedNotify(NOTIFY_VISIBILITY_CHANGED))
+            CreatureUnitRelocationWorker(c, &i_player);
+    }
+}
+
+void PlayerRelocationDeltaNotifier::SendToSelf()
+{
+    i_player.m_visibilityNotifyPosition.Relocate(&i_player);
+
+    if (!i_data.HasData())
+        return;
+
+    WorldPacket packet;
+    i_data.BuildPacket(&packet);
+    i_player.GetSession()->SendPacket(&packet);
+
+    for (std::set<Unit*>::const_iterator it = i_visibleNow.begin(); it != i_visibleNow.end(); ++it)
+        i_player.SendInitialVisiblePackets(*it);
+}
+
 void CreatureRelocationNotifier::Visit(PlayerMapType &m)
 {
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
@@ -229,7 +276,47 @@ void DelayedUnitRelocation::Visit(PlayerMapType &m)
         WorldObject const* viewPoint = player->m_seer;
 
         if (!viewPoint->isNeedNotify(NOTIFY_VISIBILITY_CHANGED))
+        {
+            // moved too little to rebuild visibility: players and creature AI are
+            // still updated around it, everything else only in cells entering or
+            // leaving the visibility area since the last pass
+            if (player->isNeedNotify(NOTIFY_AI_RELOCATION))
+            {
+                float const radius = i_radius + player->GetObjectSize();
+                CellArea const oldArea = Cell::CalculateCellArea(player->m_visibilityNotifyPosition.GetPositionX(), player->m_visibilityNotifyPosition.GetPositionY(), radius);
+                CellArea const newArea = Cell::CalculateCellArea(player->GetPositionX(), player->GetPositionY(), radius);
+
+                PlayerRelocationDeltaNotifier relocate(*player);
+                TypeContainerVisitor<PlayerRelocationDeltaNotifier, WorldTypeMapContainer > c2world_relocation(relocate);
+                TypeContainerVisitor<PlayerRelocationDeltaNotifier, GridTypeMapContainer >  c2grid_relocation(relocate);
+
+                auto visitArea = [&](CellArea const& area, CellArea const& other, bool skipOverlap)
+                {
+                    for (uint32 x = area.low_bound.x_coord; x <= area.high_bound.x_coord; ++x)
+                    {
+                        for (uint32 y = area.low_bound.y_coord; y <= area.high_bound.y_coord; ++y)
+                        {
+                            bool const inOther = x >= other.low_bound.x_coord && x <= other.high_bound.x_coord &&
+                                y >= other.low_bound.y_coord && y <= other.high_bound.y_coord;
+                            if (inOther && skipOverlap)
+                                continue;
+
+                            relocate.i_cellChanged = !inOther;
+                            Cell cell2(CellCoord(x, y));
+                            i_map.Visit(cell2, c2world_relocation);
+                            i_map.Visit(cell2, c2grid_relocation);
+                        }
+                    }
+                };
+
+                // current area, then the cells that were left
+                visitArea(newArea, oldArea, false);
+                visitArea(oldArea, newArea, true);
+
+                relocate.SendToSelf();
+            }
             continue;
+        }
 
         if (player != viewPoint && !viewPoint->IsPositionValid())
             continue;
@@ -347,6 +434,14 @@ void ObjectUpdater::Visit(GridRefManager<T> &m)
             iter->GetSource()->Update(i_timeDiff);
 }
 
+void ObjectUpdater::Visit(CreatureMapType &m)
+{
+    // dead creatures waiting in the map respawn queue have nothing to update
+    for (CreatureMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
+        if (iter->GetSource()->IsInWorld() && !iter->GetSource()->IsRespawnScheduled())
+            iter->GetSource()->Update(i_timeDiff);
+}
+
 bool AnyDeadUnitObjectInRangeCheck::operator()(Player* u)
 {
     return !u->IsAlive() && !u->HasAuraType(SPELL_AURA_GHOST) && i_searchObj->IsWithinDistInMap(u, i_range);
@@ -377,6 +472,5 @@ bool AnyDeadUnitSpellTargetInRangeCheck::operator()(Creature* u)
     return AnyDeadUnitObjectInRangeCheck::operator()(u) && i_check(u);
 }
 
-template void ObjectUpdater::Visit<Creature>(CreatureMapType&);
 template void ObjectUpdater::Visit<GameObject>(GameObjectMapType&);
 template void ObjectUpdater::Visit<DynamicObject>(DynamicObjectMapType&);
@@ -70,6 +70,23 @@ namespace Trinity
         void Visit(PlayerMapType &);
     };
 
+    // small relocation inside one cell: players are updated in both directions and
+    // creatures react to the move, other objects are only updated in the cells the
+    // visibility area entered or left since the last pass
+    struct TC_GAME_API PlayerRelocationDeltaNotifier
+    {
+        Player &i_player;
+        UpdateData i_data;
+        std::set<Unit*> i_visibleNow;
+        bool i_cellChanged;
+
+        PlayerRelocationDeltaNotifier(Player &player) : i_player(player), i_cellChanged(false) { }
+        template<class T> void Visit(GridRefManager<T> &m);
+        void Visit(CreatureMapType &);
+        void Visit(PlayerMapType &);
+        void SendToSelf(void);
+    };
+
     struct TC_GAME_API CreatureRelocationNotifier
     {
         Creature &i_creature;
@@ -162,6 +179,7 @@ namespace Trinity
         uint32 i_timeDiff;
         explicit ObjectUpdater(const uint32 diff) : i_timeDiff(diff) { }
         template<class T> void Visit(GridRefManager<T> &m);
+        void Visit(CreatureMapType &m);
         void Visit(PlayerMapType &) { }
         void Visit(CorpseMapType &) { }
     };
@@ -38,6 +38,16 @@ inline void Trinity::VisibleNotifier::Visit(GridRefManager<T> &m)
     }
 }
 
+template<class T>
+inline void Trinity::PlayerRelocationDeltaNotifier::Visit(GridRefManager<T> &m)
+{
+    if (!i_cellChanged)
+        return;
+
+    for (typename GridRefManager<T>::iterator iter = m.begin(); iter != m.end(); ++iter)
+        i_player.UpdateVisibilityOf(iter->GetSource(), i_data, i_visibleNow);
+}
+
 // SEARCHERS & LIST SEARCHERS & WORKERS
 
 // WorldObject searchers & workers
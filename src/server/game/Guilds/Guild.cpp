@@ -123,6 +123,9 @@ Guild::LogHolder::~LogHolder()
     // Cleanup
     for (GuildLog::iterator itr = m_log.begin(); itr != m_log.end(); ++itr)
         delete (*itr);
+
+    for (GuildLog::iterator itr = m_deferred.begin(); itr != m_deferred.end(); ++itr)
+        delete (*itr);
 }
 
 // Adds event loaded from database to collection
@@ -150,6 +153,26 @@ inline void Guild::LogHolder::AddEvent(SQLTransaction& trans, LogEntry* entry)
     entry->SaveToDB(trans);
 }
 
+// Saves events that happened while holder was not loaded yet.
+// Their guids can only be assigned once the last guid stored in DB is known.
+void Guild::LogHolder::FlushDeferred(SQLTransaction& trans)
+{
+    for (GuildLog::iterator itr = m_deferred.begin(); itr != m_deferred.end(); ++itr)
+    {
+        (*itr)->SetGUID(GetNextGUID());
+        AddEvent(trans, *itr);
+    }
+    m_deferred.clear();
+}
+
+void Guild::LogHolder::Unload()
+{
+    for (GuildLog::iterator itr = m_log.begin(); itr != m_log.end(); ++itr)
+        delete (*itr);
+    m_log.clear();
+    m_nextGUID = uint32(GUILD_EVENT_LOG_GUID_UNDEFINED);
+}
+
 // Writes information about all events into packet.
 inline void Guild::LogHolder::WritePacket(WorldPacket& data) const
 {
@@ -440,10 +463,19 @@ void Guild::BankTab::Delete(SQLTransaction& trans, bool removeItemsFromDB)
             if (removeItemsFromDB)
                 pItem->DeleteFromDB(trans);
             delete pItem;
-            pItem = NULL;
+            m_items[slotId] = NULL;
         }
 }
 
+uint32 Guild::BankTab::GetItemCount() const
+{
+    uint32 count = 0;
+    for (uint8 slotId = 0; slotId < GUILD_BANK_MAX_SLOTS; ++slotId)
+        if (m_items[slotId])
+            ++count;
+    return count;
+}
+
 inline void Guild::BankTab::WritePacket(WorldPacket& data) const
 {
     uint8 count = 0;
@@ -1175,6 +1207,10 @@ bool Guild::Create(Player* pLeader, std::string const& name)
     m_createdDate = ::time(NULL);
     _CreateLogHolders();
 
+    // New guild has neither logs nor items stored in DB
+    for (uint8 i = 0; i < GUILD_LAZY_MAX; ++i)
+        _SetLazyDataLoaded(GuildLazyData(i));
+
     TC_LOG_DEBUG("guild", "GUILD: creating guild [%s] for leader %s (%u)",
         name.c_str(), pLeader->GetName().c_str(), m_leaderGuid.GetCounter());
 
@@ -1241,6 +1277,14 @@ void Guild::Disband()
     // Free bank tab used memory and delete items stored in them
     _DeleteBankItems(trans, true);
 
+    // Items that were never loaded are only known to DB
+    if (m_lazyData[GUILD_LAZY_BANK_ITEMS].State != GUILD_LAZY_STATE_LOADED)
+    {
+        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GUILD_BANK_ITEM_INSTANCES);
+        stmt->setUInt32(0, m_id);
+        trans->Append(stmt);
+    }
+
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GUILD_BANK_ITEMS);
     stmt->setUInt32(0, m_id);
     trans->Append(stmt);
@@ -1838,19 +1882,25 @@ void Guild::SendInfo(WorldSession* session) const
     TC_LOG_DEBUG("guild", "SMSG_GUILD_INFO [%s]", session->GetPlayerInfo().c_str());
 }
 
-void Guild::SendEventLog(WorldSession* session) const
+void Guild::SendEventLog(WorldSession* session)
 {
+    if (!_AccessLazyData(GUILD_LAZY_EVENT_LOG, session, [this](WorldSession* waiter) { SendEventLog(waiter); }))
+        return;
+
     WorldPacket data(MSG_GUILD_EVENT_LOG_QUERY, 1 + m_eventLog->GetSize() * (1 + 8 + 4));
     m_eventLog->WritePacket(data);
     session->SendPacket(&data);
     TC_LOG_DEBUG("guild", "MSG_GUILD_EVENT_LOG_QUERY [%s]", session->GetPlayerInfo().c_str());
 }
 
-void Guild::SendBankLog(WorldSession* session, uint8 tabId) const
+void Guild::SendBankLog(WorldSession* session, uint8 tabId)
 {
     // GUILD_BANK_MAX_TABS send by client for money log
     if (tabId < _GetPurchasedTabsSize() || tabId == GUILD_BANK_MAX_TABS)
     {
+        if (!_AccessLazyData(GUILD_LAZY_BANK_LOG, session, [this, tabId](WorldSession* waiter) { SendBankLog(waiter, tabId); }))
+            return;
+
         const LogHolder* pLog = m_bankEventLog[tabId];
         WorldPacket data(MSG_GUILD_BANK_LOG_QUERY, pLog->GetSize() * (4 * 4 + 1) + 1 + 1);
         data << uint8(tabId);
@@ -1860,14 +1910,23 @@ void Guild::SendBankLog(WorldSession* session, uint8 tabId) const
     }
 }
 
-void Guild::SendBankTabData(WorldSession* session, uint8 tabId) const
+void Guild::SendBankTabData(WorldSession* session, uint8 tabId)
 {
     if (tabId < _GetPurchasedTabsSize())
+    {
+        if (!_AccessLazyData(GUILD_LAZY_BANK_ITEMS, session, [this, tabId](WorldSession* waiter) { SendBankTabData(waiter, tabId); }))
+            return;
+
         _SendBankContent(session, tabId);
+    }
 }
 
-void Guild::SendBankTabsInfo(WorldSession* session, bool sendAllSlots /*= false*/) const
+void Guild::SendBankTabsInfo(WorldSession* session, bool sendAllSlots /*= false*/)
 {
+    // Only full list contains items
+    if (sendAllSlots && !_AccessLazyData(GUILD_LAZY_BANK_ITEMS, session, [this](WorldSession* waiter) { SendBankTabsInfo(waiter, true); }))
+        return;
+
     _SendBankList(session, 0, sendAllSlots);
 }
 
@@ -2070,6 +2129,103 @@ bool Guild::LoadBankItemFromDB(Field* fields)
     return m_bankTabs[tabId]->LoadItemFromDB(fields);
 }
 
+void Guild::LoadLazyDataFromDB(GuildLazyData data, PreparedQueryResult result)
+{
+    if (m_lazyData[data].State != GUILD_LAZY_STATE_LOADING)
+        return;
+
+    SQLTransaction trans = CharacterDatabase.BeginTransaction();
+    switch (data)
+    {
+        case GUILD_LAZY_EVENT_LOG:
+            if (result)
+            {
+                do
+                    LoadEventLogFromDB(result->Fetch());
+                while (result->NextRow());
+            }
+            m_eventLog->FlushDeferred(trans);
+            break;
+        case GUILD_LAZY_BANK_LOG:
+            if (result)
+            {
+                do
+                    LoadBankEventLogFromDB(result->Fetch());
+                while (result->NextRow());
+            }
+            for (uint8 tabId = 0; tabId <= GUILD_BANK_MAX_TABS; ++tabId)
+                m_bankEventLog[tabId]->FlushDeferred(trans);
+            break;
+        case GUILD_LAZY_BANK_ITEMS:
+            if (result)
+            {
+                do
+                    LoadBankItemFromDB(result->Fetch());
+                while (result->NextRow());
+            }
+            break;
+        default:
+            break;
+    }
+
+    // Only events deferred while loading need to be saved
+    if (trans->GetSize())
+        CharacterDatabase.CommitTransaction(trans);
+
+    _SetLazyDataLoaded(data);
+
+    // Answer requests received while loading
+    std::vector<std::pair<ObjectGuid, std::function<void(WorldSession*)>>> waiters;
+    waiters.swap(m_lazyData[data].Waiters);
+    for (auto itr = waiters.begin(); itr != waiters.end(); ++itr)
+        if (Player* player = ObjectAccessor::FindConnectedPlayer(itr->first))
+            if (player->GetGuildId() == m_id)
+                itr->second(player->GetSession());
+}
+
+bool Guild::UnloadIdleLazyData(GuildLazyData data, time_t idleSince)
+{
+    LazyData& lazyData = m_lazyData[data];
+    if (lazyData.State != GUILD_LAZY_STATE_LOADED || lazyData.LastAccess >= idleSince)
+        return false;
+
+    switch (data)
+    {
+        case GUILD_LAZY_EVENT_LOG:
+            if (m_eventLog->HasDeferred())
+                return false;
+            m_eventLog->Unload();
+            break;
+        case GUILD_LAZY_BANK_LOG:
+            for (uint8 tabId = 0; tabId <= GUILD_BANK_MAX_TABS; ++tabId)
+                if (m_bankEventLog[tabId]->HasDeferred())
+                    return false;
+            for (uint8 tabId = 0; tabId <= GUILD_BANK_MAX_TABS; ++tabId)
+                m_bankEventLog[tabId]->Unload();
+            break;
+        case GUILD_LAZY_BANK_ITEMS:
+        {
+            SQLTransaction temp(NULL);
+            for (uint8 tabId = 0; tabId < _GetPurchasedTabsSize(); ++tabId)
+                m_bankTabs[tabId]->Delete(temp);
+            break;
+        }
+        default:
+            return false;
+    }
+
+    lazyData.State = GUILD_LAZY_STATE_UNLOADED;
+    return true;
+}
+
+uint32 Guild::GetBankItemCount() const
+{
+    uint32 count = 0;
+    for (uint8 tabId = 0; tabId < _GetPurchasedTabsSize(); ++tabId)
+        count += m_bankTabs[tabId]->GetItemCount();
+    return count;
+}
+
 // Validates guild data loaded from database. Returns false if guild should be deleted.
 bool Guild::Validate()
 {
@@ -2362,6 +2518,10 @@ void Guild::SwapItems(Player* player, uint8 tabId, uint8 slotId, uint8 destTabId
     if (tabId == destTabId && slotId == destSlotId)
         return;
 
+    // Contents were unloaded while bank window was open, client gets fresh tab instead of the move
+    if (!_AccessLazyData(GUILD_LAZY_BANK_ITEMS, player->GetSession(), [this, tabId](WorldSession* waiter) { SendBankTabData(waiter, tabId); }))
+        return;
+
     BankMoveItemData from(this, player, tabId, slotId);
     BankMoveItemData to(this, player, destTabId, destSlotId);
     _MoveItems(&from, &to, splitedAmount);
@@ -2372,6 +2532,9 @@ void Guild::SwapItemsWithInventory(Player* player, bool toChar, uint8 tabId, uin
     if ((slotId >= GUILD_BANK_MAX_SLOTS && slotId != NULL_SLOT) || tabId >= _GetPurchasedTabsSize())
         return;
 
+    if (!_AccessLazyData(GUILD_LAZY_BANK_ITEMS, player->GetSession(), [this, tabId](WorldSession* waiter) { SendBankTabData(waiter, tabId); }))
+        return;
+
     BankMoveItemData bankData(this, player, tabId, slotId);
     PlayerMoveItemData charData(this, player, playerBag, playerSlotId);
     if (toChar)
@@ -2398,6 +2561,30 @@ void Guild::_CreateLogHolders()
         m_bankEventLog[tabId] = new LogHolder(sWorld->getIntConfig(CONFIG_GUILD_BANK_EVENT_LOG_COUNT));
 }
 
+bool Guild::_AccessLazyData(GuildLazyData data, WorldSession* session /*= NULL*/, std::function<void(WorldSession*)> callback /*= nullptr*/)
+{
+    LazyData& lazyData = m_lazyData[data];
+    lazyData.LastAccess = ::time(NULL);
+    if (lazyData.State == GUILD_LAZY_STATE_LOADED)
+        return true;
+
+    if (session && callback)
+        lazyData.Waiters.push_back(std::make_pair(session->GetPlayer()->GetGUID(), std::move(callback)));
+
+    if (lazyData.State == GUILD_LAZY_STATE_UNLOADED)
+    {
+        lazyData.State = GUILD_LAZY_STATE_LOADING;
+        sGuildMgr->QueueLazyDataLoad(m_id, data);
+    }
+    return false;
+}
+
+void Guild::_SetLazyDataLoaded(GuildLazyData data)
+{
+    m_lazyData[data].State = GUILD_LAZY_STATE_LOADED;
+    m_lazyData[data].LastAccess = ::time(NULL);
+}
+
 void Guild::_CreateNewBankTab()
 {
     uint8 tabId = _GetPurchasedTabsSize();                      // Next free id
@@ -2637,9 +2824,14 @@ inline bool Guild::_MemberHasTabRights(ObjectGuid guid, uint8 tabId, uint32 righ
 // Add new event log record
 inline void Guild::_LogEvent(GuildEventLogTypes eventType, ObjectGuid::LowType playerGuid1, ObjectGuid::LowType playerGuid2, uint8 newRank)
 {
-    SQLTransaction trans = CharacterDatabase.BeginTransaction();
-    m_eventLog->AddEvent(trans, new EventLogEntry(m_id, m_eventLog->GetNextGUID(), eventType, playerGuid1, playerGuid2, newRank));
-    CharacterDatabase.CommitTransaction(trans);
+    if (_AccessLazyData(GUILD_LAZY_EVENT_LOG))
+    {
+        SQLTransaction trans = CharacterDatabase.BeginTransaction();
+        m_eventLog->AddEvent(trans, new EventLogEntry(m_id, m_eventLog->GetNextGUID(), eventType, playerGuid1, playerGuid2, newRank));
+        CharacterDatabase.CommitTransaction(trans);
+    }
+    else // guid is assigned when log is loaded
+        m_eventLog->DeferEvent(new EventLogEntry(m_id, 0, eventType, playerGuid1, playerGuid2, newRank));
 
     sScriptMgr->OnGuildEvent(this, uint8(eventType), playerGuid1, playerGuid2, newRank);
 }
@@ -2661,7 +2853,10 @@ void Guild::_LogBankEvent(SQLTransaction& trans, GuildBankEventLogTypes eventTyp
         dbTabId = GUILD_BANK_MONEY_LOGS_TAB;
     }
     LogHolder* pLog = m_bankEventLog[tabId];
-    pLog->AddEvent(trans, new BankEventLogEntry(m_id, pLog->GetNextGUID(), eventType, dbTabId, lowguid, itemOrMoney, itemStackCount, destTabId));
+    if (_AccessLazyData(GUILD_LAZY_BANK_LOG))
+        pLog->AddEvent(trans, new BankEventLogEntry(m_id, pLog->GetNextGUID(), eventType, dbTabId, lowguid, itemOrMoney, itemStackCount, destTabId));
+    else // guid is assigned when log is loaded
+        pLog->DeferEvent(new BankEventLogEntry(m_id, 0, eventType, dbTabId, lowguid, itemOrMoney, itemStackCount, destTabId));
 
     sScriptMgr->OnGuildBankEvent(this, uint8(eventType), tabId, lowguid, itemOrMoney, itemStackCount, destTabId);
 }
@@ -222,6 +222,22 @@ enum GuildMemberFlags
     GUILDMEMBER_STATUS_MOBILE           = 0x0008, // remote chat from mobile app
 };
 
+// Guild data that is not loaded at startup but fetched from DB on first access
+enum GuildLazyData
+{
+    GUILD_LAZY_EVENT_LOG                = 0,
+    GUILD_LAZY_BANK_LOG                 = 1,
+    GUILD_LAZY_BANK_ITEMS               = 2,
+    GUILD_LAZY_MAX
+};
+
+enum GuildLazyDataState
+{
+    GUILD_LAZY_STATE_UNLOADED           = 0,
+    GUILD_LAZY_STATE_LOADING            = 1,
+    GUILD_LAZY_STATE_LOADED             = 2
+};
+
 // Emblem info
 class TC_GAME_API EmblemInfo
 {
@@ -372,6 +388,7 @@ private:
         virtual ~LogEntry() { }
 
         uint32 GetGUID() const { return m_guid; }
+        void SetGUID(uint32 guid) { m_guid = guid; }
         uint64 GetTimestamp() const { return m_timestamp; }
 
         virtual void SaveToDB(SQLTransaction& trans) const = 0;
@@ -455,12 +472,20 @@ private:
         void LoadEvent(LogEntry* entry);
         // Adds new event to collection and saves it to DB
         void AddEvent(SQLTransaction& trans, LogEntry* entry);
+        // Keeps event happened while holder was not loaded until it is
+        void DeferEvent(LogEntry* entry) { m_deferred.push_back(entry); }
+        // Saves deferred events to DB after holder was loaded
+        void FlushDeferred(SQLTransaction& trans);
+        inline bool HasDeferred() const { return !m_deferred.empty(); }
+        // Removes all loaded events from memory
+        void Unload();
         // Writes information about all events to packet
         void WritePacket(WorldPacket& data) const;
         uint32 GetNextGUID();
 
     private:
         GuildLog m_log;
+        GuildLog m_deferred;
         uint32 m_maxRecords;
         uint32 m_nextGUID;
     };
@@ -525,6 +550,7 @@ private:
         void LoadFromDB(Field* fields);
         bool LoadItemFromDB(Field* fields);
         void Delete(SQLTransaction& trans, bool removeItemsFromDB = false);
+        uint32 GetItemCount() const;
 
         void WritePacket(WorldPacket& data) const;
         bool WriteSlotPacket(WorldPacket& data, uint8 slotId, bool ignoreEmpty = true) const;
@@ -638,6 +664,17 @@ private:
         void CanStoreItemInTab(Item* pItem, uint8 skipSlotId, bool merge, uint32& count);
     };
 
+    // Load state of data loaded on first access
+    struct LazyData
+    {
+        LazyData() : State(GUILD_LAZY_STATE_UNLOADED), LastAccess(0) { }
+
+        GuildLazyDataState State;
+        time_t LastAccess;
+        // Requests delayed until data is loaded, replayed for players still in guild
+        std::vector<std::pair<ObjectGuid, std::function<void(WorldSession*)>>> Waiters;
+    };
+
     typedef std::unordered_map<uint32, Member*> Members;
     typedef std::vector<RankInfo> Ranks;
     typedef std::vector<BankTab*> BankTabs;
@@ -661,6 +698,7 @@ public:
     uint32 GetMemberCount() const { return m_members.size(); }
     time_t GetCreatedDate() const { return m_createdDate; }
     uint64 GetBankMoney() const { return m_bankMoney; }
+    uint32 GetBankItemCount() const;
 
     bool SetName(std::string const& name);
 
@@ -693,10 +731,10 @@ public:
 
     // Send info to client
     void SendInfo(WorldSession* session) const;
-    void SendEventLog(WorldSession* session) const;
-    void SendBankLog(WorldSession* session, uint8 tabId) const;
-    void SendBankTabsInfo(WorldSession* session, bool showTabs = false) const;
-    void SendBankTabData(WorldSession* session, uint8 tabId) const;
+    void SendEventLog(WorldSession* session);
+    void SendBankLog(WorldSession* session, uint8 tabId);
+    void SendBankTabsInfo(WorldSession* session, bool showTabs = false);
+    void SendBankTabData(WorldSession* session, uint8 tabId);
     void SendBankTabText(WorldSession* session, uint8 tabId) const;
     void SendPermissions(WorldSession* session) const;
     void SendMoneyInfo(WorldSession* session) const;
@@ -713,6 +751,12 @@ public:
     bool LoadBankItemFromDB(Field* fields);
     bool Validate();
 
+    // Data loaded on first access
+    GuildLazyDataState GetLazyDataState(GuildLazyData data) const { return m_lazyData[data].State; }
+    void LoadLazyDataFromDB(GuildLazyData data, PreparedQueryResult result);
+    // Frees data not accessed since given time. Returns true if data was unloaded.
+    bool UnloadIdleLazyData(GuildLazyData data, time_t idleSince);
+
     // Broadcasts
     void BroadcastToGuild(WorldSession* session, bool officerOnly, std::string const& msg, uint32 language = LANG_UNIVERSAL) const;
     void BroadcastPacketToRank(WorldPacket* packet, uint8 rankId) const;
@@ -764,6 +808,8 @@ protected:
     LogHolder* m_eventLog;
     LogHolder* m_bankEventLog[GUILD_BANK_MAX_TABS + 1];
 
+    LazyData m_lazyData[GUILD_LAZY_MAX];
+
 private:
     inline uint8 _GetRanksSize() const { return uint8(m_ranks.size()); }
     inline const RankInfo* GetRankInfo(uint8 rankId) const { return rankId < _GetRanksSize() ? &m_ranks[rankId] : NULL; }
@@ -812,6 +858,9 @@ private:
 
     // Creates log holders (either when loading or when creating guild)
     void _CreateLogHolders();
+    // Returns true if data is loaded. Otherwise requests it and replays callback for session once loaded.
+    bool _AccessLazyData(GuildLazyData data, WorldSession* session = NULL, std::function<void(WorldSession*)> callback = nullptr);
+    void _SetLazyDataLoaded(GuildLazyData data);
     // Tries to create new bank tab
     void _CreateNewBankTab();
     // Creates default guild ranks with names in given locale
@@ -18,7 +18,7 @@
 #include "Common.h"
 #include "GuildMgr.h"
 
-GuildMgr::GuildMgr() : NextGuildId(1)
+GuildMgr::GuildMgr() : NextGuildId(1), LazyDataUnloadTimer(GUILD_LAZY_DATA_UNLOAD_INTERVAL)
 { }
 
 GuildMgr::~GuildMgr()
@@ -243,74 +243,7 @@ void GuildMgr::LoadGuilds()
         }
     }
 
-    // 5. Load all event logs
-    TC_LOG_INFO("server.loading", "Loading guild event logs...");
-    {
-        uint32 oldMSTime = getMSTime();
-
-        CharacterDatabase.DirectPExecute("DELETE FROM guild_eventlog WHERE LogGuid > %u", sWorld->getIntConfig(CONFIG_GUILD_EVENT_LOG_COUNT));
-
-                                                     //          0        1        2          3            4            5        6
-        QueryResult result = CharacterDatabase.Query("SELECT guildid, LogGuid, EventType, PlayerGuid1, PlayerGuid2, NewRank, TimeStamp FROM guild_eventlog ORDER BY TimeStamp DESC, LogGuid DESC");
-
-        if (!result)
-        {
-            TC_LOG_INFO("server.loading", ">> Loaded 0 guild event logs. DB table `guild_eventlog` is empty.");
-        }
-        else
-        {
-            uint32 count = 0;
-            do
-            {
-                Field* fields = result->Fetch();
-                uint32 guildId = fields[0].GetUInt32();
-
-                if (Guild* guild = GetGuildById(guildId))
-                    guild->LoadEventLogFromDB(fields);
-
-                ++count;
-            }
-            while (result->NextRow());
-
-            TC_LOG_INFO("server.loading", ">> Loaded %u guild event logs in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
-        }
-    }
-
-    // 6. Load all bank event logs
-    TC_LOG_INFO("server.loading", "Loading guild bank event logs...");
-    {
-        uint32 oldMSTime = getMSTime();
-
-        // Remove log entries that exceed the number of allowed entries per guild
-        CharacterDatabase.DirectPExecute("DELETE FROM guild_bank_eventlog WHERE LogGuid > %u", sWorld->getIntConfig(CONFIG_GUILD_BANK_EVENT_LOG_COUNT));
-
-                                                     //          0        1      2        3          4           5            6               7          8
-        QueryResult result = CharacterDatabase.Query("SELECT guildid, TabId, LogGuid, EventType, PlayerGuid, ItemOrMoney, ItemStackCount, DestTabId, TimeStamp FROM guild_bank_eventlog ORDER BY TimeStamp DESC, LogGuid DESC");
-
-        if (!result)
-        {
-            TC_LOG_INFO("server.loading", ">> Loaded 0 guild bank event logs. DB table `guild_bank_eventlog` is empty.");
-        }
-        else
-        {
-            uint32 count = 0;
-            do
-            {
-                Field* fields = result->Fetch();
-                uint32 guildId = fields[0].GetUInt32();
-
-                if (Guild* guild = GetGuildById(guildId))
-                    guild->LoadBankEventLogFromDB(fields);
-
-                ++count;
-            }
-            while (result->NextRow());
-
-            TC_LOG_INFO("server.loading", ">> Loaded %u guild bank event logs in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
-        }
-    }
-
-    // 7. Load all guild bank tabs
+    // 5. Load all guild bank tabs
     TC_LOG_INFO("server.loading", "Loading guild bank tabs...");
     {
         uint32 oldMSTime = getMSTime();
@@ -344,43 +277,22 @@ void GuildMgr::LoadGuilds()
         }
     }
 
-    // 8. Fill all guild bank tabs
-    TC_LOG_INFO("guild", "Filling bank tabs with items...");
+    // 6. Clean up guild logs and bank items, these are loaded on first access
+    TC_LOG_INFO("server.loading", "Cleaning up guild event logs and bank items...");
     {
         uint32 oldMSTime = getMSTime();
 
+        // Remove log entries that exceed the number of allowed entries per guild
+        CharacterDatabase.DirectPExecute("DELETE FROM guild_eventlog WHERE LogGuid > %u", sWorld->getIntConfig(CONFIG_GUILD_EVENT_LOG_COUNT));
+        CharacterDatabase.DirectPExecute("DELETE FROM guild_bank_eventlog WHERE LogGuid > %u", sWorld->getIntConfig(CONFIG_GUILD_BANK_EVENT_LOG_COUNT));
+
         // Delete orphan guild bank items
         CharacterDatabase.DirectExecute("DELETE gbi FROM guild_bank_item gbi LEFT JOIN guild g ON gbi.guildId = g.guildId WHERE g.guildId IS NULL");
 
-                                                     //          0            1                2      3         4        5      6             7                 8           9           10
-        QueryResult result = CharacterDatabase.Query("SELECT creatorGuid, giftCreatorGuid, count, duration, charges, flags, enchantments, randomPropertyId, durability, playedTime, text, "
-                                                     //   11       12     13      14         15
-                                                     "guildid, TabId, SlotId, item_guid, itemEntry FROM guild_bank_item gbi INNER JOIN item_instance ii ON gbi.item_guid = ii.guid");
-
-        if (!result)
-        {
-            TC_LOG_INFO("server.loading", ">> Loaded 0 guild bank tab items. DB table `guild_bank_item` or `item_instance` is empty.");
-        }
-        else
-        {
-            uint32 count = 0;
-            do
-            {
-                Field* fields = result->Fetch();
-                uint32 guildId = fields[11].GetUInt32();
-
-                if (Guild* guild = GetGuildById(guildId))
-                    guild->LoadBankItemFromDB(fields);
-
-                ++count;
-            }
-            while (result->NextRow());
-
-            TC_LOG_INFO("server.loading", ">> Loaded %u guild bank tab items in %u ms", count, GetMSTimeDiffToNow(oldMSTime));
-        }
+        TC_LOG_INFO("server.loading", ">> Cleaned up guild event logs and bank items in %u ms", GetMSTimeDiffToNow(oldMSTime));
     }
 
-    // 9. Validate loaded guild data
+    // 7. Validate loaded guild data
     TC_LOG_INFO("guild", "Validating data of loaded guilds...");
     {
         uint32 oldMSTime = getMSTime();
@@ -405,3 +317,87 @@ void GuildMgr::ResetTimes()
 
     CharacterDatabase.DirectExecute("TRUNCATE guild_member_withdraw");
 }
+
+void GuildMgr::Update(uint32 diff)
+{
+    for (std::deque<LazyDataLoad>::iterator itr = LazyDataLoads.begin(); itr != LazyDataLoads.end();)
+    {
+        if (itr->Result.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            ++itr;
+            continue;
+        }
+
+        PreparedQueryResult result = itr->Result.get();
+
+        // Guild may have been disbanded in the meantime
+        if (Guild* guild = GetGuildById(itr->GuildId))
+        {
+            guild->LoadLazyDataFromDB(itr->Data, result);
+
+            uint32 loadTime = GetMSTimeDiffToNow(itr->RequestTime);
+            GuildLazyDataStats& stats = LazyDataStats[itr->Data];
+            ++stats.Loads;
+            stats.LoadTime += loadTime;
+            stats.MaxLoadTime = std::max(stats.MaxLoadTime, loadTime);
+        }
+
+        itr = LazyDataLoads.erase(itr);
+    }
+
+    uint32 idleTime = sWorld->getIntConfig(CONFIG_GUILD_LAZY_DATA_IDLE_TIME);
+    if (!idleTime)
+        return;
+
+    if (LazyDataUnloadTimer > diff)
+    {
+        LazyDataUnloadTimer -= diff;
+        return;
+    }
+    LazyDataUnloadTimer = GUILD_LAZY_DATA_UNLOAD_INTERVAL;
+
+    time_t idleSince = time(NULL) - idleTime;
+    for (GuildContainer::const_iterator itr = GuildStore.begin(); itr != GuildStore.end(); ++itr)
+        for (uint8 i = 0; i < GUILD_LAZY_MAX; ++i)
+            if (itr->second->UnloadIdleLazyData(GuildLazyData(i), idleSince))
+                ++LazyDataStats[i].Unloads;
+}
+
+void GuildMgr::QueueLazyDataLoad(ObjectGuid::LowType guildId, GuildLazyData data)
+{
+    static CharacterDatabaseStatements const statements[GUILD_LAZY_MAX] =
+    {
+        CHAR_SEL_GUILD_EVENTLOGS,                           // GUILD_LAZY_EVENT_LOG
+        CHAR_SEL_GUILD_BANK_EVENTLOGS,                      // GUILD_LAZY_BANK_LOG
+        CHAR_SEL_GUILD_BANK_ITEMS                           // GUILD_LAZY_BANK_ITEMS
+    };
+
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(statements[data]);
+    stmt->setUInt32(0, guildId);
+
+    LazyDataLoad load;
+    load.GuildId = guildId;
+    load.Data = data;
+    load.RequestTime = getMSTime();
+    load.Result = CharacterDatabase.AsyncQuery(stmt);
+    LazyDataLoads.push_back(std::move(load));
+
+    ++LazyDataStats[data].Requests;
+}
+
+uint32 GuildMgr::GetLazyDataLoadedCount(GuildLazyData data) const
+{
+    uint32 count = 0;
+    for (GuildContainer::const_iterator itr = GuildStore.begin(); itr != GuildStore.end(); ++itr)
+        if (itr->second->GetLazyDataState(data) == GUILD_LAZY_STATE_LOADED)
+            ++count;
+    return count;
+}
+
+uint32 GuildMgr::GetBankItemCount() const
+{
+    uint32 count = 0;
+    for (GuildContainer::const_iterator itr = GuildStore.begin(); itr != GuildStore.end(); ++itr)
+        count += itr->second->GetBankItemCount();
+    return count;
+}
@@ -20,6 +20,19 @@
 
 #include "Guild.h"
 
+#define GUILD_LAZY_DATA_UNLOAD_INTERVAL (60 * IN_MILLISECONDS)
+
+struct GuildLazyDataStats
+{
+    GuildLazyDataStats() : Requests(0), Loads(0), LoadTime(0), MaxLoadTime(0), Unloads(0) { }
+
+    uint32 Requests;
+    uint32 Loads;
+    uint64 LoadTime;                                        // total time from request to load, in ms
+    uint32 MaxLoadTime;
+    uint32 Unloads;
+};
+
 class TC_GAME_API GuildMgr
 {
 private:
@@ -42,10 +55,30 @@ public:
     void SetNextGuildId(ObjectGuid::LowType Id) { NextGuildId = Id; }
 
     void ResetTimes();
+
+    // Guild logs and bank contents are loaded on first access and unloaded when idle
+    void Update(uint32 diff);
+    void QueueLazyDataLoad(ObjectGuid::LowType guildId, GuildLazyData data);
+    GuildLazyDataStats const& GetLazyDataStats(GuildLazyData data) const { return LazyDataStats[data]; }
+    uint32 GetLazyDataLoadedCount(GuildLazyData data) const;
+    uint32 GetLazyDataPendingCount() const { return uint32(LazyDataLoads.size()); }
+    uint32 GetGuildCount() const { return uint32(GuildStore.size()); }
+    uint32 GetBankItemCount() const;
 protected:
+    struct LazyDataLoad
+    {
+        ObjectGuid::LowType GuildId;
+        GuildLazyData Data;
+        uint32 RequestTime;
+        PreparedQueryResultFuture Result;
+    };
+
     typedef std::unordered_map<ObjectGuid::LowType, Guild*> GuildContainer;
     ObjectGuid::LowType NextGuildId;
     GuildContainer GuildStore;
+    std::deque<LazyDataLoad> LazyDataLoads;
+    GuildLazyDataStats LazyDataStats[GUILD_LAZY_MAX];
+    uint32 LazyDataUnloadTimer;
 };
 
 #define sGuildMgr GuildMgr::instance()
@@ -426,85 +426,89 @@ void WorldSession::HandleCalendarEventInvite(WorldPacket& recvData)
     bool isPreInvite;
     bool isGuildEvent;
 
-    ObjectGuid inviteeGuid;
-    uint32 inviteeTeam = 0;
-    uint32 inviteeGuildId = 0;
-
     recvData >> eventId >> inviteId >> name >> isPreInvite >> isGuildEvent;
 
-    if (Player* player = ObjectAccessor::FindConnectedPlayerByName(name))
-    {
-        // Invitee is online
-        inviteeGuid = player->GetGUID();
-        inviteeTeam = player->GetTeam();
-        inviteeGuildId = player->GetGuildId();
-    }
-    else
+    auto inviteToEvent = [this, playerGuid, eventId, inviteId, name, isPreInvite, isGuildEvent](ObjectGuid inviteeGuid, uint32 inviteeTeam, uint32 inviteeGuildId, bool isIgnoringInviter)
     {
-        // Invitee offline, get data from database
-        PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUID_RACE_ACC_BY_NAME);
-        stmt->setString(0, name);
-        if (PreparedQueryResult result = CharacterDatabase.Query(stmt))
+        if (_player->GetTeam() != inviteeTeam && !sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_CALENDAR))
         {
-            Field* fields = result->Fetch();
-            inviteeGuid = ObjectGuid(HighGuid::Player, fields[0].GetUInt32());
-            inviteeTeam = Player::TeamForRace(fields[1].GetUInt8());
-            inviteeGuildId = Player::GetGuildIdFromDB(inviteeGuid);
+            sCalendarMgr->SendCalendarCommandResult(playerGuid, CALENDAR_ERROR_NOT_ALLIED);
+            return;
         }
-    }
 
-    if (!inviteeGuid)
-    {
-        sCalendarMgr->SendCalendarCommandResult(playerGuid, CALENDAR_ERROR_PLAYER_NOT_FOUND);
-        return;
-    }
-
-    if (_player->GetTeam() != inviteeTeam && !sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_CALENDAR))
-    {
-        sCalendarMgr->SendCalendarCommandResult(playerGuid, CALENDAR_ERROR_NOT_ALLIED);
-        return;
-    }
-
-    if (QueryResult result = CharacterDatabase.PQuery("SELECT flags FROM character_social WHERE guid = %u AND friend = %u", inviteeGuid.GetCounter(), playerGuid.GetCounter()))
-    {
-        Field* fields = result->Fetch();
-        if (fields[0].GetUInt8() & SOCIAL_FLAG_IGNORED)
+        if (isIgnoringInviter)
         {
             sCalendarMgr->SendCalendarCommandResult(playerGuid, CALENDAR_ERROR_IGNORING_YOU_S, name.c_str());
             return;
         }
-    }
 
-    if (!isPreInvite)
-    {
-        if (CalendarEvent* calendarEvent = sCalendarMgr->GetEvent(eventId))
+        if (!isPreInvite)
         {
-            if (calendarEvent->IsGuildEvent() && calendarEvent->GetGuildId() == inviteeGuildId)
+            if (CalendarEvent* calendarEvent = sCalendarMgr->GetEvent(eventId))
+            {
+                if (calendarEvent->IsGuildEvent() && calendarEvent->GetGuildId() == inviteeGuildId)
+                {
+                    // we can't invite guild members to guild events
+                    sCalendarMgr->SendCalendarCommandResult(playerGuid, CALENDAR_ERROR_NO_GUILD_INVITES);
+                    return;
+                }
+
+                // 946684800 is 01/01/2000 00:00:00 - default response time
+                CalendarInvite* invite = new CalendarInvite(sCalendarMgr->GetFreeInviteId(), eventId, inviteeGuid, playerGuid, 946684800, CALENDAR_STATUS_INVITED, CALENDAR_RANK_PLAYER, "");
+                sCalendarMgr->AddInvite(calendarEvent, invite);
+            }
+            else
+                sCalendarMgr->SendCalendarCommandResult(playerGuid, CALENDAR_ERROR_EVENT_INVALID);
+        }
+        else
+        {
+            if (isGuildEvent && inviteeGuildId == _player->GetGuildId())
             {
-                // we can't invite guild members to guild events
                 sCalendarMgr->SendCalendarCommandResult(playerGuid, CALENDAR_ERROR_NO_GUILD_INVITES);
                 return;
             }
 
             // 946684800 is 01/01/2000 00:00:00 - default response time
-            CalendarInvite* invite = new CalendarInvite(sCalendarMgr->GetFreeInviteId(), eventId, inviteeGuid, playerGuid, 946684800, CALENDAR_STATUS_INVITED, CALENDAR_RANK_PLAYER, "");
-            sCalendarMgr->AddInvite(calendarEvent, invite);
+            CalendarInvite invite(inviteId, 0, inviteeGuid, playerGuid, 946684800, CALENDAR_STATUS_INVITED, CALENDAR_RANK_PLAYER, "");
+            sCalendarMgr->SendCalendarEventInvite(invite);
         }
-        else
-            sCalendarMgr->SendCalendarCommandResult(playerGuid, CALENDAR_ERROR_EVENT_INVALID);
+    };
+
+    if (Player* player = ObjectAccessor::FindConnectedPlayerByName(name))
+    {
+        // Invitee is online
+        inviteToEvent(player->GetGUID(), player->GetTeam(), player->GetGuildId(), player->GetSocial()->HasIgnore(playerGuid.GetCounter()));
+        return;
     }
-    else
+
+    // Invitee offline, guid and race come from the character info store, guild and ignore list only from the database
+    ObjectGuid inviteeGuid = sWorld->GetCharacterGuidByName(name);
+    CharacterInfo const* characterInfo = inviteeGuid ? sWorld->GetCharacterInfo(inviteeGuid) : nullptr;
+    if (!characterInfo)
     {
-        if (isGuildEvent && inviteeGuildId == _player->GetGuildId())
+        sCalendarMgr->SendCalendarCommandResult(playerGuid, CALENDAR_ERROR_PLAYER_NOT_FOUND);
+        return;
+    }
+
+    uint32 inviteeTeam = Player::TeamForRace(characterInfo->Race);
+
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CALENDAR_INVITEE_INFO);
+    stmt->setUInt32(0, playerGuid.GetCounter());
+    stmt->setUInt32(1, inviteeGuid.GetCounter());
+
+    _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [inviteToEvent, inviteeGuid, inviteeTeam](PreparedQueryResult result)
+    {
+        uint32 inviteeGuildId = 0;
+        bool isIgnoringInviter = false;
+        if (result)
         {
-            sCalendarMgr->SendCalendarCommandResult(playerGuid, CALENDAR_ERROR_NO_GUILD_INVITES);
-            return;
+            Field* fields = result->Fetch();
+            inviteeGuildId = fields[0].GetUInt32();
+            isIgnoringInviter = (fields[1].GetUInt8() & SOCIAL_FLAG_IGNORED) != 0;
         }
 
-        // 946684800 is 01/01/2000 00:00:00 - default response time
-        CalendarInvite invite(inviteId, 0, inviteeGuid, playerGuid, 946684800, CALENDAR_STATUS_INVITED, CALENDAR_RANK_PLAYER, "");
-        sCalendarMgr->SendCalendarEventInvite(invite);
-    }
+        inviteToEvent(inviteeGuid, inviteeTeam, inviteeGuildId, isIgnoringInviter);
+    });
 }
 
 void WorldSession::HandleCalendarEventSignup(WorldPacket& recvData)
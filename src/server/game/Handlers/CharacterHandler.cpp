@@ -754,7 +754,7 @@ void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recvData)
         return;
     }
 
-    _charLoginCallback = CharacterDatabase.DelayQueryHolder(holder);
+    _charLoginCallback = CharacterDatabase.DelayQueryHolder(holder, "player login");
 }
 
 void WorldSession::HandlePlayerLogin(LoginQueryHolder* holder)
@@ -1342,10 +1342,17 @@ void WorldSession::HandleCharCustomize(WorldPacket& recvData)
              >> customizeInfo.FacialHair
              >> customizeInfo.Face;
 
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_NAME_DATA);
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_CUSTOMIZE_INFO);
     stmt->setUInt32(0, customizeInfo.Guid.GetCounter());
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
 
+    _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, customizeInfo](PreparedQueryResult result)
+    {
+        HandleCharCustomizeCallback(result, customizeInfo);
+    });
+}
+
+void WorldSession::HandleCharCustomizeCallback(PreparedQueryResult result, CharacterCustomizeInfo customizeInfo)
+{
     if (!result)
     {
         SendCharCustomize(CHAR_CREATE_ERROR, customizeInfo);
@@ -1353,9 +1360,11 @@ void WorldSession::HandleCharCustomize(WorldPacket& recvData)
     }
 
     Field* fields = result->Fetch();
-    uint8 plrRace = fields[0].GetUInt8();
-    uint8 plrClass = fields[1].GetUInt8();
-    uint8 plrGender = fields[2].GetUInt8();
+    std::string oldName = fields[0].GetString();
+    uint8 plrRace = fields[1].GetUInt8();
+    uint8 plrClass = fields[2].GetUInt8();
+    uint8 plrGender = fields[3].GetUInt8();
+    uint32 at_loginFlags = fields[4].GetUInt16();
 
     if (!Player::ValidateAppearance(plrRace, plrClass, plrGender, customizeInfo.HairStyle, customizeInfo.HairColor, customizeInfo.Face, customizeInfo.FacialHair, customizeInfo.Skin, true))
     {
@@ -1363,21 +1372,6 @@ void WorldSession::HandleCharCustomize(WorldPacket& recvData)
         return;
     }
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_AT_LOGIN);
-
-    stmt->setUInt32(0, customizeInfo.Guid.GetCounter());
-    // TODO: Make async with callback
-    result = CharacterDatabase.Query(stmt);
-
-    if (!result)
-    {
-        SendCharCustomize(CHAR_CREATE_ERROR, customizeInfo);
-        return;
-    }
-
-    fields = result->Fetch();
-    uint32 at_loginFlags = fields[0].GetUInt16();
-
     if (!(at_loginFlags & AT_LOGIN_CUSTOMIZE))
     {
         SendCharCustomize(CHAR_CREATE_ERROR, customizeInfo);
@@ -1415,22 +1409,14 @@ void WorldSession::HandleCharCustomize(WorldPacket& recvData)
         }
     }
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_NAME);
-    stmt->setUInt32(0, customizeInfo.Guid.GetCounter());
-    result = CharacterDatabase.Query(stmt);
-
-    if (result)
-    {
-        std::string oldname = result->Fetch()[0].GetString();
-        TC_LOG_INFO("entities.player.character", "Account: %d (IP: %s), Character[%s] (%s) Customized to: %s",
-            GetAccountId(), GetRemoteAddress().c_str(), oldname.c_str(), customizeInfo.Guid.ToString().c_str(), customizeInfo.Name.c_str());
-    }
+    TC_LOG_INFO("entities.player.character", "Account: %d (IP: %s), Character[%s] (%s) Customized to: %s",
+        GetAccountId(), GetRemoteAddress().c_str(), oldName.c_str(), customizeInfo.Guid.ToString().c_str(), customizeInfo.Name.c_str());
 
     SQLTransaction trans = CharacterDatabase.BeginTransaction();
 
     Player::Customize(&customizeInfo, trans);
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_CHAR_NAME_AT_LOGIN);
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_CHAR_NAME_AT_LOGIN);
     stmt->setString(0, customizeInfo.Name);
     stmt->setUInt16(1, uint16(AT_LOGIN_CUSTOMIZE));
     stmt->setUInt32(2, customizeInfo.Guid.GetCounter());
@@ -1569,121 +1555,161 @@ void WorldSession::HandleEquipmentSetUse(WorldPacket& recvData)
 
 void WorldSession::HandleCharFactionOrRaceChange(WorldPacket& recvData)
 {
-    CharacterFactionChangeInfo factionChangeInfo;
-    recvData >> factionChangeInfo.Guid;
+    std::shared_ptr<CharacterFactionChangeInfo> factionChangeInfo = std::make_shared<CharacterFactionChangeInfo>();
+    recvData >> factionChangeInfo->Guid;
 
-    if (!IsLegitCharacterForAccount(factionChangeInfo.Guid))
+    if (!IsLegitCharacterForAccount(factionChangeInfo->Guid))
     {
         TC_LOG_ERROR("network", "Account %u, IP: %s tried to factionchange character %s, but it does not belong to their account!",
-            GetAccountId(), GetRemoteAddress().c_str(), factionChangeInfo.Guid.ToString().c_str());
+            GetAccountId(), GetRemoteAddress().c_str(), factionChangeInfo->Guid.ToString().c_str());
         recvData.rfinish();
         KickPlayer();
         return;
     }
 
-    recvData >> factionChangeInfo.Name
-             >> factionChangeInfo.Gender
-             >> factionChangeInfo.Skin
-             >> factionChangeInfo.HairColor
-             >> factionChangeInfo.HairStyle
-             >> factionChangeInfo.FacialHair
-             >> factionChangeInfo.Face
-             >> factionChangeInfo.Race;
-
-    ObjectGuid::LowType lowGuid = factionChangeInfo.Guid.GetCounter();
+    recvData >> factionChangeInfo->Name
+             >> factionChangeInfo->Gender
+             >> factionChangeInfo->Skin
+             >> factionChangeInfo->HairColor
+             >> factionChangeInfo->HairStyle
+             >> factionChangeInfo->FacialHair
+             >> factionChangeInfo->Face
+             >> factionChangeInfo->Race;
 
     // get the players old (at this moment current) race
-    CharacterInfo const* nameData = sWorld->GetCharacterInfo(factionChangeInfo.Guid);
+    CharacterInfo const* nameData = sWorld->GetCharacterInfo(factionChangeInfo->Guid);
     if (!nameData)
     {
-        SendCharFactionChange(CHAR_CREATE_ERROR, factionChangeInfo);
+        SendCharFactionChange(CHAR_CREATE_ERROR, *factionChangeInfo);
         return;
     }
 
-    uint8 oldRace = nameData->Race;
-    uint8 playerClass = nameData->Class;
-    uint8 level = nameData->Level;
+    factionChangeInfo->OldRace = nameData->Race;
+    factionChangeInfo->Class = nameData->Class;
+    factionChangeInfo->Level = nameData->Level;
+    factionChangeInfo->Opcode = recvData.GetOpcode();
 
-    // TO Do: Make async
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_AT_LOGIN_TITLES);
-    stmt->setUInt32(0, lowGuid);
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
+    stmt->setUInt32(0, factionChangeInfo->Guid.GetCounter());
+
+    _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, factionChangeInfo](PreparedQueryResult result)
+    {
+        HandleCharFactionOrRaceChangeCallback(result, factionChangeInfo);
+    });
+}
 
+void WorldSession::HandleCharFactionOrRaceChangeCallback(PreparedQueryResult result, std::shared_ptr<CharacterFactionChangeInfo> factionChangeInfo)
+{
     if (!result)
     {
-        SendCharFactionChange(CHAR_CREATE_ERROR, factionChangeInfo);
+        SendCharFactionChange(CHAR_CREATE_ERROR, *factionChangeInfo);
         return;
     }
 
     Field* fields = result->Fetch();
-    uint32 at_loginFlags = fields[0].GetUInt16();
-    std::string knownTitlesStr = fields[1].GetString();
-    uint32 used_loginFlag = ((recvData.GetOpcode() == CMSG_CHAR_RACE_CHANGE) ? AT_LOGIN_CHANGE_RACE : AT_LOGIN_CHANGE_FACTION);
+    factionChangeInfo->AtLoginFlags = fields[0].GetUInt16();
+    factionChangeInfo->KnownTitles = fields[1].GetString();
+    factionChangeInfo->GuildId = fields[2].GetUInt32();
+
+    uint32 used_loginFlag = ((factionChangeInfo->Opcode == CMSG_CHAR_RACE_CHANGE) ? AT_LOGIN_CHANGE_RACE : AT_LOGIN_CHANGE_FACTION);
 
-    if (!sObjectMgr->GetPlayerInfo(factionChangeInfo.Race, playerClass))
+    if (!sObjectMgr->GetPlayerInfo(factionChangeInfo->Race, factionChangeInfo->Class))
     {
-        SendCharFactionChange(CHAR_CREATE_ERROR, factionChangeInfo);
+        SendCharFactionChange(CHAR_CREATE_ERROR, *factionChangeInfo);
         return;
     }
 
-    if (!(at_loginFlags & used_loginFlag))
+    if (!(factionChangeInfo->AtLoginFlags & used_loginFlag))
     {
-        SendCharFactionChange(CHAR_CREATE_ERROR, factionChangeInfo);
+        SendCharFactionChange(CHAR_CREATE_ERROR, *factionChangeInfo);
         return;
     }
 
     if (!HasPermission(rbac::RBAC_PERM_SKIP_CHECK_CHARACTER_CREATION_RACEMASK))
     {
         uint32 raceMaskDisabled = sWorld->getIntConfig(CONFIG_CHARACTER_CREATING_DISABLED_RACEMASK);
-        if ((1 << (factionChangeInfo.Race - 1)) & raceMaskDisabled)
+        if ((1 << (factionChangeInfo->Race - 1)) & raceMaskDisabled)
         {
-            SendCharFactionChange(CHAR_CREATE_ERROR, factionChangeInfo);
+            SendCharFactionChange(CHAR_CREATE_ERROR, *factionChangeInfo);
             return;
         }
     }
 
     // prevent character rename to invalid name
-    if (!normalizePlayerName(factionChangeInfo.Name))
+    if (!normalizePlayerName(factionChangeInfo->Name))
     {
-        SendCharFactionChange(CHAR_NAME_NO_NAME, factionChangeInfo);
+        SendCharFactionChange(CHAR_NAME_NO_NAME, *factionChangeInfo);
         return;
     }
 
-    ResponseCodes res = ObjectMgr::CheckPlayerName(factionChangeInfo.Name, GetSessionDbcLocale(), true);
+    ResponseCodes res = ObjectMgr::CheckPlayerName(factionChangeInfo->Name, GetSessionDbcLocale(), true);
     if (res != CHAR_NAME_SUCCESS)
     {
-        SendCharFactionChange(res, factionChangeInfo);
+        SendCharFactionChange(res, *factionChangeInfo);
         return;
     }
 
     // check name limitations
-    if (!HasPermission(rbac::RBAC_PERM_SKIP_CHECK_CHARACTER_CREATION_RESERVEDNAME) && sObjectMgr->IsReservedName(factionChangeInfo.Name))
+    if (!HasPermission(rbac::RBAC_PERM_SKIP_CHECK_CHARACTER_CREATION_RESERVEDNAME) && sObjectMgr->IsReservedName(factionChangeInfo->Name))
     {
-        SendCharFactionChange(CHAR_NAME_RESERVED, factionChangeInfo);
+        SendCharFactionChange(CHAR_NAME_RESERVED, *factionChangeInfo);
         return;
     }
 
     // character with this name already exist
-    if (ObjectGuid newGuid = sObjectMgr->GetPlayerGUIDByName(factionChangeInfo.Name))
+    if (ObjectGuid newGuid = sObjectMgr->GetPlayerGUIDByName(factionChangeInfo->Name))
     {
-        if (newGuid != factionChangeInfo.Guid)
+        if (newGuid != factionChangeInfo->Guid)
         {
-            SendCharFactionChange(CHAR_CREATE_NAME_IN_USE, factionChangeInfo);
+            SendCharFactionChange(CHAR_CREATE_NAME_IN_USE, *factionChangeInfo);
             return;
         }
     }
 
+    // the old standings are needed to keep the final reputation values across the faction change
+    if (factionChangeInfo->Opcode == CMSG_CHAR_FACTION_CHANGE && factionChangeInfo->OldRace != factionChangeInfo->Race)
+    {
+        PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_REPUTATION);
+        stmt->setUInt32(0, factionChangeInfo->Guid.GetCounter());
+
+        _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, factionChangeInfo](PreparedQueryResult result)
+        {
+            if (result)
+            {
+                do
+                {
+                    Field* fields = result->Fetch();
+                    factionChangeInfo->Reputations[fields[0].GetUInt16()] = fields[1].GetInt32();
+                } while (result->NextRow());
+            }
+
+            FinishCharFactionOrRaceChange(factionChangeInfo);
+        });
+        return;
+    }
+
+    FinishCharFactionOrRaceChange(factionChangeInfo);
+}
+
+void WorldSession::FinishCharFactionOrRaceChange(std::shared_ptr<CharacterFactionChangeInfo> factionChangeInfo)
+{
+    ObjectGuid::LowType lowGuid = factionChangeInfo->Guid.GetCounter();
+    uint8 oldRace = factionChangeInfo->OldRace;
+    uint8 playerClass = factionChangeInfo->Class;
+    uint8 level = factionChangeInfo->Level;
+    uint32 used_loginFlag = ((factionChangeInfo->Opcode == CMSG_CHAR_RACE_CHANGE) ? AT_LOGIN_CHANGE_RACE : AT_LOGIN_CHANGE_FACTION);
+
     SQLTransaction trans = CharacterDatabase.BeginTransaction();
 
     // resurrect the character in case he's dead
-    Player::OfflineResurrect(factionChangeInfo.Guid, trans);
+    Player::OfflineResurrect(factionChangeInfo->Guid, trans);
 
-    CharacterDatabase.EscapeString(factionChangeInfo.Name);
-    Player::Customize(&factionChangeInfo, trans);
+    CharacterDatabase.EscapeString(factionChangeInfo->Name);
+    Player::Customize(factionChangeInfo.get(), trans);
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_FACTION_OR_RACE);
-    stmt->setString(0, factionChangeInfo.Name);
-    stmt->setUInt8(1, factionChangeInfo.Race);
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_FACTION_OR_RACE);
+    stmt->setString(0, factionChangeInfo->Name);
+    stmt->setUInt8(1, factionChangeInfo->Race);
     stmt->setUInt16(2, used_loginFlag);
     stmt->setUInt32(3, lowGuid);
     trans->Append(stmt);
@@ -1692,14 +1718,14 @@ void WorldSession::HandleCharFactionOrRaceChange(WorldPacket& recvData)
     stmt->setUInt32(0, lowGuid);
     trans->Append(stmt);
 
-    sWorld->UpdateCharacterInfo(factionChangeInfo.Guid, factionChangeInfo.Name, factionChangeInfo.Gender, factionChangeInfo.Race);
+    sWorld->UpdateCharacterInfo(factionChangeInfo->Guid, factionChangeInfo->Name, factionChangeInfo->Gender, factionChangeInfo->Race);
 
-    if (oldRace != factionChangeInfo.Race)
+    if (oldRace != factionChangeInfo->Race)
     {
         TeamId team = TEAM_ALLIANCE;
 
         // Search each faction is targeted
-        switch (factionChangeInfo.Race)
+        switch (factionChangeInfo->Race)
         {
             case RACE_ORC:
             case RACE_TAUREN:
@@ -1731,12 +1757,12 @@ void WorldSession::HandleCharFactionOrRaceChange(WorldPacket& recvData)
         trans->Append(stmt);
 
         // Race specific languages
-        if (factionChangeInfo.Race != RACE_ORC && factionChangeInfo.Race != RACE_HUMAN)
+        if (factionChangeInfo->Race != RACE_ORC && factionChangeInfo->Race != RACE_HUMAN)
         {
             stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_CHAR_SKILL_LANGUAGE);
             stmt->setUInt32(0, lowGuid);
 
-            switch (factionChangeInfo.Race)
+            switch (factionChangeInfo->Race)
             {
                 case RACE_DWARF:
                     stmt->setUInt16(1, 111);
@@ -1767,7 +1793,7 @@ void WorldSession::HandleCharFactionOrRaceChange(WorldPacket& recvData)
             trans->Append(stmt);
         }
 
-        if (recvData.GetOpcode() == CMSG_CHAR_FACTION_CHANGE)
+        if (factionChangeInfo->Opcode == CMSG_CHAR_FACTION_CHANGE)
         {
             // Delete all Flypaths
             stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_CHAR_TAXI_PATH);
@@ -1821,20 +1847,13 @@ void WorldSession::HandleCharFactionOrRaceChange(WorldPacket& recvData)
                 trans->Append(stmt);
             }
 
-            /// @todo: make this part async
             if (!sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_GUILD))
             {
                 // Reset guild
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_GUILD_MEMBER);
+                if (Guild* guild = sGuildMgr->GetGuildById(factionChangeInfo->GuildId))
+                    guild->DeleteMember(factionChangeInfo->Guid, false, false, true);
 
-                stmt->setUInt32(0, lowGuid);
-
-                PreparedQueryResult result = CharacterDatabase.Query(stmt);
-                if (result)
-                    if (Guild* guild = sGuildMgr->GetGuildById((result->Fetch()[0]).GetUInt32()))
-                        guild->DeleteMember(factionChangeInfo.Guid, false, false, true);
-
-                Player::LeaveAllArenaTeams(factionChangeInfo.Guid);
+                Player::LeaveAllArenaTeams(factionChangeInfo->Guid);
             }
 
             if (!HasPermission(rbac::RBAC_PERM_TWO_SIDE_ADD_FRIEND))
@@ -1877,7 +1896,7 @@ void WorldSession::HandleCharFactionOrRaceChange(WorldPacket& recvData)
             stmt->setFloat(5, loc.GetPositionZ());
             trans->Append(stmt);
 
-            Player::SavePositionInDB(loc, zoneId, factionChangeInfo.Guid, trans);
+            Player::SavePositionInDB(loc, zoneId, factionChangeInfo->Guid, trans);
 
             // Achievement conversion
             for (std::map<uint32, uint32>::const_iterator it = sObjectMgr->FactionChangeAchievements.begin(); it != sObjectMgr->FactionChangeAchievements.end(); ++it)
@@ -1981,22 +2000,18 @@ void WorldSession::HandleCharFactionOrRaceChange(WorldPacket& recvData)
                 uint32 newReputation = (team == TEAM_ALLIANCE) ? reputation_alliance : reputation_horde;
                 uint32 oldReputation = (team == TEAM_ALLIANCE) ? reputation_horde : reputation_alliance;
 
-                // select old standing set in db
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_REP_BY_FACTION);
-                stmt->setUInt32(0, oldReputation);
-                stmt->setUInt32(1, lowGuid);
-
-                if (PreparedQueryResult reputationResult = CharacterDatabase.Query(stmt))
+                // old standing set in db
+                std::unordered_map<uint32, int32>::const_iterator repItr = factionChangeInfo->Reputations.find(oldReputation);
+                if (repItr != factionChangeInfo->Reputations.end())
                 {
-                    fields = reputationResult->Fetch();
-                    int32 oldDBRep = fields[0].GetInt32();
+                    int32 oldDBRep = repItr->second;
                     FactionEntry const* factionEntry = sFactionStore.LookupEntry(oldReputation);
 
                     // old base reputation
                     int32 oldBaseRep = sObjectMgr->GetBaseReputationOf(factionEntry, oldRace, playerClass);
 
                     // new base reputation
-                    int32 newBaseRep = sObjectMgr->GetBaseReputationOf(sFactionStore.LookupEntry(newReputation), factionChangeInfo.Race, playerClass);
+                    int32 newBaseRep = sObjectMgr->GetBaseReputationOf(sFactionStore.LookupEntry(newReputation), factionChangeInfo->Race, playerClass);
 
                     // final reputation shouldnt change
                     int32 FinalRep = oldDBRep + oldBaseRep;
@@ -2017,15 +2032,15 @@ void WorldSession::HandleCharFactionOrRaceChange(WorldPacket& recvData)
             }
 
             // Title conversion
-            if (!knownTitlesStr.empty())
+            if (!factionChangeInfo->KnownTitles.empty())
             {
                 const uint32 ktcount = KNOWN_TITLES_SIZE * 2;
                 uint32 knownTitles[ktcount];
-                Tokenizer tokens(knownTitlesStr, ' ', ktcount);
+                Tokenizer tokens(factionChangeInfo->KnownTitles, ' ', ktcount);
 
                 if (tokens.size() != ktcount)
                 {
-                    SendCharFactionChange(CHAR_CREATE_ERROR, factionChangeInfo);
+                    SendCharFactionChange(CHAR_CREATE_ERROR, *factionChangeInfo);
                     return;
                 }
 
@@ -2087,9 +2102,9 @@ void WorldSession::HandleCharFactionOrRaceChange(WorldPacket& recvData)
 
     CharacterDatabase.CommitTransaction(trans);
 
-    TC_LOG_DEBUG("entities.player", "%s (IP: %s) changed race from %u to %u", GetPlayerInfo().c_str(), GetRemoteAddress().c_str(), oldRace, factionChangeInfo.Race);
+    TC_LOG_DEBUG("entities.player", "%s (IP: %s) changed race from %u to %u", GetPlayerInfo().c_str(), GetRemoteAddress().c_str(), oldRace, factionChangeInfo->Race);
 
-    SendCharFactionChange(RESPONSE_SUCCESS, factionChangeInfo);
+    SendCharFactionChange(RESPONSE_SUCCESS, *factionChangeInfo);
 }
 
 void WorldSession::SendCharCreate(ResponseCodes result)
@@ -25,6 +25,7 @@
 #include "Player.h"
 #include "Item.h"
 #include "SpellInfo.h"
+#include "QueryResponseCache.h"
 
 void WorldSession::HandleSplitItemOpcode(WorldPacket& recvData)
 {
@@ -311,6 +312,9 @@ void WorldSession::HandleItemQuerySingleOpcode(WorldPacket& recvData)
     ItemTemplate const* pProto = sObjectMgr->GetItemTemplate(item);
     if (pProto)
     {
+        if (SendCachedQueryResponse(QUERY_RESPONSE_ITEM, item))
+            return;
+
         std::string Name        = pProto->Name1;
         std::string Description = pProto->Description;
 
@@ -449,6 +453,7 @@ void WorldSession::HandleItemQuerySingleOpcode(WorldPacket& recvData)
         data << pProto->ItemLimitCategory;                  // WotLK, ItemLimitCategory
         data << pProto->HolidayId;                          // Holiday.dbc?
         SendPacket(&data);
+        sQueryResponseCache->Store(QUERY_RESPONSE_ITEM, item, GetSessionDbLocaleIndex(), data);
     }
     else
     {
@@ -200,30 +200,28 @@ void WorldSession::HandlePetitionBuyOpcode(WorldPacket& recvData)
     // a petition is invalid, if both the owner and the type matches
     // we checked above, if this player is in an arenateam, so this must be
     // datacorruption
-    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_BY_OWNER);
+    CharacterDatabase.EscapeString(name);
+    SQLTransaction trans = CharacterDatabase.BeginTransaction();
+
+    // signatures go first, they are matched through the petitions deleted below
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PETITION_SIGNATURES_BY_OWNER_PETITIONS);
     stmt->setUInt32(0, _player->GetGUID().GetCounter());
     stmt->setUInt8(1, type);
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-    std::ostringstream ssInvalidPetitionGUIDs;
+    trans->Append(stmt);
 
-    if (result)
-    {
-        do
-        {
-            Field* fields = result->Fetch();
-            ssInvalidPetitionGUIDs << '\'' << fields[0].GetUInt32() << "', ";
-        } while (result->NextRow());
-    }
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PETITION_BY_OWNER_AND_TYPE);
+    stmt->setUInt32(0, _player->GetGUID().GetCounter());
+    stmt->setUInt8(1, type);
+    trans->Append(stmt);
 
     // delete petitions with the same guid as this one
-    ssInvalidPetitionGUIDs << '\'' << charter->GetGUID().GetCounter() << '\'';
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PETITION_SIGNATURE_BY_GUID);
+    stmt->setUInt32(0, charter->GetGUID().GetCounter());
+    trans->Append(stmt);
 
-    TC_LOG_DEBUG("network", "Invalid petition GUIDs: %s", ssInvalidPetitionGUIDs.str().c_str());
-    CharacterDatabase.EscapeString(name);
-    SQLTransaction trans = CharacterDatabase.BeginTransaction();
-    trans->PAppend("DELETE FROM petition WHERE petitionguid IN (%s)",  ssInvalidPetitionGUIDs.str().c_str());
-    trans->PAppend("DELETE FROM petition_sign WHERE petitionguid IN (%s)", ssInvalidPetitionGUIDs.str().c_str());
+    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PETITION_BY_GUID);
+    stmt->setUInt32(0, charter->GetGUID().GetCounter());
+    trans->Append(stmt);
 
     stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PETITION);
     stmt->setUInt32(0, _player->GetGUID().GetCounter());
@@ -235,63 +233,63 @@ void WorldSession::HandlePetitionBuyOpcode(WorldPacket& recvData)
     CharacterDatabase.CommitTransaction(trans);
 }
 
+static void BuildPetitionSignaturesPacket(WorldPacket& data, ObjectGuid petitionGuid, ObjectGuid ownerGuid, PreparedQueryResult result)
+{
+    // result == NULL also correct charter without signs
+    uint8 signs = result ? uint8(result->GetRowCount()) : 0;
+
+    data.Initialize(SMSG_PETITION_SHOW_SIGNATURES, (8+8+4+1+signs*12));
+    data << uint64(petitionGuid);                           // petition guid
+    data << uint64(ownerGuid);                              // owner guid
+    data << uint32(petitionGuid.GetCounter());              // guild guid
+    data << uint8(signs);                                   // sign's count
+
+    for (uint8 i = 1; i <= signs; ++i)
+    {
+        Field* fields = result->Fetch();
+        data << uint64(ObjectGuid(HighGuid::Player, fields[0].GetUInt32())); // Player GUID
+        data << uint32(0);                                  // there 0 ...
+
+        result->NextRow();
+    }
+}
+
 void WorldSession::HandlePetitionShowSignOpcode(WorldPacket& recvData)
 {
     TC_LOG_DEBUG("network", "Received opcode CMSG_PETITION_SHOW_SIGNATURES");
 
-    uint8 signs = 0;
     ObjectGuid petitionguid;
     recvData >> petitionguid;                              // petition guid
 
-    ObjectGuid::LowType petitionGuidLow = petitionguid.GetCounter();
-
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_TYPE);
+    stmt->setUInt32(0, petitionguid.GetCounter());
 
-    stmt->setUInt32(0, petitionGuidLow);
-
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-    if (!result)
+    _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, petitionguid](PreparedQueryResult result)
     {
-        TC_LOG_DEBUG("entities.player.items", "Petition %s is not found for player %u %s", petitionguid.ToString().c_str(), GetPlayer()->GetGUID().GetCounter(), GetPlayer()->GetName().c_str());
-        return;
-    }
-    Field* fields = result->Fetch();
-    uint32 type = fields[0].GetUInt8();
-
-    // if guild petition and has guild => error, return;
-    if (type == GUILD_CHARTER_TYPE && _player->GetGuildId())
-        return;
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIGNATURE);
-
-    stmt->setUInt32(0, petitionGuidLow);
-
-    result = CharacterDatabase.Query(stmt);
-
-    // result == NULL also correct in case no sign yet
-    if (result)
-        signs = uint8(result->GetRowCount());
+        if (!result)
+        {
+            TC_LOG_DEBUG("entities.player.items", "Petition %s is not found for player %u %s", petitionguid.ToString().c_str(), GetPlayer()->GetGUID().GetCounter(), GetPlayer()->GetName().c_str());
+            return;
+        }
 
-    TC_LOG_DEBUG("network", "CMSG_PETITION_SHOW_SIGNATURES petition entry: '%u'", petitionGuidLow);
+        uint32 type = result->Fetch()[0].GetUInt8();
 
-    WorldPacket data(SMSG_PETITION_SHOW_SIGNATURES, (8+8+4+1+signs*12));
-    data << uint64(petitionguid);                           // petition guid
-    data << uint64(_player->GetGUID());                     // owner guid
-    data << uint32(petitionGuidLow);                        // guild guid
-    data << uint8(signs);                                   // sign's count
+        // if guild petition and has guild => error, return;
+        if (type == GUILD_CHARTER_TYPE && _player->GetGuildId())
+            return;
 
-    for (uint8 i = 1; i <= signs; ++i)
-    {
-        Field* fields2 = result->Fetch();
-        ObjectGuid::LowType lowGuid = fields2[0].GetUInt32();
+        PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIGNATURE);
+        stmt->setUInt32(0, petitionguid.GetCounter());
 
-        data << ObjectGuid(HighGuid::Player, 0, lowGuid);    // Player GUID
-        data << uint32(0);                                  // there 0 ...
+        _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, petitionguid](PreparedQueryResult result)
+        {
+            TC_LOG_DEBUG("network", "CMSG_PETITION_SHOW_SIGNATURES petition entry: '%u'", petitionguid.GetCounter());
 
-        result->NextRow();
-    }
-    SendPacket(&data);
+            WorldPacket data;
+            BuildPetitionSignaturesPacket(data, petitionguid, _player->GetGUID(), result);
+            SendPacket(&data);
+        });
+    });
 }
 
 void WorldSession::HandlePetitionQueryOpcode(WorldPacket& recvData)
@@ -309,64 +307,59 @@ void WorldSession::HandlePetitionQueryOpcode(WorldPacket& recvData)
 
 void WorldSession::SendPetitionQueryOpcode(ObjectGuid petitionguid)
 {
-    ObjectGuid ownerguid;
-    uint32 type;
-    std::string name = "NO_NAME_FOR_GUID";
-
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION);
 
     stmt->setUInt32(0, petitionguid.GetCounter());
 
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-    if (result)
+    _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, petitionguid](PreparedQueryResult result)
     {
-        Field* fields = result->Fetch();
-        ownerguid = ObjectGuid(HighGuid::Player, fields[0].GetUInt32());
-        name      = fields[1].GetString();
-        type      = fields[2].GetUInt8();
-    }
-    else
-    {
-        TC_LOG_DEBUG("network", "CMSG_PETITION_QUERY failed for petition (%s)", petitionguid.ToString().c_str());
-        return;
-    }
+        if (!result)
+        {
+            TC_LOG_DEBUG("network", "CMSG_PETITION_QUERY failed for petition (%s)", petitionguid.ToString().c_str());
+            return;
+        }
 
-    WorldPacket data(SMSG_PETITION_QUERY_RESPONSE, (4+8+name.size()+1+1+4*12+2+10));
-    data << uint32(petitionguid.GetCounter());              // guild/team guid (in Trinity always same as GUID_LOPART(petition guid)
-    data << uint64(ownerguid);                              // charter owner guid
-    data << name;                                           // name (guild/arena team)
-    data << uint8(0);                                       // some string
-    if (type == GUILD_CHARTER_TYPE)
-    {
-        uint32 needed = sWorld->getIntConfig(CONFIG_MIN_PETITION_SIGNS);
-        data << uint32(needed);
-        data << uint32(needed);
-        data << uint32(0);                                  // bypass client - side limitation, a different value is needed here for each petition
-    }
-    else
-    {
-        data << uint32(type-1);
-        data << uint32(type-1);
-        data << uint32(type);                               // bypass client - side limitation, a different value is needed here for each petition
-    }
-    data << uint32(0);                                      // 5
-    data << uint32(0);                                      // 6
-    data << uint32(0);                                      // 7
-    data << uint32(0);                                      // 8
-    data << uint16(0);                                      // 9 2 bytes field
-    data << uint32(0);                                      // 10
-    data << uint32(0);                                      // 11
-    data << uint32(0);                                      // 13 count of next strings?
+        Field* fields = result->Fetch();
+        ObjectGuid ownerguid(HighGuid::Player, fields[0].GetUInt32());
+        std::string name = fields[1].GetString();
+        uint32 type = fields[2].GetUInt8();
+
+        WorldPacket data(SMSG_PETITION_QUERY_RESPONSE, (4+8+name.size()+1+1+4*12+2+10));
+        data << uint32(petitionguid.GetCounter());              // guild/team guid (in Trinity always same as GUID_LOPART(petition guid)
+        data << uint64(ownerguid);                              // charter owner guid
+        data << name;                                           // name (guild/arena team)
+        data << uint8(0);                                       // some string
+        if (type == GUILD_CHARTER_TYPE)
+        {
+            uint32 needed = sWorld->getIntConfig(CONFIG_MIN_PETITION_SIGNS);
+            data << uint32(needed);
+            data << uint32(needed);
+            data << uint32(0);                                  // bypass client - side limitation, a different value is needed here for each petition
+        }
+        else
+        {
+            data << uint32(type-1);
+            data << uint32(type-1);
+            data << uint32(type);                               // bypass client - side limitation, a different value is needed here for each petition
+        }
+        data << uint32(0);                                      // 5
+        data << uint32(0);                                      // 6
+        data << uint32(0);                                      // 7
+        data << uint32(0);                                      // 8
+        data << uint16(0);                                      // 9 2 bytes field
+        data << uint32(0);                                      // 10
+        data << uint32(0);                                      // 11
+        data << uint32(0);                                      // 13 count of next strings?
 
-    for (int i = 0; i < 10; ++i)
-        data << uint8(0);                                   // some string
+        for (int i = 0; i < 10; ++i)
+            data << uint8(0);                                   // some string
 
-    data << uint32(0);                                      // 14
+        data << uint32(0);                                      // 14
 
-    data << uint32(type != GUILD_CHARTER_TYPE);             // 15 0 - guild, 1 - arena team
+        data << uint32(type != GUILD_CHARTER_TYPE);             // 15 0 - guild, 1 - arena team
 
-    SendPacket(&data);
+        SendPacket(&data);
+    });
 }
 
 void WorldSession::HandlePetitionRenameOpcode(WorldPacket& recvData)
@@ -374,7 +367,6 @@ void WorldSession::HandlePetitionRenameOpcode(WorldPacket& recvData)
     TC_LOG_DEBUG("network", "Received opcode MSG_PETITION_RENAME");   // ok
 
     ObjectGuid petitionGuid;
-    uint32 type;
     std::string newName;
 
     recvData >> petitionGuid;                              // guid
@@ -388,65 +380,66 @@ void WorldSession::HandlePetitionRenameOpcode(WorldPacket& recvData)
 
     stmt->setUInt32(0, petitionGuid.GetCounter());
 
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-    if (result)
-    {
-        Field* fields = result->Fetch();
-        type = fields[0].GetUInt8();
-    }
-    else
-    {
-        TC_LOG_DEBUG("network", "CMSG_PETITION_QUERY failed for petition %s", petitionGuid.ToString().c_str());
-        return;
-    }
-
-    if (type == GUILD_CHARTER_TYPE)
+    _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, petitionGuid, newName](PreparedQueryResult result)
     {
-        if (sGuildMgr->GetGuildByName(newName))
+        if (!result)
         {
-            Guild::SendCommandResult(this, GUILD_COMMAND_CREATE, ERR_GUILD_NAME_EXISTS_S, newName);
+            TC_LOG_DEBUG("network", "CMSG_PETITION_QUERY failed for petition %s", petitionGuid.ToString().c_str());
             return;
         }
-        if (sObjectMgr->IsReservedName(newName) || !ObjectMgr::IsValidCharterName(newName))
-        {
-            Guild::SendCommandResult(this, GUILD_COMMAND_CREATE, ERR_GUILD_NAME_INVALID, newName);
+
+        // the charter may have been destroyed while the type was looked up
+        if (!_player->GetItemByGuid(petitionGuid))
             return;
-        }
-    }
-    else
-    {
-        if (sArenaTeamMgr->GetArenaTeamByName(newName))
+
+        uint32 type = result->Fetch()[0].GetUInt8();
+
+        if (type == GUILD_CHARTER_TYPE)
         {
-            SendArenaTeamCommandResult(ERR_ARENA_TEAM_CREATE_S, newName, "", ERR_ARENA_TEAM_NAME_EXISTS_S);
-            return;
+            if (sGuildMgr->GetGuildByName(newName))
+            {
+                Guild::SendCommandResult(this, GUILD_COMMAND_CREATE, ERR_GUILD_NAME_EXISTS_S, newName);
+                return;
+            }
+            if (sObjectMgr->IsReservedName(newName) || !ObjectMgr::IsValidCharterName(newName))
+            {
+                Guild::SendCommandResult(this, GUILD_COMMAND_CREATE, ERR_GUILD_NAME_INVALID, newName);
+                return;
+            }
         }
-        if (sObjectMgr->IsReservedName(newName) || !ObjectMgr::IsValidCharterName(newName))
+        else
         {
-            SendArenaTeamCommandResult(ERR_ARENA_TEAM_CREATE_S, newName, "", ERR_ARENA_TEAM_NAME_INVALID);
-            return;
+            if (sArenaTeamMgr->GetArenaTeamByName(newName))
+            {
+                SendArenaTeamCommandResult(ERR_ARENA_TEAM_CREATE_S, newName, "", ERR_ARENA_TEAM_NAME_EXISTS_S);
+                return;
+            }
+            if (sObjectMgr->IsReservedName(newName) || !ObjectMgr::IsValidCharterName(newName))
+            {
+                SendArenaTeamCommandResult(ERR_ARENA_TEAM_CREATE_S, newName, "", ERR_ARENA_TEAM_NAME_INVALID);
+                return;
+            }
         }
-    }
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_PETITION_NAME);
+        PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_PETITION_NAME);
 
-    stmt->setString(0, newName);
-    stmt->setUInt32(1, petitionGuid.GetCounter());
+        stmt->setString(0, newName);
+        stmt->setUInt32(1, petitionGuid.GetCounter());
 
-    CharacterDatabase.Execute(stmt);
+        CharacterDatabase.Execute(stmt);
 
-    TC_LOG_DEBUG("network", "Petition %s renamed to '%s'", petitionGuid.ToString().c_str(), newName.c_str());
-    WorldPacket data(MSG_PETITION_RENAME, (8+newName.size()+1));
-    data << uint64(petitionGuid);
-    data << newName;
-    SendPacket(&data);
+        TC_LOG_DEBUG("network", "Petition %s renamed to '%s'", petitionGuid.ToString().c_str(), newName.c_str());
+        WorldPacket data(MSG_PETITION_RENAME, (8+newName.size()+1));
+        data << uint64(petitionGuid);
+        data << newName;
+        SendPacket(&data);
+    });
 }
 
 void WorldSession::HandlePetitionSignOpcode(WorldPacket& recvData)
 {
     TC_LOG_DEBUG("network", "Received opcode CMSG_PETITION_SIGN");    // ok
 
-    Field* fields;
     ObjectGuid petitionGuid;
     uint8 unk;
     recvData >> petitionGuid;                              // petition guid
@@ -457,126 +450,129 @@ void WorldSession::HandlePetitionSignOpcode(WorldPacket& recvData)
     stmt->setUInt32(0, petitionGuid.GetCounter());
     stmt->setUInt32(1, petitionGuid.GetCounter());
 
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-    if (!result)
-    {
-        TC_LOG_ERROR("network", "Petition %s is not found for player %u %s", petitionGuid.ToString().c_str(), GetPlayer()->GetGUID().GetCounter(), GetPlayer()->GetName().c_str());
-        return;
-    }
-
-    fields = result->Fetch();
-    ObjectGuid ownerGuid(HighGuid::Player, fields[0].GetUInt32());
-    uint64 signs = fields[1].GetUInt64();
-    uint8 type = fields[2].GetUInt8();
-
-    ObjectGuid::LowType playerGuid = _player->GetGUID().GetCounter();
-    if (ownerGuid == _player->GetGUID())
-        return;
-
-    // not let enemies sign guild charter
-    if (!sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_GUILD) && GetPlayer()->GetTeam() != sObjectMgr->GetPlayerTeamByGUID(ownerGuid))
-    {
-        if (type != GUILD_CHARTER_TYPE)
-            SendArenaTeamCommandResult(ERR_ARENA_TEAM_INVITE_SS, "", "", ERR_ARENA_TEAM_NOT_ALLIED);
-        else
-            Guild::SendCommandResult(this, GUILD_COMMAND_CREATE, ERR_GUILD_NOT_ALLIED);
-        return;
-    }
-
-    if (type != GUILD_CHARTER_TYPE)
+    _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, petitionGuid](PreparedQueryResult result)
     {
-        if (_player->getLevel() < sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL))
+        if (!result)
         {
-            SendArenaTeamCommandResult(ERR_ARENA_TEAM_CREATE_S, "", _player->GetName().c_str(), ERR_ARENA_TEAM_TARGET_TOO_LOW_S);
+            TC_LOG_ERROR("network", "Petition %s is not found for player %u %s", petitionGuid.ToString().c_str(), GetPlayer()->GetGUID().GetCounter(), GetPlayer()->GetName().c_str());
             return;
         }
 
-        uint8 slot = ArenaTeam::GetSlotByType(type);
-        if (slot >= MAX_ARENA_SLOT)
-            return;
+        Field* fields = result->Fetch();
+        ObjectGuid ownerGuid(HighGuid::Player, fields[0].GetUInt32());
+        uint64 signs = fields[1].GetUInt64();
+        uint8 type = fields[2].GetUInt8();
 
-        if (_player->GetArenaTeamId(slot))
-        {
-            SendArenaTeamCommandResult(ERR_ARENA_TEAM_INVITE_SS, "", _player->GetName().c_str(), ERR_ALREADY_IN_ARENA_TEAM_S);
+        if (ownerGuid == _player->GetGUID())
             return;
-        }
 
-        if (_player->GetArenaTeamIdInvited())
+        // not let enemies sign guild charter
+        if (!sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_GUILD) && GetPlayer()->GetTeam() != sObjectMgr->GetPlayerTeamByGUID(ownerGuid))
         {
-            SendArenaTeamCommandResult(ERR_ARENA_TEAM_INVITE_SS, "", _player->GetName().c_str(), ERR_ALREADY_INVITED_TO_ARENA_TEAM_S);
+            if (type != GUILD_CHARTER_TYPE)
+                SendArenaTeamCommandResult(ERR_ARENA_TEAM_INVITE_SS, "", "", ERR_ARENA_TEAM_NOT_ALLIED);
+            else
+                Guild::SendCommandResult(this, GUILD_COMMAND_CREATE, ERR_GUILD_NOT_ALLIED);
             return;
         }
-    }
-    else
-    {
-        if (_player->GetGuildId())
+
+        if (type != GUILD_CHARTER_TYPE)
         {
-            Guild::SendCommandResult(this, GUILD_COMMAND_INVITE, ERR_ALREADY_IN_GUILD_S, _player->GetName());
-            return;
+            if (_player->getLevel() < sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL))
+            {
+                SendArenaTeamCommandResult(ERR_ARENA_TEAM_CREATE_S, "", _player->GetName().c_str(), ERR_ARENA_TEAM_TARGET_TOO_LOW_S);
+                return;
+            }
+
+            uint8 slot = ArenaTeam::GetSlotByType(type);
+            if (slot >= MAX_ARENA_SLOT)
+                return;
+
+            if (_player->GetArenaTeamId(slot))
+            {
+                SendArenaTeamCommandResult(ERR_ARENA_TEAM_INVITE_SS, "", _player->GetName().c_str(), ERR_ALREADY_IN_ARENA_TEAM_S);
+                return;
+            }
+
+            if (_player->GetArenaTeamIdInvited())
+            {
+                SendArenaTeamCommandResult(ERR_ARENA_TEAM_INVITE_SS, "", _player->GetName().c_str(), ERR_ALREADY_INVITED_TO_ARENA_TEAM_S);
+                return;
+            }
         }
-        if (_player->GetGuildIdInvited())
+        else
         {
-            Guild::SendCommandResult(this, GUILD_COMMAND_INVITE, ERR_ALREADY_INVITED_TO_GUILD_S, _player->GetName());
-            return;
+            if (_player->GetGuildId())
+            {
+                Guild::SendCommandResult(this, GUILD_COMMAND_INVITE, ERR_ALREADY_IN_GUILD_S, _player->GetName());
+                return;
+            }
+            if (_player->GetGuildIdInvited())
+            {
+                Guild::SendCommandResult(this, GUILD_COMMAND_INVITE, ERR_ALREADY_INVITED_TO_GUILD_S, _player->GetName());
+                return;
+            }
         }
-    }
 
-    if (++signs > type)                                        // client signs maximum
-        return;
-
-    // Client doesn't allow to sign petition two times by one character, but not check sign by another character from same account
-    // not allow sign another player from already sign player account
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIG_BY_ACCOUNT);
-
-    stmt->setUInt32(0, GetAccountId());
-    stmt->setUInt32(1, petitionGuid.GetCounter());
+        if (++signs > type)                                        // client signs maximum
+            return;
 
-    result = CharacterDatabase.Query(stmt);
+        // Client doesn't allow to sign petition two times by one character, but not check sign by another character from same account
+        // not allow sign another player from already sign player account
+        PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIG_BY_ACCOUNT);
 
-    if (result)
-    {
-        WorldPacket data(SMSG_PETITION_SIGN_RESULTS, (8+8+4));
-        data << uint64(petitionGuid);
-        data << uint64(_player->GetGUID());
-        data << (uint32)PETITION_SIGN_ALREADY_SIGNED;
+        stmt->setUInt32(0, GetAccountId());
+        stmt->setUInt32(1, petitionGuid.GetCounter());
 
-        // close at signer side
-        SendPacket(&data);
+        _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, petitionGuid, ownerGuid](PreparedQueryResult result)
+        {
+            if (result)
+            {
+                WorldPacket data(SMSG_PETITION_SIGN_RESULTS, (8+8+4));
+                data << uint64(petitionGuid);
+                data << uint64(_player->GetGUID());
+                data << (uint32)PETITION_SIGN_ALREADY_SIGNED;
+
+                // close at signer side
+                SendPacket(&data);
+
+                // update for owner if online
+                if (Player* owner = ObjectAccessor::FindConnectedPlayer(ownerGuid))
+                    owner->GetSession()->SendPacket(&data);
+                return;
+            }
 
-        // update for owner if online
-        if (Player* owner = ObjectAccessor::FindConnectedPlayer(ownerGuid))
-            owner->GetSession()->SendPacket(&data);
-        return;
-    }
+            ObjectGuid::LowType playerGuid = _player->GetGUID().GetCounter();
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PETITION_SIGNATURE);
+            PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_INS_PETITION_SIGNATURE);
 
-    stmt->setUInt32(0, ownerGuid.GetCounter());
-    stmt->setUInt32(1, petitionGuid.GetCounter());
-    stmt->setUInt32(2, playerGuid);
-    stmt->setUInt32(3, GetAccountId());
+            stmt->setUInt32(0, ownerGuid.GetCounter());
+            stmt->setUInt32(1, petitionGuid.GetCounter());
+            stmt->setUInt32(2, playerGuid);
+            stmt->setUInt32(3, GetAccountId());
 
-    CharacterDatabase.Execute(stmt);
+            CharacterDatabase.Execute(stmt);
 
-    TC_LOG_DEBUG("network", "PETITION SIGN: %s by player: %s (GUID: %u Account: %u)", petitionGuid.ToString().c_str(), _player->GetName().c_str(), playerGuid, GetAccountId());
+            TC_LOG_DEBUG("network", "PETITION SIGN: %s by player: %s (GUID: %u Account: %u)", petitionGuid.ToString().c_str(), _player->GetName().c_str(), playerGuid, GetAccountId());
 
-    WorldPacket data(SMSG_PETITION_SIGN_RESULTS, (8+8+4));
-    data << uint64(petitionGuid);
-    data << uint64(_player->GetGUID());
-    data << uint32(PETITION_SIGN_OK);
+            WorldPacket data(SMSG_PETITION_SIGN_RESULTS, (8+8+4));
+            data << uint64(petitionGuid);
+            data << uint64(_player->GetGUID());
+            data << uint32(PETITION_SIGN_OK);
 
-    // close at signer side
-    SendPacket(&data);
+            // close at signer side
+            SendPacket(&data);
 
-    // update signs count on charter, required testing...
-    //Item* item = _player->GetItemByGuid(petitionguid));
-    //if (item)
-    //    item->SetUInt32Value(ITEM_FIELD_ENCHANTMENT_1_1+1, signs);
+            // update signs count on charter, required testing...
+            //Item* item = _player->GetItemByGuid(petitionguid));
+            //if (item)
+            //    item->SetUInt32Value(ITEM_FIELD_ENCHANTMENT_1_1+1, signs);
 
-    // update for owner if online
-    if (Player* owner = ObjectAccessor::FindConnectedPlayer(ownerGuid))
-        owner->GetSession()->SendPacket(&data);
+            // update for owner if online
+            if (Player* owner = ObjectAccessor::FindConnectedPlayer(ownerGuid))
+                owner->GetSession()->SendPacket(&data);
+        });
+    });
 }
 
 void WorldSession::HandlePetitionDeclineOpcode(WorldPacket& recvData)
@@ -591,130 +587,120 @@ void WorldSession::HandlePetitionDeclineOpcode(WorldPacket& recvData)
 
     stmt->setUInt32(0, petitionguid.GetCounter());
 
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-    if (!result)
-        return;
+    _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this](PreparedQueryResult result)
+    {
+        if (!result)
+            return;
 
-    Field* fields = result->Fetch();
-    ObjectGuid ownerguid(HighGuid::Player, 0, fields[0].GetUInt32());
+        Field* fields = result->Fetch();
+        ObjectGuid ownerguid(HighGuid::Player, 0, fields[0].GetUInt32());
 
-    Player* owner = ObjectAccessor::FindConnectedPlayer(ownerguid);
-    if (owner)                                               // petition owner online
-    {
-        WorldPacket data(MSG_PETITION_DECLINE, 8);
-        data << uint64(_player->GetGUID());
-        owner->GetSession()->SendPacket(&data);
-    }
+        Player* owner = ObjectAccessor::FindConnectedPlayer(ownerguid);
+        if (owner)                                               // petition owner online
+        {
+            WorldPacket data(MSG_PETITION_DECLINE, 8);
+            data << uint64(_player->GetGUID());
+            owner->GetSession()->SendPacket(&data);
+        }
+    });
 }
 
 void WorldSession::HandleOfferPetitionOpcode(WorldPacket& recvData)
 {
     TC_LOG_DEBUG("network", "Received opcode CMSG_OFFER_PETITION");   // ok
 
-    uint8 signs = 0;
     ObjectGuid petitionguid, plguid;
-    uint32 type, junk;
-    Player* player;
+    uint32 junk;
     recvData >> junk;                                      // this is not petition type!
     recvData >> petitionguid;                              // petition guid
     recvData >> plguid;                                    // player guid
 
-    player = ObjectAccessor::FindConnectedPlayer(plguid);
-    if (!player)
+    if (!ObjectAccessor::FindConnectedPlayer(plguid))
         return;
 
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_TYPE);
 
     stmt->setUInt32(0, petitionguid.GetCounter());
 
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-    if (!result)
-        return;
-
-    Field* fields = result->Fetch();
-    type = fields[0].GetUInt8();
-
-    TC_LOG_DEBUG("network", "OFFER PETITION: type %u, %s, to %s", type, petitionguid.ToString().c_str(), plguid.ToString().c_str());
-
-    if (!sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_GUILD) && GetPlayer()->GetTeam() != player->GetTeam())
-    {
-        if (type != GUILD_CHARTER_TYPE)
-            SendArenaTeamCommandResult(ERR_ARENA_TEAM_INVITE_SS, "", "", ERR_ARENA_TEAM_NOT_ALLIED);
-        else
-            Guild::SendCommandResult(this, GUILD_COMMAND_CREATE, ERR_GUILD_NOT_ALLIED);
-        return;
-    }
-
-    if (type != GUILD_CHARTER_TYPE)
+    _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, petitionguid, plguid](PreparedQueryResult result)
     {
-        if (player->getLevel() < sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL))
-        {
-            // player is too low level to join an arena team
-            SendArenaTeamCommandResult(ERR_ARENA_TEAM_CREATE_S, player->GetName().c_str(), "", ERR_ARENA_TEAM_TARGET_TOO_LOW_S);
+        if (!result)
             return;
-        }
 
-        uint8 slot = ArenaTeam::GetSlotByType(type);
-        if (slot >= MAX_ARENA_SLOT)
+        // the player may have logged out while the petition was looked up
+        Player* player = ObjectAccessor::FindConnectedPlayer(plguid);
+        if (!player)
             return;
 
-        if (player->GetArenaTeamId(slot))
-        {
-            // player is already in an arena team
-            SendArenaTeamCommandResult(ERR_ARENA_TEAM_CREATE_S, player->GetName().c_str(), "", ERR_ALREADY_IN_ARENA_TEAM_S);
-            return;
-        }
+        uint32 type = result->Fetch()[0].GetUInt8();
 
-        if (player->GetArenaTeamIdInvited())
-        {
-            SendArenaTeamCommandResult(ERR_ARENA_TEAM_INVITE_SS, "", _player->GetName().c_str(), ERR_ALREADY_INVITED_TO_ARENA_TEAM_S);
-            return;
-        }
-    }
-    else
-    {
-        if (player->GetGuildId())
-        {
-            Guild::SendCommandResult(this, GUILD_COMMAND_INVITE, ERR_ALREADY_IN_GUILD_S, _player->GetName());
-            return;
-        }
+        TC_LOG_DEBUG("network", "OFFER PETITION: type %u, %s, to %s", type, petitionguid.ToString().c_str(), plguid.ToString().c_str());
 
-        if (player->GetGuildIdInvited())
+        if (!sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_GUILD) && GetPlayer()->GetTeam() != player->GetTeam())
         {
-            Guild::SendCommandResult(this, GUILD_COMMAND_INVITE, ERR_ALREADY_INVITED_TO_GUILD_S, _player->GetName());
+            if (type != GUILD_CHARTER_TYPE)
+                SendArenaTeamCommandResult(ERR_ARENA_TEAM_INVITE_SS, "", "", ERR_ARENA_TEAM_NOT_ALLIED);
+            else
+                Guild::SendCommandResult(this, GUILD_COMMAND_CREATE, ERR_GUILD_NOT_ALLIED);
             return;
         }
-    }
 
+        if (type != GUILD_CHARTER_TYPE)
+        {
+            if (player->getLevel() < sWorld->getIntConfig(CONFIG_MAX_PLAYER_LEVEL))
+            {
+                // player is too low level to join an arena team
+                SendArenaTeamCommandResult(ERR_ARENA_TEAM_CREATE_S, player->GetName().c_str(), "", ERR_ARENA_TEAM_TARGET_TOO_LOW_S);
+                return;
+            }
 
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIGNATURE);
+            uint8 slot = ArenaTeam::GetSlotByType(type);
+            if (slot >= MAX_ARENA_SLOT)
+                return;
 
-    stmt->setUInt32(0, petitionguid.GetCounter());
+            if (player->GetArenaTeamId(slot))
+            {
+                // player is already in an arena team
+                SendArenaTeamCommandResult(ERR_ARENA_TEAM_CREATE_S, player->GetName().c_str(), "", ERR_ALREADY_IN_ARENA_TEAM_S);
+                return;
+            }
 
-    result = CharacterDatabase.Query(stmt);
+            if (player->GetArenaTeamIdInvited())
+            {
+                SendArenaTeamCommandResult(ERR_ARENA_TEAM_INVITE_SS, "", _player->GetName().c_str(), ERR_ALREADY_INVITED_TO_ARENA_TEAM_S);
+                return;
+            }
+        }
+        else
+        {
+            if (player->GetGuildId())
+            {
+                Guild::SendCommandResult(this, GUILD_COMMAND_INVITE, ERR_ALREADY_IN_GUILD_S, _player->GetName());
+                return;
+            }
 
-    // result == NULL also correct charter without signs
-    if (result)
-        signs = uint8(result->GetRowCount());
+            if (player->GetGuildIdInvited())
+            {
+                Guild::SendCommandResult(this, GUILD_COMMAND_INVITE, ERR_ALREADY_INVITED_TO_GUILD_S, _player->GetName());
+                return;
+            }
+        }
 
-    WorldPacket data(SMSG_PETITION_SHOW_SIGNATURES, (8+8+4+signs+signs*12));
-    data << uint64(petitionguid);                           // petition guid
-    data << uint64(_player->GetGUID());                     // owner guid
-    data << uint32(petitionguid.GetCounter());              // guild guid
-    data << uint8(signs);                                   // sign's count
+        PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIGNATURE);
 
-    for (uint8 i = 1; i <= signs; ++i)
-    {
-        Field* fields2 = result->Fetch();
-        data << uint64(ObjectGuid(HighGuid::Player, fields2[0].GetUInt32())); // Player GUID
-        data << uint32(0);                                  // there 0 ...
+        stmt->setUInt32(0, petitionguid.GetCounter());
 
-        result->NextRow();
-    }
+        _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, petitionguid, plguid](PreparedQueryResult result)
+        {
+            Player* player = ObjectAccessor::FindConnectedPlayer(plguid);
+            if (!player)
+                return;
 
-    player->GetSession()->SendPacket(&data);
+            WorldPacket data;
+            BuildPetitionSignaturesPacket(data, petitionguid, _player->GetGUID(), result);
+            player->GetSession()->SendPacket(&data);
+        });
+    });
 }
 
 void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recvData)
@@ -722,11 +708,15 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recvData)
     TC_LOG_DEBUG("network", "Received opcode CMSG_TURN_IN_PETITION");
 
     // Get petition guid from packet
-    WorldPacket data;
     ObjectGuid petitionGuid;
 
     recvData >> petitionGuid;
 
+    // Only arena charters carry the team emblem, the charter type is known once the petition is loaded
+    uint32 background = 0, icon = 0, iconcolor = 0, border = 0, bordercolor = 0;
+    if (recvData.rpos() + 5 * sizeof(uint32) <= recvData.size())
+        recvData >> background >> icon >> iconcolor >> border >> bordercolor;
+
     // Check if player really has the required petition charter
     Item* item = _player->GetItemByGuid(petitionGuid);
     if (!item)
@@ -735,48 +725,153 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recvData)
     TC_LOG_DEBUG("network", "Petition %s turned in by %u", petitionGuid.ToString().c_str(), _player->GetGUID().GetCounter());
 
     // Get petition data from db
-    ObjectGuid::LowType ownerguidlo;
-    uint32 type;
-    std::string name;
-
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION);
     stmt->setUInt32(0, petitionGuid.GetCounter());
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
 
-    if (result)
+    _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, petitionGuid, background, icon, iconcolor, border, bordercolor](PreparedQueryResult result)
     {
+        if (!result)
+        {
+            TC_LOG_ERROR("network", "Player %s (guid: %u) tried to turn in petition (%s) that is not present in the database", _player->GetName().c_str(), _player->GetGUID().GetCounter(), petitionGuid.ToString().c_str());
+            return;
+        }
+
         Field* fields = result->Fetch();
-        ownerguidlo = fields[0].GetUInt32();
-        name = fields[1].GetString();
-        type = fields[2].GetUInt8();
-    }
-    else
-    {
-        TC_LOG_ERROR("network", "Player %s (guid: %u) tried to turn in petition (%s) that is not present in the database", _player->GetName().c_str(), _player->GetGUID().GetCounter(), petitionGuid.ToString().c_str());
-        return;
-    }
+        ObjectGuid::LowType ownerguidlo = fields[0].GetUInt32();
+        std::string name = fields[1].GetString();
+        uint32 type = fields[2].GetUInt8();
 
-    // Only the petition owner can turn in the petition
-    if (_player->GetGUID().GetCounter() != ownerguidlo)
-        return;
+        // Only the petition owner can turn in the petition
+        if (_player->GetGUID().GetCounter() != ownerguidlo)
+            return;
+
+        if (!CanTurnInPetition(type, name))
+            return;
+
+        // Get petition signatures from db
+        PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIGNATURE);
+        stmt->setUInt32(0, petitionGuid.GetCounter());
+
+        _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, petitionGuid, type, name, background, icon, iconcolor, border, bordercolor](PreparedQueryResult result)
+        {
+            // state may have changed while the signatures were loaded
+            Item* item = _player->GetItemByGuid(petitionGuid);
+            if (!item || !CanTurnInPetition(type, name))
+                return;
+
+            uint8 signatures = result ? uint8(result->GetRowCount()) : 0;
+
+            uint32 requiredSignatures;
+            if (type == GUILD_CHARTER_TYPE)
+                requiredSignatures = sWorld->getIntConfig(CONFIG_MIN_PETITION_SIGNS);
+            else
+                requiredSignatures = type-1;
+
+            // Notify player if signatures are missing
+            if (signatures < requiredSignatures)
+            {
+                WorldPacket data(SMSG_TURN_IN_PETITION_RESULTS, 4);
+                data << (uint32)PETITION_TURN_NEED_MORE_SIGNATURES;
+                SendPacket(&data);
+                return;
+            }
+
+            // Proceed with guild/arena team creation
+
+            // Delete charter item
+            _player->DestroyItem(item->GetBagSlot(), item->GetSlot(), true);
+
+            if (type == GUILD_CHARTER_TYPE)
+            {
+                // Create guild
+                Guild* guild = new Guild;
+
+                if (!guild->Create(_player, name))
+                {
+                    delete guild;
+                    return;
+                }
+
+                // Register guild and add guild master
+                sGuildMgr->AddGuild(guild);
+
+                Guild::SendCommandResult(this, GUILD_COMMAND_CREATE, ERR_GUILD_COMMAND_SUCCESS, name);
+
+                // Add members from signatures
+                for (uint8 i = 0; i < signatures; ++i)
+                {
+                    Field* fields = result->Fetch();
+                    guild->AddMember(ObjectGuid(HighGuid::Player, fields[0].GetUInt32()));
+                    result->NextRow();
+                }
+            }
+            else
+            {
+                // Create arena team
+                ArenaTeam* arenaTeam = new ArenaTeam();
+
+                if (!arenaTeam->Create(_player->GetGUID(), type, name, background, icon, iconcolor, border, bordercolor))
+                {
+                    delete arenaTeam;
+                    return;
+                }
+
+                // Register arena team
+                sArenaTeamMgr->AddArenaTeam(arenaTeam);
+                TC_LOG_DEBUG("network", "PetitonsHandler: Arena team (guid: %u) added to ObjectMgr", arenaTeam->GetId());
+
+                // Add members
+                for (uint8 i = 0; i < signatures; ++i)
+                {
+                    Field* fields = result->Fetch();
+                    ObjectGuid memberGUID(HighGuid::Player, fields[0].GetUInt32());
+                    TC_LOG_DEBUG("network", "PetitionsHandler: Adding arena team (guid: %u) member %s", arenaTeam->GetId(), memberGUID.ToString().c_str());
+                    arenaTeam->AddMember(memberGUID);
+                    result->NextRow();
+                }
+            }
+
+            SQLTransaction trans = CharacterDatabase.BeginTransaction();
+
+            PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PETITION_BY_GUID);
+            stmt->setUInt32(0, petitionGuid.GetCounter());
+            trans->Append(stmt);
+
+            stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PETITION_SIGNATURE_BY_GUID);
+            stmt->setUInt32(0, petitionGuid.GetCounter());
+            trans->Append(stmt);
+
+            CharacterDatabase.CommitTransaction(trans);
+
+            // created
+            TC_LOG_DEBUG("network", "Player %s (%s) turning in petition %s", _player->GetName().c_str(), _player->GetGUID().ToString().c_str(), petitionGuid.ToString().c_str());
+
+            WorldPacket data(SMSG_TURN_IN_PETITION_RESULTS, 4);
+            data << (uint32)PETITION_TURN_OK;
+            SendPacket(&data);
+        });
+    });
+}
 
+bool WorldSession::CanTurnInPetition(uint32 type, std::string const& name)
+{
     // Petition type (guild/arena) specific checks
     if (type == GUILD_CHARTER_TYPE)
     {
         // Check if player is already in a guild
         if (_player->GetGuildId())
         {
-            data.Initialize(SMSG_TURN_IN_PETITION_RESULTS, 4);
+            WorldPacket data(SMSG_TURN_IN_PETITION_RESULTS, 4);
             data << (uint32)PETITION_TURN_ALREADY_IN_GUILD;
-            _player->GetSession()->SendPacket(&data);
-            return;
+            SendPacket(&data);
+            return false;
         }
 
         // Check if guild name is already taken
         if (sGuildMgr->GetGuildByName(name))
         {
             Guild::SendCommandResult(this, GUILD_COMMAND_CREATE, ERR_GUILD_NAME_EXISTS_S, name);
-            return;
+            return false;
         }
     }
     else
@@ -784,127 +879,24 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recvData)
         // Check for valid arena bracket (2v2, 3v3, 5v5)
         uint8 slot = ArenaTeam::GetSlotByType(type);
         if (slot >= MAX_ARENA_SLOT)
-            return;
+            return false;
 
         // Check if player is already in an arena team
         if (_player->GetArenaTeamId(slot))
         {
             SendArenaTeamCommandResult(ERR_ARENA_TEAM_CREATE_S, name, "", ERR_ALREADY_IN_ARENA_TEAM);
-            return;
+            return false;
         }
 
         // Check if arena team name is already taken
         if (sArenaTeamMgr->GetArenaTeamByName(name))
         {
             SendArenaTeamCommandResult(ERR_ARENA_TEAM_CREATE_S, name, "", ERR_ARENA_TEAM_NAME_EXISTS_S);
-            return;
-        }
-    }
-
-    // Get petition signatures from db
-    uint8 signatures;
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_PETITION_SIGNATURE);
-    stmt->setUInt32(0, petitionGuid.GetCounter());
-    result = CharacterDatabase.Query(stmt);
-
-    if (result)
-        signatures = uint8(result->GetRowCount());
-    else
-        signatures = 0;
-
-    uint32 requiredSignatures;
-    if (type == GUILD_CHARTER_TYPE)
-        requiredSignatures = sWorld->getIntConfig(CONFIG_MIN_PETITION_SIGNS);
-    else
-        requiredSignatures = type-1;
-
-    // Notify player if signatures are missing
-    if (signatures < requiredSignatures)
-    {
-        data.Initialize(SMSG_TURN_IN_PETITION_RESULTS, 4);
-        data << (uint32)PETITION_TURN_NEED_MORE_SIGNATURES;
-        SendPacket(&data);
-        return;
-    }
-
-    // Proceed with guild/arena team creation
-
-    // Delete charter item
-    _player->DestroyItem(item->GetBagSlot(), item->GetSlot(), true);
-
-    if (type == GUILD_CHARTER_TYPE)
-    {
-        // Create guild
-        Guild* guild = new Guild;
-
-        if (!guild->Create(_player, name))
-        {
-            delete guild;
-            return;
-        }
-
-        // Register guild and add guild master
-        sGuildMgr->AddGuild(guild);
-
-        Guild::SendCommandResult(this, GUILD_COMMAND_CREATE, ERR_GUILD_COMMAND_SUCCESS, name);
-
-        // Add members from signatures
-        for (uint8 i = 0; i < signatures; ++i)
-        {
-            Field* fields = result->Fetch();
-            guild->AddMember(ObjectGuid(HighGuid::Player, fields[0].GetUInt32()));
-            result->NextRow();
+            return false;
         }
     }
-    else
-    {
-        // Receive the rest of the packet in arena team creation case
-        uint32 background, icon, iconcolor, border, bordercolor;
-        recvData >> background >> icon >> iconcolor >> border >> bordercolor;
-
-        // Create arena team
-        ArenaTeam* arenaTeam = new ArenaTeam();
-
-        if (!arenaTeam->Create(_player->GetGUID(), type, name, background, icon, iconcolor, border, bordercolor))
-        {
-            delete arenaTeam;
-            return;
-        }
 
-        // Register arena team
-        sArenaTeamMgr->AddArenaTeam(arenaTeam);
-        TC_LOG_DEBUG("network", "PetitonsHandler: Arena team (guid: %u) added to ObjectMgr", arenaTeam->GetId());
-
-        // Add members
-        for (uint8 i = 0; i < signatures; ++i)
-        {
-            Field* fields = result->Fetch();
-            ObjectGuid memberGUID(HighGuid::Player, fields[0].GetUInt32());
-            TC_LOG_DEBUG("network", "PetitionsHandler: Adding arena team (guid: %u) member %s", arenaTeam->GetId(), memberGUID.ToString().c_str());
-            arenaTeam->AddMember(memberGUID);
-            result->NextRow();
-        }
-    }
-
-    SQLTransaction trans = CharacterDatabase.BeginTransaction();
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PETITION_BY_GUID);
-    stmt->setUInt32(0, petitionGuid.GetCounter());
-    trans->Append(stmt);
-
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_PETITION_SIGNATURE_BY_GUID);
-    stmt->setUInt32(0, petitionGuid.GetCounter());
-    trans->Append(stmt);
-
-    CharacterDatabase.CommitTransaction(trans);
-
-    // created
-    TC_LOG_DEBUG("network", "Player %s (%s) turning in petition %s", _player->GetName().c_str(), _player->GetGUID().ToString().c_str(), petitionGuid.ToString().c_str());
-
-    data.Initialize(SMSG_TURN_IN_PETITION_RESULTS, 4);
-    data << (uint32)PETITION_TURN_OK;
-    SendPacket(&data);
+    return true;
 }
 
 void WorldSession::HandlePetitionShowListOpcode(WorldPacket& recvData)
@@ -27,6 +27,7 @@
 #include "UpdateMask.h"
 #include "NPCHandler.h"
 #include "MapManager.h"
+#include "QueryResponseCache.h"
 
 void WorldSession::SendNameQueryOpcode(ObjectGuid guid)
 {
@@ -85,6 +86,19 @@ void WorldSession::SendQueryTimeResponse()
     SendPacket(&data);
 }
 
+bool WorldSession::SendCachedQueryResponse(QueryResponseType type, uint32 entry)
+{
+    QueryResponseCache::ResponsePtr response = sQueryResponseCache->Find(type, entry, GetSessionDbLocaleIndex());
+    if (!response)
+        return false;
+
+    sQueryResponseCache->CountHit(type);
+    for (WorldPacket const& packet : *response)
+        SendPacket(&packet);
+
+    return true;
+}
+
 /// Only _static_ data is sent in this packet !!!
 void WorldSession::HandleCreatureQueryOpcode(WorldPacket& recvData)
 {
@@ -96,6 +110,9 @@ void WorldSession::HandleCreatureQueryOpcode(WorldPacket& recvData)
     CreatureTemplate const* ci = sObjectMgr->GetCreatureTemplate(entry);
     if (ci)
     {
+        if (SendCachedQueryResponse(QUERY_RESPONSE_CREATURE, entry))
+            return;
+
         std::string Name, Title;
         Name = ci->Name;
         Title = ci->Title;
@@ -141,6 +158,7 @@ void WorldSession::HandleCreatureQueryOpcode(WorldPacket& recvData)
 
         data << uint32(ci->movementId);                     // CreatureMovementInfo.dbc
         SendPacket(&data);
+        sQueryResponseCache->Store(QUERY_RESPONSE_CREATURE, entry, GetSessionDbLocaleIndex(), data);
         TC_LOG_DEBUG("network", "WORLD: Sent SMSG_CREATURE_QUERY_RESPONSE");
     }
     else
@@ -165,6 +183,9 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recvData)
     const GameObjectTemplate* info = sObjectMgr->GetGameObjectTemplate(entry);
     if (info)
     {
+        if (SendCachedQueryResponse(QUERY_RESPONSE_GAMEOBJECT, entry))
+            return;
+
         std::string Name;
         std::string IconName;
         std::string CastBarCaption;
@@ -203,6 +224,7 @@ void WorldSession::HandleGameObjectQueryOpcode(WorldPacket& recvData)
                 data << uint32(0);
 
         SendPacket(&data);
+        sQueryResponseCache->Store(QUERY_RESPONSE_GAMEOBJECT, entry, GetSessionDbLocaleIndex(), data);
         TC_LOG_DEBUG("network", "WORLD: Sent SMSG_GAMEOBJECT_QUERY_RESPONSE");
     }
     else
@@ -359,6 +381,14 @@ void WorldSession::HandlePageTextQueryOpcode(WorldPacket& recvData)
     recvData >> pageID;
     recvData.read_skip<uint64>();                          // guid
 
+    if (SendCachedQueryResponse(QUERY_RESPONSE_PAGE_TEXT, pageID))
+        return;
+
+    // the whole chain of pages is cached under the first page id
+    uint32 firstPageID = pageID;
+    QueryResponseCache::Response response;
+    bool cacheable = true;
+
     while (pageID)
     {
         PageText const* pageText = sObjectMgr->GetPageText(pageID);
@@ -371,6 +401,7 @@ void WorldSession::HandlePageTextQueryOpcode(WorldPacket& recvData)
             data << "Item page missing.";
             data << uint32(0);
             pageID = 0;
+            cacheable = false;
         }
         else
         {
@@ -386,9 +417,13 @@ void WorldSession::HandlePageTextQueryOpcode(WorldPacket& recvData)
             pageID = pageText->NextPage;
         }
         SendPacket(&data);
+        response.push_back(std::move(data));
 
         TC_LOG_DEBUG("network", "WORLD: Sent SMSG_PAGE_TEXT_QUERY_RESPONSE");
     }
+
+    if (cacheable && !response.empty())
+        sQueryResponseCache->Store(QUERY_RESPONSE_PAGE_TEXT, firstPageID, GetSessionDbLocaleIndex(), std::move(response));
 }
 
 void WorldSession::HandleCorpseMapPositionQuery(WorldPacket& recvData)
@@ -231,36 +231,46 @@ void WorldSession::HandleOpenItemOpcode(WorldPacket& recvPacket)
 
         stmt->setUInt32(0, item->GetGUID().GetCounter());
 
-        PreparedQueryResult result = CharacterDatabase.Query(stmt);
-
-        if (result)
-        {
-            Field* fields = result->Fetch();
-            uint32 entry = fields[0].GetUInt32();
-            uint32 flags = fields[1].GetUInt32();
-
-            item->SetGuidValue(ITEM_FIELD_GIFTCREATOR, ObjectGuid::Empty);
-            item->SetEntry(entry);
-            item->SetUInt32Value(ITEM_FIELD_FLAGS, flags);
-            item->SetState(ITEM_CHANGED, pUser);
-        }
-        else
+        ObjectGuid itemGuid = item->GetGUID();
+        _queryProcessor.AddQuery(CharacterDatabase.AsyncQuery(stmt), [this, itemGuid](PreparedQueryResult result)
         {
-            TC_LOG_ERROR("network", "Wrapped item %u don't have record in character_gifts table and will deleted", item->GetGUID().GetCounter());
-            pUser->DestroyItem(item->GetBagSlot(), item->GetSlot(), true);
-            return;
-        }
-
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GIFT);
-
-        stmt->setUInt32(0, item->GetGUID().GetCounter());
-
-        CharacterDatabase.Execute(stmt);
+            HandleOpenWrappedItemCallback(result, itemGuid);
+        });
     }
     else
         pUser->SendLoot(item->GetGUID(), LOOT_CORPSE);
 }
 
+void WorldSession::HandleOpenWrappedItemCallback(PreparedQueryResult result, ObjectGuid itemGuid)
+{
+    // the item may have been moved or destroyed while the gift was loaded
+    Item* item = _player->GetItemByGuid(itemGuid);
+    if (!item || !item->HasFlag(ITEM_FIELD_FLAGS, ITEM_FLAG_WRAPPED))
+        return;
+
+    if (!result)
+    {
+        TC_LOG_ERROR("network", "Wrapped item %u don't have record in character_gifts table and will deleted", itemGuid.GetCounter());
+        _player->DestroyItem(item->GetBagSlot(), item->GetSlot(), true);
+        return;
+    }
+
+    Field* fields = result->Fetch();
+    uint32 entry = fields[0].GetUInt32();
+    uint32 flags = fields[1].GetUInt32();
+
+    item->SetGuidValue(ITEM_FIELD_GIFTCREATOR, ObjectGuid::Empty);
+    item->SetEntry(entry);
+    item->SetUInt32Value(ITEM_FIELD_FLAGS, flags);
+    item->SetState(ITEM_CHANGED, _player);
+
+    PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GIFT);
+
+    stmt->setUInt32(0, itemGuid.GetCounter());
+
+    CharacterDatabase.Execute(stmt);
+}
+
 void WorldSession::HandleGameObjectUseOpcode(WorldPacket& recvData)
 {
     ObjectGuid guid;
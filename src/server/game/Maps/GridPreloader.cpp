@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2008-2016 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "GridPreloader.h"
+#include "Map.h"
+#include "MapTree.h"
+#include "Log.h"
+#include "Timer.h"
+
+namespace
+{
+    // Grids queued or waiting to be entered at the same time
+    uint32 const GRID_PRELOAD_MAX_ENTRIES = 64;
+    // Preloaded grids nobody entered within this time are dropped
+    uint32 const GRID_PRELOAD_EXPIRE_TIME = 60 * IN_MILLISECONDS;
+
+    // Reads a file once so the synchronous load on the map thread finds it in the page cache
+    void WarmFile(std::string const& fileName)
+    {
+        FILE* file = fopen(fileName.c_str(), "rb");
+        if (!file)
+            return;
+
+        char buffer[64 * 1024];
+        while (fread(buffer, 1, sizeof(buffer), file) == sizeof(buffer))
+            ;
+
+        fclose(file);
+    }
+}
+
+GridPreloader* GridPreloader::instance()
+{
+    static GridPreloader instance;
+    return &instance;
+}
+
+GridPreloader::~GridPreloader()
+{
+    Stop();
+}
+
+void GridPreloader::Start(std::string const& dataPath)
+{
+    if (IsRunning())
+        return;
+
+    _dataPath = dataPath;
+    _stop = false;
+    _thread = std::thread(&GridPreloader::WorkerThread, this);
+}
+
+void GridPreloader::Stop()
+{
+    if (!IsRunning())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _stop = true;
+    }
+
+    _condition.notify_one();
+    _thread.join();
+
+    for (auto itr = _entries.begin(); itr != _entries.end(); ++itr)
+        delete itr->second.Grid;
+
+    _entries.clear();
+    _queue.clear();
+}
+
+void GridPreloader::Request(uint32 mapId, uint32 gx, uint32 gy)
+{
+    if (!IsRunning())
+        return;
+
+    uint32 key = MakeKey(mapId, gx, gy);
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if (_entries.size() >= GRID_PRELOAD_MAX_ENTRIES || _entries.count(key))
+            return;
+
+        _entries[key];
+        _queue.push_back(key);
+    }
+
+    ++_stats.Requests;
+    _condition.notify_one();
+}
+
+GridMap* GridPreloader::Take(uint32 mapId, uint32 gx, uint32 gy)
+{
+    if (!IsRunning())
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(_lock);
+    auto itr = _entries.find(MakeKey(mapId, gx, gy));
+    if (itr == _entries.end() || !itr->second.Ready)
+        return nullptr;
+
+    GridMap* grid = itr->second.Grid;
+    _entries.erase(itr);
+    if (grid)
+        ++_stats.Taken;
+
+    return grid;
+}
+
+void GridPreloader::Update(uint32 diff)
+{
+    _expireTimer += diff;
+    if (_expireTimer < IN_MILLISECONDS)
+        return;
+
+    _expireTimer = 0;
+
+    std::lock_guard<std::mutex> lock(_lock);
+    for (auto itr = _entries.begin(); itr != _entries.end();)
+    {
+        if (itr->second.Ready && getMSTimeDiff(itr->second.LoadTime, getMSTime()) > GRID_PRELOAD_EXPIRE_TIME)
+        {
+            delete itr->second.Grid;
+            itr = _entries.erase(itr);
+            ++_stats.Expired;
+        }
+        else
+            ++itr;
+    }
+}
+
+uint32 GridPreloader::GetPendingCount()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    return uint32(_entries.size());
+}
+
+void GridPreloader::WorkerThread()
+{
+    for (;;)
+    {
+        uint32 key;
+        {
+            std::unique_lock<std::mutex> lock(_lock);
+            _condition.wait(lock, [this] { return _stop || !_queue.empty(); });
+            if (_stop)
+                return;
+
+            key = _queue.front();
+            _queue.pop_front();
+        }
+
+        Load(key);
+    }
+}
+
+void GridPreloader::Load(uint32 key)
+{
+    uint32 mapId = key >> 12;
+    uint32 gx = (key >> 6) & 0x3F;
+    uint32 gy = key & 0x3F;
+
+    char fileName[32];
+    snprintf(fileName, sizeof(fileName), "maps/%03u%02u%02u.map", mapId, gx, gy);
+
+    GridMap* grid = new GridMap();
+    if (!grid->loadData((_dataPath + fileName).c_str()))
+    {
+        // leave reporting the broken file to the regular load
+        delete grid;
+        grid = nullptr;
+    }
+
+    WarmFile(_dataPath + "vmaps/" + VMAP::StaticMapTree::getTileFileName(mapId, gx, gy));
+    snprintf(fileName, sizeof(fileName), "mmaps/%03u%02u%02u.mmtile", mapId, gx, gy);
+    WarmFile(_dataPath + fileName);
+
+    TC_LOG_DEBUG("maps", "GridPreloader: preloaded grid [%u, %u] of map %u", gx, gy, mapId);
+
+    std::lock_guard<std::mutex> lock(_lock);
+    Entry& entry = _entries[key];
+    entry.Grid = grid;
+    entry.LoadTime = getMSTime();
+    entry.Ready = true;
+    ++_stats.Loaded;
+}
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2008-2016 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef TRINITY_GRIDPRELOADER_H
+#define TRINITY_GRIDPRELOADER_H
+
+#include "Define.h"
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+class GridMap;
+
+struct GridPreloadStats
+{
+    GridPreloadStats() : Requests(0), Loaded(0), Taken(0), Expired(0) { }
+
+    std::atomic<uint32> Requests;
+    std::atomic<uint32> Loaded;
+    std::atomic<uint32> Taken;
+    std::atomic<uint32> Expired;
+};
+
+/**
+ * Loads terrain of grids that players are about to enter on a background
+ * thread. Maps predict the grids from player movement, the loader reads the
+ * .map file and warms the vmap and mmap tile files, and Map::LoadMap picks up
+ * the ready GridMap instead of reading it on the map update thread.
+ * Grid coordinates are the ones used to index Map::GridMaps.
+ */
+class TC_GAME_API GridPreloader
+{
+    public:
+        static GridPreloader* instance();
+
+        void Start(std::string const& dataPath);
+        void Stop();
+        bool IsRunning() const { return _thread.joinable(); }
+
+        /// Queues a grid for loading, ignored when already queued, loaded or the queue is full
+        void Request(uint32 mapId, uint32 gx, uint32 gy);
+        /// Hands over a preloaded GridMap, NULL if none is ready
+        GridMap* Take(uint32 mapId, uint32 gx, uint32 gy);
+        /// Drops preloaded grids nobody entered
+        void Update(uint32 diff);
+
+        GridPreloadStats const& GetStats() const { return _stats; }
+        uint32 GetPendingCount();
+
+    private:
+        GridPreloader() : _stop(false), _expireTimer(0) { }
+        ~GridPreloader();
+
+        struct Entry
+        {
+            Entry() : Grid(nullptr), LoadTime(0), Ready(false) { }
+
+            GridMap* Grid;
+            uint32 LoadTime;
+            bool Ready;
+        };
+
+        static uint32 MakeKey(uint32 mapId, uint32 gx, uint32 gy) { return (mapId << 12) | (gx << 6) | gy; }
+
+        void WorkerThread();
+        void Load(uint32 key);
+
+        std::string _dataPath;
+        std::thread _thread;
+        std::mutex _lock;
+        std::condition_variable _condition;
+        std::deque<uint32> _queue;
+        std::unordered_map<uint32, Entry> _entries;
+        bool _stop;
+        uint32 _expireTimer;
+        GridPreloadStats _stats;
+};
+
+#define sGridPreloader GridPreloader::instance()
+
+#endif // TRINITY_GRIDPRELOADER_H
@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2008-2016 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "LineOfSightCache.h"
+#include "Timer.h"
+#include <algorithm>
+#include <cmath>
+
+LineOfSightCache::Key::Key(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phaseMask) : PhaseMask(phaseMask)
+{
+    Coords[0] = int32(std::floor(x1 * RESOLUTION));
+    Coords[1] = int32(std::floor(y1 * RESOLUTION));
+    Coords[2] = int32(std::floor(z1 * RESOLUTION));
+    Coords[3] = int32(std::floor(x2 * RESOLUTION));
+    Coords[4] = int32(std::floor(y2 * RESOLUTION));
+    Coords[5] = int32(std::floor(z2 * RESOLUTION));
+}
+
+bool LineOfSightCache::Key::operator==(Key const& right) const
+{
+    for (uint8 i = 0; i < 6; ++i)
+        if (Coords[i] != right.Coords[i])
+            return false;
+
+    return PhaseMask == right.PhaseMask;
+}
+
+uint32 LineOfSightCache::Key::GetHash() const
+{
+    // FNV-1a over the quantised endpoints
+    uint32 hash = 2166136261u;
+    for (uint8 i = 0; i < 6; ++i)
+    {
+        hash ^= uint32(Coords[i]);
+        hash *= 16777619u;
+    }
+
+    hash ^= PhaseMask;
+    hash *= 16777619u;
+    return hash ^ (hash >> 16);
+}
+
+bool LineOfSightCache::Key::MayIntersect(G3D::AABox const& bounds) const
+{
+    // endpoints lie up to one step above their quantised values, grow the box
+    // by one step on each side and test the quantised segment against it (slab test)
+    float const step = 1.0f / RESOLUTION;
+    float tMin = 0.0f;
+    float tMax = 1.0f;
+    for (uint8 i = 0; i < 3; ++i)
+    {
+        float const start = Coords[i] * step;
+        float const dir = Coords[i + 3] * step - start;
+        float const low = bounds.low()[i] - step;
+        float const high = bounds.high()[i] + step;
+        if (std::fabs(dir) < 1e-6f)
+        {
+            if (start < low || start > high)
+                return false;
+            continue;
+        }
+
+        float t1 = (low - start) / dir;
+        float t2 = (high - start) / dir;
+        if (t1 > t2)
+            std::swap(t1, t2);
+
+        tMin = std::max(tMin, t1);
+        tMax = std::min(tMax, t2);
+        if (tMin > tMax)
+            return false;
+    }
+
+    return true;
+}
+
+bool LineOfSightCache::Find(Key const& key, uint32 now, uint32 maxAge, bool& result)
+{
+    if (!_entries.empty())
+    {
+        Entry const& entry = _entries[key.GetHash() % SIZE];
+        if (entry.Valid && getMSTimeDiff(entry.Time, now) < maxAge && entry.CacheKey == key)
+        {
+            ++_hits;
+            result = entry.Result;
+            return true;
+        }
+    }
+
+    ++_misses;
+    return false;
+}
+
+void LineOfSightCache::Insert(Key const& key, uint32 now, bool result)
+{
+    if (_entries.empty())
+        _entries.resize(SIZE);
+
+    Entry& entry = _entries[key.GetHash() % SIZE];
+    entry.CacheKey = key;
+    entry.Valid = true;
+    entry.Time = now;
+    entry.Result = result;
+}
+
+void LineOfSightCache::Invalidate(G3D::AABox const& bounds)
+{
+    for (Entry& entry : _entries)
+        if (entry.Valid && entry.CacheKey.MayIntersect(bounds))
+            entry.Valid = false;
+}
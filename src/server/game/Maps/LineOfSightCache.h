@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2008-2016 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef TRINITY_LINEOFSIGHTCACHE_H
+#define TRINITY_LINEOFSIGHTCACHE_H
+
+#include "Define.h"
+#include <G3D/AABox.h>
+#include <vector>
+
+/**
+ * Short lived per map cache of line of sight results. Endpoints are
+ * quantised, so the many near identical rays of aggro checks and area
+ * target selection share one traversal. When a gameobject model is added,
+ * removed or toggled only the entries whose ray crosses its bounds are
+ * dropped, so moving transports do not flush the rest of the map.
+ */
+class TC_GAME_API LineOfSightCache
+{
+    public:
+        /// Number of slots, entries colliding on a slot replace each other
+        static uint32 const SIZE = 1024;
+        /// Endpoint quantisation, in steps per yard
+        static uint32 const RESOLUTION = 4;
+
+        struct Key
+        {
+            Key(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phaseMask);
+
+            bool operator==(Key const& right) const;
+            uint32 GetHash() const;
+            /// True if the ray of any endpoints quantised to this key can cross bounds
+            bool MayIntersect(G3D::AABox const& bounds) const;
+
+            int32 Coords[6];
+            uint32 PhaseMask;
+        };
+
+        LineOfSightCache() : _hits(0), _misses(0) { }
+
+        /// Looks up a result stored less than maxAge ms ago
+        bool Find(Key const& key, uint32 now, uint32 maxAge, bool& result);
+        void Insert(Key const& key, uint32 now, bool result);
+        /// Drops only the entries whose ray may cross bounds
+        void Invalidate(G3D::AABox const& bounds);
+
+        uint64 GetHits() const { return _hits; }
+        uint64 GetMisses() const { return _misses; }
+
+    private:
+        struct Entry
+        {
+            Entry() : CacheKey(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0), Valid(false), Time(0), Result(false) { }
+
+            Key CacheKey;
+            bool Valid;
+            uint32 Time;
+            bool Result;
+        };
+
+        std::vector<Entry> _entries;                        // allocated on first insert, most maps never check LoS
+        uint64 _hits;
+        uint64 _misses;
+};
+
+#endif // TRINITY_LINEOFSIGHTCACHE_H
@@ -18,20 +18,24 @@
 
 #include "Map.h"
 #include "Battleground.h"
+#include "BattlefieldMgr.h"
 #include "MMapFactory.h"
 #include "CellImpl.h"
 #include "DisableMgr.h"
 #include "DynamicTree.h"
+#include "GridPreloader.h"
 #include "GridNotifiers.h"
 #include "GridNotifiersImpl.h"
 #include "GridStates.h"
 #include "Group.h"
 #include "InstanceScript.h"
 #include "MapInstanced.h"
+#include "MoveSpline.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
 #include "Pet.h"
 #include "ScriptMgr.h"
+#include "SynchronousQueryWatch.h"
 #include "Transport.h"
 #include "Vehicle.h"
 #include "VMapFactory.h"
@@ -189,10 +193,15 @@ void Map::LoadMap(int gx, int gy, bool reload)
     tmp = new char[len];
     snprintf(tmp, len, (char *)(sWorld->GetDataPath() + "maps/%03u%02u%02u.map").c_str(), GetId(), gx, gy);
     TC_LOG_DEBUG("maps", "Loading map %s", tmp);
-    // loading data
-    GridMaps[gx][gy] = new GridMap();
-    if (!GridMaps[gx][gy]->loadData(tmp))
-        TC_LOG_ERROR("maps", "Error loading map file: \n %s\n", tmp);
+    // loading data, unless the grid preloader already did
+    if (GridMap* preloaded = reload ? NULL : sGridPreloader->Take(GetId(), gx, gy))
+        GridMaps[gx][gy] = preloaded;
+    else
+    {
+        GridMaps[gx][gy] = new GridMap();
+        if (!GridMaps[gx][gy]->loadData(tmp))
+            TC_LOG_ERROR("maps", "Error loading map file: \n %s\n", tmp);
+    }
     delete[] tmp;
 
     sScriptMgr->OnLoadGridMap(this, GridMaps[gx][gy], gx, gy);
@@ -239,7 +248,11 @@ m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
 m_VisibilityNotifyPeriod(DEFAULT_VISIBILITY_NOTIFY_PERIOD),
 m_activeNonPlayersIter(m_activeNonPlayers.end()), _transportsUpdateIter(_transports.end()),
 i_gridExpiry(expiry),
-i_scriptLock(false), _defaultLight(GetDefaultMapLight(id))
+i_scriptLock(false), _defaultLight(GetDefaultMapLight(id)),
+_gridPreloadTimer(0), _gridLoadCount(0), _gridLoadStallTime(0), _gridLoadMaxStall(0),
+_gameEventSpawnsApplied(0), _gameEventSpawnsSkipped(0), _gameEventSpawnStalls(0),
+_respawnJournalTimer(0), _respawnJournalUpdates(0),
+_respawnsPolled(0), _respawnsWoken(0), _lastRespawnsPolled(0), _lastRespawnsWoken(0), _respawnsWokenTotal(0)
 {
     m_parentMap = (_parent ? _parent : this);
     for (unsigned int idx=0; idx < MAX_NUMBER_OF_GRIDS; ++idx)
@@ -488,6 +501,7 @@ void Map::EnsureGridLoadedForActiveObject(const Cell &cell, WorldObject* object)
 //Create NGrid and load the object data in it
 bool Map::EnsureGridLoaded(const Cell &cell)
 {
+    uint32 const startTime = getMSTime();
     EnsureGridCreated(GridCoord(cell.GridX(), cell.GridY()));
     NGridType *grid = getNGrid(cell.GridX(), cell.GridY());
 
@@ -502,12 +516,64 @@ bool Map::EnsureGridLoaded(const Cell &cell)
         loader.LoadN();
 
         Balance();
+
+        uint32 stall = GetMSTimeDiffToNow(startTime);
+        ++_gridLoadCount;
+        _gridLoadStallTime += stall;
+        _gridLoadMaxStall = std::max(_gridLoadMaxStall, stall);
         return true;
     }
 
     return false;
 }
 
+void Map::RequestGridPreloads()
+{
+    float const lookAhead = float(sWorld->getIntConfig(CONFIG_GRID_PRELOAD_LOOKAHEAD));
+    for (MapRefManager::iterator itr = m_mapRefManager.begin(); itr != m_mapRefManager.end(); ++itr)
+    {
+        Player* player = itr->GetSource();
+        if (!player || !player->IsInWorld())
+            continue;
+
+        // where the player will be in lookAhead seconds, taxi splines know their destination
+        float x, y;
+        if (player->IsInFlight() && !player->movespline->Finalized())
+        {
+            G3D::Vector3 dest = player->movespline->FinalDestination();
+            x = dest.x;
+            y = dest.y;
+        }
+        else if (player->isMoving())
+        {
+            float dist = player->GetSpeed(player->IsFlying() ? MOVE_FLIGHT : MOVE_RUN) * lookAhead;
+            x = player->GetPositionX() + dist * std::cos(player->GetOrientation());
+            y = player->GetPositionY() + dist * std::sin(player->GetOrientation());
+        }
+        else
+            continue;
+
+        // sample the way there so grids crossed on the way are loaded too
+        uint32 const steps = 4;
+        for (uint32 i = 1; i <= steps; ++i)
+        {
+            float px = player->GetPositionX() + (x - player->GetPositionX()) * i / steps;
+            float py = player->GetPositionY() + (y - player->GetPositionY()) * i / steps;
+            if (!Trinity::IsValidMapCoord(px, py))
+                break;
+
+            GridCoord p = Trinity::ComputeGridCoord(px, py);
+            if (getNGrid(p.x_coord, p.y_coord))
+                continue;
+
+            int gx = (MAX_NUMBER_OF_GRIDS - 1) - p.x_coord;
+            int gy = (MAX_NUMBER_OF_GRIDS - 1) - p.y_coord;
+            if (!GridMaps[gx][gy])
+                sGridPreloader->Request(GetId(), gx, gy);
+        }
+    }
+}
+
 void Map::LoadGrid(float x, float y)
 {
     EnsureGridLoaded(Cell(x, y));
@@ -677,7 +743,38 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Trinity::Obj
 
 void Map::Update(const uint32 t_diff)
 {
+    SynchronousQueryWatch::Scope queryWatchScope("map update");
+
     _dynamicTree.update(t_diff);
+
+    _gridPreloadTimer += t_diff;
+    if (_gridPreloadTimer >= IN_MILLISECONDS)
+    {
+        _gridPreloadTimer = 0;
+        // instances are small and mostly loaded on entry
+        if (!Instanceable() && sGridPreloader->IsRunning())
+            RequestGridPreloads();
+    }
+
+    _lastRespawnsPolled = _respawnsPolled;
+    _lastRespawnsWoken = _respawnsWoken;
+    _respawnsPolled = 0;
+    _respawnsWoken = 0;
+
+    ProcessGameEventSpawns();
+
+    // Wintergrasp and other battlefields run with the map they are located on
+    if (!Instanceable())
+        sBattlefieldMgr->Update(this, t_diff);
+
+    // with the journal disabled by a config reload this writes what is left at the next update
+    _respawnJournalTimer += t_diff;
+    if (_respawnJournalTimer >= sWorld->getIntConfig(CONFIG_RESPAWN_JOURNAL_SAVE_INTERVAL) * IN_MILLISECONDS)
+    {
+        _respawnJournalTimer = 0;
+        SaveRespawnJournal();
+    }
+
     /// update worldsessions for existing players
     for (m_mapRefIter = m_mapRefManager.begin(); m_mapRefIter != m_mapRefManager.end(); ++m_mapRefIter)
     {
@@ -757,6 +854,8 @@ void Map::Update(const uint32 t_diff)
         obj->Update(t_diff);
     }
 
+    ProcessRespawnQueue();
+
     SendObjectUpdates();
 
     ///- Process necessary scripts
@@ -776,6 +875,173 @@ void Map::Update(const uint32 t_diff)
     sScriptMgr->OnMapUpdate(this, t_diff);
 }
 
+void Map::AddGameEventSpawn(TypeID type, ObjectGuid::LowType spawnId, bool spawn)
+{
+    std::lock_guard<std::mutex> lock(_gameEventSpawnLock);
+    _gameEventSpawns.push_back({ type, spawnId, spawn });
+}
+
+uint32 Map::GetPendingGameEventSpawnCount() const
+{
+    std::lock_guard<std::mutex> lock(_gameEventSpawnLock);
+    return uint32(_gameEventSpawns.size());
+}
+
+void Map::ProcessGameEventSpawns()
+{
+    std::vector<GameEventSpawnRequest> requests;
+    {
+        std::lock_guard<std::mutex> lock(_gameEventSpawnLock);
+        if (_gameEventSpawns.empty())
+            return;
+
+        size_t count = _gameEventSpawns.size();
+        if (uint32 budget = sWorld->getIntConfig(CONFIG_GAME_EVENT_SPAWNS_PER_UPDATE))
+        {
+            if (count > budget)
+            {
+                count = budget;
+                ++_gameEventSpawnStalls;
+            }
+        }
+
+        requests.assign(_gameEventSpawns.begin(), _gameEventSpawns.begin() + count);
+        _gameEventSpawns.erase(_gameEventSpawns.begin(), _gameEventSpawns.begin() + count);
+    }
+
+    for (GameEventSpawnRequest const& request : requests)
+    {
+        if (ApplyGameEventSpawn(request))
+            ++_gameEventSpawnsApplied;
+        else
+            ++_gameEventSpawnsSkipped;
+    }
+}
+
+void Map::AddToRespawnQueue(Creature* creature, time_t respawnTime)
+{
+    _respawnQueue.insert(RespawnQueueEntry(respawnTime, creature->GetGUID()));
+}
+
+void Map::RemoveFromRespawnQueue(Creature* creature, time_t respawnTime)
+{
+    _respawnQueue.erase(RespawnQueueEntry(respawnTime, creature->GetGUID()));
+}
+
+void Map::ProcessRespawnQueue()
+{
+    time_t now = time(NULL);
+
+    // collect everything due first, creatures that cannot respawn yet queue themselves again
+    std::vector<ObjectGuid> due;
+    while (!_respawnQueue.empty() && _respawnQueue.begin()->first <= now)
+    {
+        RespawnQueueEntry const& entry = *_respawnQueue.begin();
+        // creatures that were unloaded, respawned or rescheduled since are skipped
+        Creature* creature = GetCreature(entry.second);
+        if (creature && creature->IsRespawnScheduled() && creature->GetScheduledRespawnTime() == entry.first)
+            due.push_back(entry.second);
+
+        _respawnQueue.erase(_respawnQueue.begin());
+    }
+
+    for (ObjectGuid const& guid : due)
+    {
+        if (Creature* creature = GetCreature(guid))
+        {
+            if (!creature->IsRespawnScheduled())
+                continue;
+
+            creature->HandleScheduledRespawn();
+            ++_respawnsWoken;
+            ++_respawnsWokenTotal;
+        }
+    }
+}
+
+bool Map::ApplyGameEventSpawn(GameEventSpawnRequest const& request)
+{
+    // the event may have been stopped or started again since the request was queued,
+    // the spawn ids currently placed in the grid by GameEventMgr tell which state is wanted
+    if (request.Type == TYPEID_UNIT)
+    {
+        CreatureData const* data = sObjectMgr->GetCreatureData(request.SpawnId);
+        if (!data)
+            return false;
+
+        CellObjectGuids const& cellGuids = sObjectMgr->GetCellObjectGuids(GetId(), GetSpawnMode(), Trinity::ComputeCellCoord(data->posX, data->posY).GetId());
+        bool const inGrid = cellGuids.creatures.find(request.SpawnId) != cellGuids.creatures.end();
+        if (request.Spawn)
+        {
+            // grids loaded in the meantime spawned it already
+            if (!inGrid || !IsGridLoaded(data->posX, data->posY) || _creatureBySpawnIdStore.find(request.SpawnId) != _creatureBySpawnIdStore.end())
+                return false;
+
+            Creature* creature = new Creature();
+            if (!creature->LoadCreatureFromDB(request.SpawnId, this))
+            {
+                delete creature;
+                return false;
+            }
+            return true;
+        }
+
+        if (inGrid)
+            return false;
+
+        auto creatureBounds = _creatureBySpawnIdStore.equal_range(request.SpawnId);
+        if (creatureBounds.first == creatureBounds.second)
+            return false;
+
+        for (auto itr = creatureBounds.first; itr != creatureBounds.second;)
+        {
+            Creature* creature = itr->second;
+            ++itr;
+            creature->AddObjectToRemoveList();
+        }
+        return true;
+    }
+
+    GameObjectData const* data = sObjectMgr->GetGOData(request.SpawnId);
+    if (!data)
+        return false;
+
+    CellObjectGuids const& cellGuids = sObjectMgr->GetCellObjectGuids(GetId(), GetSpawnMode(), Trinity::ComputeCellCoord(data->posX, data->posY).GetId());
+    bool const inGrid = cellGuids.gameobjects.find(request.SpawnId) != cellGuids.gameobjects.end();
+    if (request.Spawn)
+    {
+        if (!inGrid || !IsGridLoaded(data->posX, data->posY) || _gameobjectBySpawnIdStore.find(request.SpawnId) != _gameobjectBySpawnIdStore.end())
+            return false;
+
+        GameObject* gameobject = new GameObject();
+        /// @todo find out when it is add to map
+        if (!gameobject->LoadGameObjectFromDB(request.SpawnId, this, false))
+        {
+            delete gameobject;
+            return false;
+        }
+
+        if (gameobject->isSpawnedByDefault())
+            AddToMap(gameobject);
+        return true;
+    }
+
+    if (inGrid)
+        return false;
+
+    auto gameobjectBounds = _gameobjectBySpawnIdStore.equal_range(request.SpawnId);
+    if (gameobjectBounds.first == gameobjectBounds.second)
+        return false;
+
+    for (auto itr = gameobjectBounds.first; itr != gameobjectBounds.second;)
+    {
+        GameObject* go = itr->second;
+        ++itr;
+        go->AddObjectToRemoveList();
+    }
+    return true;
+}
+
 struct ResetNotifier
 {
     template<class T>inline void resetNotify(GridRefManager<T> &m)
@@ -972,7 +1238,15 @@ void Map::PlayerRelocation(Player* player, float x, float y, float z, float orie
         AddToGrid(player, new_cell);
     }
 
-    player->UpdateObjectVisibility(false);
+    // moves inside the same cell that stay close to where visibility was last built only
+    // update players, creature AI and the cells at the border of the visibility area,
+    // entering a new cell or moving further rebuilds it
+    float const lowerLimit = sWorld->getFloatConfig(CONFIG_VISIBILITY_RELOCATION_LOWER_LIMIT);
+    if (player->m_seer == player && !old_cell.DiffGrid(new_cell) && !old_cell.DiffCell(new_cell) &&
+        player->GetExactDist2dSq(&player->m_visibilityUpdatePosition) < lowerLimit * lowerLimit)
+        player->AddToNotify(NOTIFY_AI_RELOCATION);
+    else
+        player->UpdateObjectVisibility(false);
 }
 
 void Map::CreatureRelocation(Creature* creature, float x, float y, float z, float ang, bool respawnRelocationOnFail)
@@ -1609,6 +1883,8 @@ void Map::RemoveAllPlayers()
 
 void Map::UnloadAll()
 {
+    SaveRespawnJournal();
+
     // clear all delayed moves, useless anyway do this moves before map unload.
     _creaturesToMove.clear();
     _gameObjectsToMove.clear();
@@ -2585,8 +2861,21 @@ float Map::GetWaterLevel(float x, float y) const
 
 bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask) const
 {
-    return VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2)
+    uint32 const cacheTime = sWorld->getIntConfig(CONFIG_VMAP_LOS_CACHE_TIME);
+    if (!cacheTime)
+        return VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2)
+            && _dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask);
+
+    LineOfSightCache::Key key(x1, y1, z1, x2, y2, z2, phasemask);
+    uint32 const now = getMSTime();
+    bool result;
+    if (_lineOfSightCache.Find(key, now, cacheTime, result))
+        return result;
+
+    result = VMAP::VMapFactory::createOrGetVMapManager()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2)
         && _dynamicTree.isInLineOfSight(x1, y1, z1, x2, y2, z2, phasemask);
+    _lineOfSightCache.Insert(key, now, result);
+    return result;
 }
 
 bool Map::getObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist)
@@ -3417,6 +3706,21 @@ BattlegroundMap::~BattlegroundMap()
     }
 }
 
+void BattlegroundMap::Update(const uint32 t_diff)
+{
+    Map::Update(t_diff);
+
+    // the battleground logic runs here, on the map update thread, and not in BattlegroundMgr::Update
+    // finished battlegrounds are deleted by BattlegroundMgr on the world thread
+    if (m_bg && !m_bg->ToBeDeleted())
+    {
+        auto start = std::chrono::steady_clock::now();
+        m_bg->Update(t_diff);
+        if (m_bg)
+            m_bg->RecordUpdateTime(uint32(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()));
+    }
+}
+
 void BattlegroundMap::InitVisibilityDistance()
 {
     //init visibility distance for BG/Arenas
@@ -3525,6 +3829,12 @@ void Map::SaveCreatureRespawnTime(ObjectGuid::LowType dbGuid, time_t respawnTime
 
     _creatureRespawnTimes[dbGuid] = respawnTime;
 
+    if (sWorld->getIntConfig(CONFIG_RESPAWN_JOURNAL_SAVE_INTERVAL))
+    {
+        AddToRespawnJournal(_creatureRespawnJournal, dbGuid, respawnTime);
+        return;
+    }
+
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_CREATURE_RESPAWN);
     stmt->setUInt32(0, dbGuid);
     stmt->setUInt32(1, uint32(respawnTime));
@@ -3537,6 +3847,12 @@ void Map::RemoveCreatureRespawnTime(ObjectGuid::LowType dbGuid)
 {
     _creatureRespawnTimes.erase(dbGuid);
 
+    if (sWorld->getIntConfig(CONFIG_RESPAWN_JOURNAL_SAVE_INTERVAL))
+    {
+        AddToRespawnJournal(_creatureRespawnJournal, dbGuid, 0);
+        return;
+    }
+
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_CREATURE_RESPAWN);
     stmt->setUInt32(0, dbGuid);
     stmt->setUInt16(1, GetId());
@@ -3555,6 +3871,12 @@ void Map::SaveGORespawnTime(ObjectGuid::LowType dbGuid, time_t respawnTime)
 
     _goRespawnTimes[dbGuid] = respawnTime;
 
+    if (sWorld->getIntConfig(CONFIG_RESPAWN_JOURNAL_SAVE_INTERVAL))
+    {
+        AddToRespawnJournal(_goRespawnJournal, dbGuid, respawnTime);
+        return;
+    }
+
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_REP_GO_RESPAWN);
     stmt->setUInt32(0, dbGuid);
     stmt->setUInt32(1, uint32(respawnTime));
@@ -3567,6 +3889,12 @@ void Map::RemoveGORespawnTime(ObjectGuid::LowType dbGuid)
 {
     _goRespawnTimes.erase(dbGuid);
 
+    if (sWorld->getIntConfig(CONFIG_RESPAWN_JOURNAL_SAVE_INTERVAL))
+    {
+        AddToRespawnJournal(_goRespawnJournal, dbGuid, 0);
+        return;
+    }
+
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_GO_RESPAWN);
     stmt->setUInt32(0, dbGuid);
     stmt->setUInt16(1, GetId());
@@ -3574,6 +3902,86 @@ void Map::RemoveGORespawnTime(ObjectGuid::LowType dbGuid)
     CharacterDatabase.Execute(stmt);
 }
 
+void Map::AddToRespawnJournal(RespawnJournal& journal, ObjectGuid::LowType dbGuid, time_t respawnTime)
+{
+    journal[dbGuid] = respawnTime;
+    ++_respawnJournalUpdates;
+}
+
+static void SaveRespawnJournalRows(SQLTransaction& trans, char const* table, uint32 mapId, uint32 instanceId, std::unordered_map<ObjectGuid::LowType, time_t> const& journal)
+{
+    // every spawn appears only once, so the order of the replaces and deletes does not matter
+    uint32 const rowsPerStatement = 500;
+
+    std::ostringstream replace;
+    std::ostringstream remove;
+    uint32 replaceRows = 0;
+    uint32 removeRows = 0;
+
+    for (std::unordered_map<ObjectGuid::LowType, time_t>::const_iterator itr = journal.begin(); itr != journal.end(); ++itr)
+    {
+        if (itr->second)
+        {
+            if (!replaceRows)
+                replace << "REPLACE INTO " << table << " (guid, respawnTime, mapId, instanceId) VALUES ";
+            else
+                replace << ',';
+
+            replace << '(' << itr->first << ',' << uint32(itr->second) << ',' << mapId << ',' << instanceId << ')';
+            if (++replaceRows == rowsPerStatement)
+            {
+                trans->Append(replace.str().c_str());
+                replace.str("");
+                replaceRows = 0;
+            }
+        }
+        else
+        {
+            if (!removeRows)
+                remove << "DELETE FROM " << table << " WHERE mapId = " << mapId << " AND instanceId = " << instanceId << " AND guid IN (";
+            else
+                remove << ',';
+
+            remove << itr->first;
+            if (++removeRows == rowsPerStatement)
+            {
+                remove << ')';
+                trans->Append(remove.str().c_str());
+                remove.str("");
+                removeRows = 0;
+            }
+        }
+    }
+
+    if (replaceRows)
+        trans->Append(replace.str().c_str());
+
+    if (removeRows)
+    {
+        remove << ')';
+        trans->Append(remove.str().c_str());
+    }
+}
+
+void Map::SaveRespawnJournal()
+{
+    if (_creatureRespawnJournal.empty() && _goRespawnJournal.empty())
+        return;
+
+    uint32 rows = uint32(_creatureRespawnJournal.size() + _goRespawnJournal.size());
+
+    SQLTransaction trans = CharacterDatabase.BeginTransaction();
+    SaveRespawnJournalRows(trans, "creature_respawn", GetId(), GetInstanceId(), _creatureRespawnJournal);
+    SaveRespawnJournalRows(trans, "gameobject_respawn", GetId(), GetInstanceId(), _goRespawnJournal);
+    CharacterDatabase.CommitTransaction(trans);
+
+    TC_LOG_DEBUG("maps", "Map %u (instance %u): saved %u respawn times for %u changes", GetId(), GetInstanceId(), rows, _respawnJournalUpdates);
+
+    _creatureRespawnJournal.clear();
+    _goRespawnJournal.clear();
+    _respawnJournalUpdates = 0;
+}
+
 void Map::LoadRespawnTimes()
 {
     PreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CREATURE_RESPAWNS);
@@ -3611,6 +4019,9 @@ void Map::DeleteRespawnTimes()
 {
     _creatureRespawnTimes.clear();
     _goRespawnTimes.clear();
+    _creatureRespawnJournal.clear();
+    _goRespawnJournal.clear();
+    _respawnJournalUpdates = 0;
 
     DeleteRespawnTimesInDB(GetId(), GetInstanceId());
 }
@@ -30,9 +30,11 @@
 #include "MapRefManager.h"
 #include "DynamicTree.h"
 #include "GameObjectModel.h"
+#include "LineOfSightCache.h"
 #include "ObjectGuid.h"
 
 #include <bitset>
+#include <deque>
 #include <list>
 #include <memory>
 
@@ -498,9 +500,34 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         float GetHeight(uint32 phasemask, float x, float y, float z, bool vmap = true, float maxSearchDist = DEFAULT_HEIGHT_SEARCH) const;
         bool isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask) const;
         void Balance() { _dynamicTree.balance(); }
-        void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); }
-        void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); }
+        void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); InvalidateLineOfSightCache(model.getBounds()); }
+        void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); InvalidateLineOfSightCache(model.getBounds()); }
+        void InvalidateLineOfSightCache(G3D::AABox const& bounds) { _lineOfSightCache.Invalidate(bounds); }
+        LineOfSightCache const& GetLineOfSightCache() const { return _lineOfSightCache; }
+
+        // Time the map update thread spent loading grids synchronously
+        uint32 GetGridLoadCount() const { return _gridLoadCount; }
+        uint32 GetGridLoadStallTime() const { return _gridLoadStallTime; }
+        uint32 GetGridLoadMaxStall() const { return _gridLoadMaxStall; }
+
+        // Game event spawns and despawns, applied a few at a time by Update()
+        void AddGameEventSpawn(TypeID type, ObjectGuid::LowType spawnId, bool spawn);
+        uint32 GetPendingGameEventSpawnCount() const;
+        uint32 GetGameEventSpawnsApplied() const { return _gameEventSpawnsApplied; }
+        uint32 GetGameEventSpawnsSkipped() const { return _gameEventSpawnsSkipped; }
+        uint32 GetGameEventSpawnStalls() const { return _gameEventSpawnStalls; }
+
+        // Dead creatures are woken by the respawn queue when their respawn time is due
+        void AddToRespawnQueue(Creature* creature, time_t respawnTime);
+        void RemoveFromRespawnQueue(Creature* creature, time_t respawnTime);
+        void CountPolledRespawn() { ++_respawnsPolled; }
+        uint32 GetRespawnQueueSize() const { return uint32(_respawnQueue.size()); }
+        uint32 GetLastRespawnsPolled() const { return _lastRespawnsPolled; }
+        uint32 GetLastRespawnsWoken() const { return _lastRespawnsWoken; }
+        uint64 GetRespawnsWokenTotal() const { return _respawnsWokenTotal; }
         bool ContainsGameObjectModel(const GameObjectModel& model) const { return _dynamicTree.contains(model);}
+        int GetGameObjectModelCount() const { return _dynamicTree.size(); }
+        void GetGameObjectModelRebuildStats(uint32& rebuilds, uint64& rebuildTime) const { _dynamicTree.getRebuildStats(rebuilds, rebuildTime); }
         bool getObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float &ry, float& rz, float modifyDist);
 
         /*
@@ -531,6 +558,7 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void RemoveGORespawnTime(ObjectGuid::LowType dbGuid);
         void LoadRespawnTimes();
         void DeleteRespawnTimes();
+        void SaveRespawnJournal();
 
         void LoadCorpseData();
         void DeleteCorpseData();
@@ -613,6 +641,18 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         void EnsureGridCreated_i(const GridCoord &);
         bool EnsureGridLoaded(Cell const&);
         void EnsureGridLoadedForActiveObject(Cell const&, WorldObject* object);
+        void RequestGridPreloads();
+
+        struct GameEventSpawnRequest
+        {
+            TypeID Type;
+            ObjectGuid::LowType SpawnId;
+            bool Spawn;
+        };
+
+        void ProcessGameEventSpawns();
+        void ProcessRespawnQueue();
+        bool ApplyGameEventSpawn(GameEventSpawnRequest const& request);
 
         void buildNGridLinkage(NGridType* pNGridType) { pNGridType->link(this); }
 
@@ -644,6 +684,26 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         uint32 m_unloadTimer;
         float m_VisibleDistance;
         DynamicMapTree _dynamicTree;
+        mutable LineOfSightCache _lineOfSightCache;
+
+        uint32 _gridPreloadTimer;
+        uint32 _gridLoadCount;
+        uint32 _gridLoadStallTime;
+        uint32 _gridLoadMaxStall;
+
+        mutable std::mutex _gameEventSpawnLock;
+        std::deque<GameEventSpawnRequest> _gameEventSpawns;
+        uint32 _gameEventSpawnsApplied;
+        uint32 _gameEventSpawnsSkipped;
+        uint32 _gameEventSpawnStalls;                       // updates that left requests for the next one
+
+        typedef std::pair<time_t, ObjectGuid> RespawnQueueEntry;
+        std::set<RespawnQueueEntry> _respawnQueue;          // ordered by respawn time
+        uint32 _respawnsPolled;
+        uint32 _respawnsWoken;
+        uint32 _lastRespawnsPolled;
+        uint32 _lastRespawnsWoken;
+        uint64 _respawnsWokenTotal;
 
         MapRefManager m_mapRefManager;
         MapRefManager::iterator m_mapRefIter;
@@ -722,6 +782,14 @@ class TC_GAME_API Map : public GridRefManager<NGridType>
         std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _creatureRespawnTimes;
         std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _goRespawnTimes;
 
+        // respawn times not written to the DB yet, latest value per spawn, 0 to delete
+        typedef std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> RespawnJournal;
+        void AddToRespawnJournal(RespawnJournal& journal, ObjectGuid::LowType dbGuid, time_t respawnTime);
+        RespawnJournal _creatureRespawnJournal;
+        RespawnJournal _goRespawnJournal;
+        uint32 _respawnJournalTimer;
+        uint32 _respawnJournalUpdates;                      // journaled changes since the last save
+
         ZoneDynamicInfoMap _zoneDynamicInfo;
         uint32 _defaultLight;
 
@@ -794,6 +862,7 @@ class TC_GAME_API BattlegroundMap : public Map
         BattlegroundMap(uint32 id, time_t, uint32 InstanceId, Map* _parent, uint8 spawnMode);
         ~BattlegroundMap();
 
+        void Update(const uint32) override;
         bool AddPlayerToMap(Player*) override;
         void RemovePlayerFromMap(Player*, bool) override;
         EnterState CannotEnter(Player* player) override;
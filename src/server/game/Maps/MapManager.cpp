@@ -23,6 +23,7 @@
 #include "ObjectAccessor.h"
 #include "Transport.h"
 #include "GridDefines.h"
+#include "GridPreloader.h"
 #include "MapInstanced.h"
 #include "InstanceScript.h"
 #include "Config.h"
@@ -54,6 +55,9 @@ void MapManager::Initialize()
     // Start mtmaps if needed.
     if (num_threads > 0)
         m_updater.activate(num_threads);
+
+    if (sWorld->getBoolConfig(CONFIG_GRID_PRELOAD))
+        sGridPreloader->Start(sWorld->GetDataPath());
 }
 
 void MapManager::InitializeVisibilityDistanceInfo()
@@ -211,6 +215,8 @@ Map::EnterState MapManager::PlayerCannotEnter(uint32 mapid, Player* player, bool
 
 void MapManager::Update(uint32 diff)
 {
+    sGridPreloader->Update(diff);
+
     i_timer.Update(diff);
     if (!i_timer.Passed())
         return;
@@ -268,6 +274,8 @@ void MapManager::UnloadAll()
     if (m_updater.activated())
         m_updater.deactivate();
 
+    sGridPreloader->Stop();
+
     Map::DeleteStateMachine();
 }
 
@@ -220,10 +220,6 @@ class ScriptRegistry
         return R; \
     for (SCR_REG_ITR(T) C = SCR_REG_LST(T).begin(); \
         C != SCR_REG_LST(T).end(); ++C)
-#define FOREACH_SCRIPT(T) \
-    FOR_SCRIPTS(T, itr, end) \
-    itr->second
-
 // Utility macros for finding specific scripts.
 #define GET_SCRIPT(T, I, V) \
     T* V = ScriptRegistry<T>::GetScriptById(I); \
@@ -234,6 +230,170 @@ class ScriptRegistry
     if (!V) \
         return R;
 
+bool ScriptObject::ImplementsHook(char const* hook) const
+{
+    return _hooks.empty() || std::find(_hooks.begin(), _hooks.end(), hook) != _hooks.end();
+}
+
+void ScriptObject::RegisterHooks(std::initializer_list<char const*> hooks)
+{
+    _hooks.insert(_hooks.end(), hooks.begin(), hooks.end());
+}
+
+class ScriptHookBase;
+
+// All hooks are known here once they were called for the first time, used for (re)subscribing and profiling
+static std::vector<ScriptHookBase*> ScriptHooks;
+static std::mutex ScriptHooksLock;
+static bool ScriptHooksSubscribed = false;
+// Debug.ScriptHookStats, counting every call from all map threads is too costly otherwise
+static std::atomic<bool> ScriptHookCallCounting(false);
+
+class ScriptHookBase
+{
+    public:
+
+        explicit ScriptHookBase(char const* name) : _name(name), _calls(0) { }
+        virtual ~ScriptHookBase() { }
+
+        virtual void Subscribe() = 0;
+        virtual void Unsubscribe() = 0;
+
+        ScriptHookProfile GetProfile() const
+        {
+            ScriptHookProfile profile;
+            profile.Name = _name;
+            profile.Calls = _calls.load(std::memory_order_relaxed);
+            profile.Subscribers = GetSubscriberCount();
+            profile.Scripts = GetScriptCount();
+            return profile;
+        }
+
+        void ResetCalls() { _calls.store(0, std::memory_order_relaxed); }
+
+    protected:
+
+        virtual uint32 GetSubscriberCount() const = 0;
+        virtual uint32 GetScriptCount() const = 0;
+
+        char const* _name;
+        std::atomic<uint64> _calls;
+};
+
+// Subscribers of a hook that is called for every script of a type.
+// The scripts of the registry implementing the hook (see ScriptObject::RegisterHooks) are subscribed once
+// all scripts are loaded. Subscriber lists are immutable once published so dispatching is lock free,
+// replaced lists are kept alive until the scripts are unloaded.
+template<class TScript>
+class ScriptHook : public ScriptHookBase
+{
+    public:
+
+        typedef std::vector<TScript*> SubscriberList;
+
+        explicit ScriptHook(char const* name) : ScriptHookBase(name), _subscribers(&_empty)
+        {
+            std::lock_guard<std::mutex> lock(ScriptHooksLock);
+            ScriptHooks.push_back(this);
+            if (ScriptHooksSubscribed)
+                Subscribe();
+        }
+
+        // Returns false when nothing has to be dispatched, counts the call with Debug.ScriptHookStats
+        bool Enter()
+        {
+            if (ScriptHookCallCounting.load(std::memory_order_relaxed))
+                _calls.fetch_add(1, std::memory_order_relaxed);
+
+            return !_subscribers.load(std::memory_order_acquire)->empty();
+        }
+
+        template<class Invoker>
+        void Call(Invoker&& invoker)
+        {
+            if (Enter())
+                Dispatch(std::forward<Invoker>(invoker));
+        }
+
+        template<class Invoker>
+        void Dispatch(Invoker&& invoker)
+        {
+            SubscriberList const* subscribers = _subscribers.load(std::memory_order_acquire);
+            for (TScript* script : *subscribers)
+                invoker(script);
+        }
+
+        void Subscribe() override
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            SubscriberList* subscribers = new SubscriberList();
+            for (auto const& pair : ScriptRegistry<TScript>::ScriptPointerList)
+                if (pair.second->ImplementsHook(_name))
+                    subscribers->push_back(pair.second);
+
+            Publish(subscribers);
+        }
+
+        void Unsubscribe() override
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            _subscribers.store(&_empty, std::memory_order_release);
+            _lists.clear();
+        }
+
+    protected:
+
+        uint32 GetSubscriberCount() const override { return uint32(_subscribers.load(std::memory_order_acquire)->size()); }
+        uint32 GetScriptCount() const override { return uint32(ScriptRegistry<TScript>::ScriptPointerList.size()); }
+
+    private:
+
+        void Publish(SubscriberList* subscribers)
+        {
+            _lists.emplace_back(subscribers);
+            _subscribers.store(subscribers, std::memory_order_release);
+        }
+
+        std::atomic<SubscriberList const*> _subscribers;
+        std::vector<std::unique_ptr<SubscriberList>> _lists;
+        std::mutex _lock;
+        SubscriberList const _empty;
+};
+
+// Calls a hook of every script of type T which implements it.
+#define FOREACH_SCRIPT_HOOK(T, N, H) \
+    static ScriptHook<T> N##Hook(#N); \
+    N##Hook.Call([&](T* script) { script->H; })
+
+// Map scripts by map id, built once all scripts are loaded
+template<class TScript>
+class MapScriptIndex
+{
+    public:
+
+        static void Build()
+        {
+            Scripts.clear();
+            for (auto const& pair : ScriptRegistry<TScript>::ScriptPointerList)
+                if (MapEntry const* entry = pair.second->GetEntry())
+                    Scripts.insert(std::make_pair(entry->MapID, pair.second));
+        }
+
+        static void Clear() { Scripts.clear(); }
+
+        static TScript* Find(uint32 mapId)
+        {
+            auto itr = Scripts.find(mapId);
+            return itr != Scripts.end() ? itr->second : nullptr;
+        }
+
+    private:
+
+        static std::unordered_map<uint32, TScript*> Scripts;
+};
+
+template<class TScript> std::unordered_map<uint32, TScript*> MapScriptIndex<TScript>::Scripts;
+
 struct TSpellSummary
 {
     uint8 Targets;                                          // set of enum SelectTarget
@@ -277,11 +437,33 @@ void ScriptMgr::Initialize()
     }
 #endif
 
+    MapScriptIndex<WorldMapScript>::Build();
+    MapScriptIndex<InstanceMapScript>::Build();
+    MapScriptIndex<BattlegroundMapScript>::Build();
+
+    {
+        std::lock_guard<std::mutex> lock(ScriptHooksLock);
+        ScriptHooksSubscribed = true;
+        for (ScriptHookBase* hook : ScriptHooks)
+            hook->Subscribe();
+    }
+
     TC_LOG_INFO("server.loading", ">> Loaded %u C++ scripts in %u ms", GetScriptCount(), GetMSTimeDiffToNow(oldMSTime));
 }
 
 void ScriptMgr::Unload()
 {
+    {
+        std::lock_guard<std::mutex> lock(ScriptHooksLock);
+        ScriptHooksSubscribed = false;
+        for (ScriptHookBase* hook : ScriptHooks)
+            hook->Unsubscribe();
+    }
+
+    MapScriptIndex<WorldMapScript>::Clear();
+    MapScriptIndex<InstanceMapScript>::Clear();
+    MapScriptIndex<BattlegroundMapScript>::Clear();
+
     #define SCR_CLEAR(T) \
         for (T* scr : SCR_REG_VEC(T)) \
             delete scr; \
@@ -321,6 +503,35 @@ void ScriptMgr::Unload()
     delete[] UnitAI::AISpellInfo;
 }
 
+std::vector<ScriptHookProfile> ScriptMgr::GetHookProfile() const
+{
+    std::vector<ScriptHookProfile> profile;
+
+    std::lock_guard<std::mutex> lock(ScriptHooksLock);
+    profile.reserve(ScriptHooks.size());
+    for (ScriptHookBase const* hook : ScriptHooks)
+        profile.push_back(hook->GetProfile());
+
+    return profile;
+}
+
+void ScriptMgr::SetHookCallCounting(bool enable)
+{
+    ScriptHookCallCounting = enable;
+}
+
+bool ScriptMgr::IsHookCallCounting() const
+{
+    return ScriptHookCallCounting;
+}
+
+void ScriptMgr::ResetHookProfile()
+{
+    std::lock_guard<std::mutex> lock(ScriptHooksLock);
+    for (ScriptHookBase* hook : ScriptHooks)
+        hook->ResetCalls();
+}
+
 void ScriptMgr::LoadDatabase()
 {
     sScriptSystemMgr->LoadScriptWaypoints();
@@ -472,101 +683,103 @@ void ScriptMgr::CreateSpellScriptLoaders(uint32 spellId, std::vector<std::pair<S
 
 void ScriptMgr::OnNetworkStart()
 {
-    FOREACH_SCRIPT(ServerScript)->OnNetworkStart();
+    FOREACH_SCRIPT_HOOK(ServerScript, OnNetworkStart, OnNetworkStart());
 }
 
 void ScriptMgr::OnNetworkStop()
 {
-    FOREACH_SCRIPT(ServerScript)->OnNetworkStop();
+    FOREACH_SCRIPT_HOOK(ServerScript, OnNetworkStop, OnNetworkStop());
 }
 
 void ScriptMgr::OnSocketOpen(std::shared_ptr<WorldSocket> socket)
 {
     ASSERT(socket);
 
-    FOREACH_SCRIPT(ServerScript)->OnSocketOpen(socket);
+    FOREACH_SCRIPT_HOOK(ServerScript, OnSocketOpen, OnSocketOpen(socket));
 }
 
 void ScriptMgr::OnSocketClose(std::shared_ptr<WorldSocket> socket)
 {
     ASSERT(socket);
 
-    FOREACH_SCRIPT(ServerScript)->OnSocketClose(socket);
+    FOREACH_SCRIPT_HOOK(ServerScript, OnSocketClose, OnSocketClose(socket));
 }
 
 void ScriptMgr::OnPacketReceive(WorldSession* session, WorldPacket const& packet)
 {
-    if (SCR_REG_LST(ServerScript).empty())
+    static ScriptHook<ServerScript> OnPacketReceiveHook("OnPacketReceive");
+    if (!OnPacketReceiveHook.Enter())
         return;
 
     WorldPacket copy(packet);
-    FOREACH_SCRIPT(ServerScript)->OnPacketReceive(session, copy);
+    OnPacketReceiveHook.Dispatch([&](ServerScript* script) { script->OnPacketReceive(session, copy); });
 }
 
 void ScriptMgr::OnPacketSend(WorldSession* session, WorldPacket const& packet)
 {
     ASSERT(session);
 
-    if (SCR_REG_LST(ServerScript).empty())
+    static ScriptHook<ServerScript> OnPacketSendHook("OnPacketSend");
+    if (!OnPacketSendHook.Enter())
         return;
 
     WorldPacket copy(packet);
-    FOREACH_SCRIPT(ServerScript)->OnPacketSend(session, copy);
+    OnPacketSendHook.Dispatch([&](ServerScript* script) { script->OnPacketSend(session, copy); });
 }
 
 void ScriptMgr::OnOpenStateChange(bool open)
 {
-    FOREACH_SCRIPT(WorldScript)->OnOpenStateChange(open);
+    FOREACH_SCRIPT_HOOK(WorldScript, OnOpenStateChange, OnOpenStateChange(open));
 }
 
 void ScriptMgr::OnConfigLoad(bool reload)
 {
-    FOREACH_SCRIPT(WorldScript)->OnConfigLoad(reload);
+    FOREACH_SCRIPT_HOOK(WorldScript, OnConfigLoad, OnConfigLoad(reload));
 }
 
 void ScriptMgr::OnMotdChange(std::string& newMotd)
 {
-    FOREACH_SCRIPT(WorldScript)->OnMotdChange(newMotd);
+    FOREACH_SCRIPT_HOOK(WorldScript, OnMotdChange, OnMotdChange(newMotd));
 }
 
 void ScriptMgr::OnShutdownInitiate(ShutdownExitCode code, ShutdownMask mask)
 {
-    FOREACH_SCRIPT(WorldScript)->OnShutdownInitiate(code, mask);
+    FOREACH_SCRIPT_HOOK(WorldScript, OnShutdownInitiate, OnShutdownInitiate(code, mask));
 }
 
 void ScriptMgr::OnShutdownCancel()
 {
-    FOREACH_SCRIPT(WorldScript)->OnShutdownCancel();
+    FOREACH_SCRIPT_HOOK(WorldScript, OnShutdownCancel, OnShutdownCancel());
 }
 
 void ScriptMgr::OnWorldUpdate(uint32 diff)
 {
-    FOREACH_SCRIPT(WorldScript)->OnUpdate(diff);
+    FOREACH_SCRIPT_HOOK(WorldScript, OnWorldUpdate, OnUpdate(diff));
 }
 
 void ScriptMgr::OnHonorCalculation(float& honor, uint8 level, float multiplier)
 {
-    FOREACH_SCRIPT(FormulaScript)->OnHonorCalculation(honor, level, multiplier);
+    FOREACH_SCRIPT_HOOK(FormulaScript, OnHonorCalculation, OnHonorCalculation(honor, level, multiplier));
 }
 
 void ScriptMgr::OnGrayLevelCalculation(uint8& grayLevel, uint8 playerLevel)
 {
-    FOREACH_SCRIPT(FormulaScript)->OnGrayLevelCalculation(grayLevel, playerLevel);
+    FOREACH_SCRIPT_HOOK(FormulaScript, OnGrayLevelCalculation, OnGrayLevelCalculation(grayLevel, playerLevel));
 }
 
 void ScriptMgr::OnColorCodeCalculation(XPColorChar& color, uint8 playerLevel, uint8 mobLevel)
 {
-    FOREACH_SCRIPT(FormulaScript)->OnColorCodeCalculation(color, playerLevel, mobLevel);
+    FOREACH_SCRIPT_HOOK(FormulaScript, OnColorCodeCalculation, OnColorCodeCalculation(color, playerLevel, mobLevel));
 }
 
 void ScriptMgr::OnZeroDifferenceCalculation(uint8& diff, uint8 playerLevel)
 {
-    FOREACH_SCRIPT(FormulaScript)->OnZeroDifferenceCalculation(diff, playerLevel);
+    FOREACH_SCRIPT_HOOK(FormulaScript, OnZeroDifferenceCalculation, OnZeroDifferenceCalculation(diff, playerLevel));
 }
 
 void ScriptMgr::OnBaseGainCalculation(uint32& gain, uint8 playerLevel, uint8 mobLevel, ContentLevels content)
 {
-    FOREACH_SCRIPT(FormulaScript)->OnBaseGainCalculation(gain, playerLevel, mobLevel, content);
+    FOREACH_SCRIPT_HOOK(FormulaScript, OnBaseGainCalculation, OnBaseGainCalculation(gain, playerLevel, mobLevel, content));
 }
 
 void ScriptMgr::OnGainCalculation(uint32& gain, Player* player, Unit* unit)
@@ -574,28 +787,22 @@ void ScriptMgr::OnGainCalculation(uint32& gain, Player* player, Unit* unit)
     ASSERT(player);
     ASSERT(unit);
 
-    FOREACH_SCRIPT(FormulaScript)->OnGainCalculation(gain, player, unit);
+    FOREACH_SCRIPT_HOOK(FormulaScript, OnGainCalculation, OnGainCalculation(gain, player, unit));
 }
 
 void ScriptMgr::OnGroupRateCalculation(float& rate, uint32 count, bool isRaid)
 {
-    FOREACH_SCRIPT(FormulaScript)->OnGroupRateCalculation(rate, count, isRaid);
+    FOREACH_SCRIPT_HOOK(FormulaScript, OnGroupRateCalculation, OnGroupRateCalculation(rate, count, isRaid));
 }
 
-#define SCR_MAP_BGN(M, V, I, E, C, T) \
+#define SCR_MAP_BGN(M, V, I, T) \
     if (V->GetEntry() && V->GetEntry()->T()) \
     { \
-        FOR_SCRIPTS(M, I, E) \
-        { \
-            MapEntry const* C = I->second->GetEntry(); \
-            if (!C) \
-                continue; \
-            if (C->MapID == V->GetId()) \
-            {
+        if (M* I = MapScriptIndex<M>::Find(V->GetId())) \
+        {
 
 #define SCR_MAP_END \
-                return; \
-            } \
+            return; \
         } \
     }
 
@@ -603,16 +810,16 @@ void ScriptMgr::OnCreateMap(Map* map)
 {
     ASSERT(map);
 
-    SCR_MAP_BGN(WorldMapScript, map, itr, end, entry, IsWorldMap);
-        itr->second->OnCreate(map);
+    SCR_MAP_BGN(WorldMapScript, map, script, IsWorldMap);
+        script->OnCreate(map);
     SCR_MAP_END;
 
-    SCR_MAP_BGN(InstanceMapScript, map, itr, end, entry, IsDungeon);
-        itr->second->OnCreate((InstanceMap*)map);
+    SCR_MAP_BGN(InstanceMapScript, map, script, IsDungeon);
+        script->OnCreate((InstanceMap*)map);
     SCR_MAP_END;
 
-    SCR_MAP_BGN(BattlegroundMapScript, map, itr, end, entry, IsBattleground);
-        itr->second->OnCreate((BattlegroundMap*)map);
+    SCR_MAP_BGN(BattlegroundMapScript, map, script, IsBattleground);
+        script->OnCreate((BattlegroundMap*)map);
     SCR_MAP_END;
 }
 
@@ -620,16 +827,16 @@ void ScriptMgr::OnDestroyMap(Map* map)
 {
     ASSERT(map);
 
-    SCR_MAP_BGN(WorldMapScript, map, itr, end, entry, IsWorldMap);
-        itr->second->OnDestroy(map);
+    SCR_MAP_BGN(WorldMapScript, map, script, IsWorldMap);
+        script->OnDestroy(map);
     SCR_MAP_END;
 
-    SCR_MAP_BGN(InstanceMapScript, map, itr, end, entry, IsDungeon);
-        itr->second->OnDestroy((InstanceMap*)map);
+    SCR_MAP_BGN(InstanceMapScript, map, script, IsDungeon);
+        script->OnDestroy((InstanceMap*)map);
     SCR_MAP_END;
 
-    SCR_MAP_BGN(BattlegroundMapScript, map, itr, end, entry, IsBattleground);
-        itr->second->OnDestroy((BattlegroundMap*)map);
+    SCR_MAP_BGN(BattlegroundMapScript, map, script, IsBattleground);
+        script->OnDestroy((BattlegroundMap*)map);
     SCR_MAP_END;
 }
 
@@ -638,16 +845,16 @@ void ScriptMgr::OnLoadGridMap(Map* map, GridMap* gmap, uint32 gx, uint32 gy)
     ASSERT(map);
     ASSERT(gmap);
 
-    SCR_MAP_BGN(WorldMapScript, map, itr, end, entry, IsWorldMap);
-        itr->second->OnLoadGridMap(map, gmap, gx, gy);
+    SCR_MAP_BGN(WorldMapScript, map, script, IsWorldMap);
+        script->OnLoadGridMap(map, gmap, gx, gy);
     SCR_MAP_END;
 
-    SCR_MAP_BGN(InstanceMapScript, map, itr, end, entry, IsDungeon);
-        itr->second->OnLoadGridMap((InstanceMap*)map, gmap, gx, gy);
+    SCR_MAP_BGN(InstanceMapScript, map, script, IsDungeon);
+        script->OnLoadGridMap((InstanceMap*)map, gmap, gx, gy);
     SCR_MAP_END;
 
-    SCR_MAP_BGN(BattlegroundMapScript, map, itr, end, entry, IsBattleground);
-        itr->second->OnLoadGridMap((BattlegroundMap*)map, gmap, gx, gy);
+    SCR_MAP_BGN(BattlegroundMapScript, map, script, IsBattleground);
+        script->OnLoadGridMap((BattlegroundMap*)map, gmap, gx, gy);
     SCR_MAP_END;
 }
 
@@ -656,16 +863,16 @@ void ScriptMgr::OnUnloadGridMap(Map* map, GridMap* gmap, uint32 gx, uint32 gy)
     ASSERT(map);
     ASSERT(gmap);
 
-    SCR_MAP_BGN(WorldMapScript, map, itr, end, entry, IsWorldMap);
-        itr->second->OnUnloadGridMap(map, gmap, gx, gy);
+    SCR_MAP_BGN(WorldMapScript, map, script, IsWorldMap);
+        script->OnUnloadGridMap(map, gmap, gx, gy);
     SCR_MAP_END;
 
-    SCR_MAP_BGN(InstanceMapScript, map, itr, end, entry, IsDungeon);
-        itr->second->OnUnloadGridMap((InstanceMap*)map, gmap, gx, gy);
+    SCR_MAP_BGN(InstanceMapScript, map, script, IsDungeon);
+        script->OnUnloadGridMap((InstanceMap*)map, gmap, gx, gy);
     SCR_MAP_END;
 
-    SCR_MAP_BGN(BattlegroundMapScript, map, itr, end, entry, IsBattleground);
-        itr->second->OnUnloadGridMap((BattlegroundMap*)map, gmap, gx, gy);
+    SCR_MAP_BGN(BattlegroundMapScript, map, script, IsBattleground);
+        script->OnUnloadGridMap((BattlegroundMap*)map, gmap, gx, gy);
     SCR_MAP_END;
 }
 
@@ -674,18 +881,18 @@ void ScriptMgr::OnPlayerEnterMap(Map* map, Player* player)
     ASSERT(map);
     ASSERT(player);
 
-    FOREACH_SCRIPT(PlayerScript)->OnMapChanged(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerMapChanged, OnMapChanged(player));
 
-    SCR_MAP_BGN(WorldMapScript, map, itr, end, entry, IsWorldMap);
-        itr->second->OnPlayerEnter(map, player);
+    SCR_MAP_BGN(WorldMapScript, map, script, IsWorldMap);
+        script->OnPlayerEnter(map, player);
     SCR_MAP_END;
 
-    SCR_MAP_BGN(InstanceMapScript, map, itr, end, entry, IsDungeon);
-        itr->second->OnPlayerEnter((InstanceMap*)map, player);
+    SCR_MAP_BGN(InstanceMapScript, map, script, IsDungeon);
+        script->OnPlayerEnter((InstanceMap*)map, player);
     SCR_MAP_END;
 
-    SCR_MAP_BGN(BattlegroundMapScript, map, itr, end, entry, IsBattleground);
-        itr->second->OnPlayerEnter((BattlegroundMap*)map, player);
+    SCR_MAP_BGN(BattlegroundMapScript, map, script, IsBattleground);
+        script->OnPlayerEnter((BattlegroundMap*)map, player);
     SCR_MAP_END;
 }
 
@@ -694,16 +901,16 @@ void ScriptMgr::OnPlayerLeaveMap(Map* map, Player* player)
     ASSERT(map);
     ASSERT(player);
 
-    SCR_MAP_BGN(WorldMapScript, map, itr, end, entry, IsWorldMap);
-        itr->second->OnPlayerLeave(map, player);
+    SCR_MAP_BGN(WorldMapScript, map, script, IsWorldMap);
+        script->OnPlayerLeave(map, player);
     SCR_MAP_END;
 
-    SCR_MAP_BGN(InstanceMapScript, map, itr, end, entry, IsDungeon);
-        itr->second->OnPlayerLeave((InstanceMap*)map, player);
+    SCR_MAP_BGN(InstanceMapScript, map, script, IsDungeon);
+        script->OnPlayerLeave((InstanceMap*)map, player);
     SCR_MAP_END;
 
-    SCR_MAP_BGN(BattlegroundMapScript, map, itr, end, entry, IsBattleground);
-        itr->second->OnPlayerLeave((BattlegroundMap*)map, player);
+    SCR_MAP_BGN(BattlegroundMapScript, map, script, IsBattleground);
+        script->OnPlayerLeave((BattlegroundMap*)map, player);
     SCR_MAP_END;
 }
 
@@ -711,16 +918,16 @@ void ScriptMgr::OnMapUpdate(Map* map, uint32 diff)
 {
     ASSERT(map);
 
-    SCR_MAP_BGN(WorldMapScript, map, itr, end, entry, IsWorldMap);
-        itr->second->OnUpdate(map, diff);
+    SCR_MAP_BGN(WorldMapScript, map, script, IsWorldMap);
+        script->OnUpdate(map, diff);
     SCR_MAP_END;
 
-    SCR_MAP_BGN(InstanceMapScript, map, itr, end, entry, IsDungeon);
-        itr->second->OnUpdate((InstanceMap*)map, diff);
+    SCR_MAP_BGN(InstanceMapScript, map, script, IsDungeon);
+        script->OnUpdate((InstanceMap*)map, diff);
     SCR_MAP_END;
 
-    SCR_MAP_BGN(BattlegroundMapScript, map, itr, end, entry, IsBattleground);
-        itr->second->OnUpdate((BattlegroundMap*)map, diff);
+    SCR_MAP_BGN(BattlegroundMapScript, map, script, IsBattleground);
+        script->OnUpdate((BattlegroundMap*)map, diff);
     SCR_MAP_END;
 }
 
@@ -1061,7 +1268,7 @@ void ScriptMgr::OnAuctionAdd(AuctionHouseObject* ah, AuctionEntry* entry)
     ASSERT(ah);
     ASSERT(entry);
 
-    FOREACH_SCRIPT(AuctionHouseScript)->OnAuctionAdd(ah, entry);
+    FOREACH_SCRIPT_HOOK(AuctionHouseScript, OnAuctionAdd, OnAuctionAdd(ah, entry));
 }
 
 void ScriptMgr::OnAuctionRemove(AuctionHouseObject* ah, AuctionEntry* entry)
@@ -1069,7 +1276,7 @@ void ScriptMgr::OnAuctionRemove(AuctionHouseObject* ah, AuctionEntry* entry)
     ASSERT(ah);
     ASSERT(entry);
 
-    FOREACH_SCRIPT(AuctionHouseScript)->OnAuctionRemove(ah, entry);
+    FOREACH_SCRIPT_HOOK(AuctionHouseScript, OnAuctionRemove, OnAuctionRemove(ah, entry));
 }
 
 void ScriptMgr::OnAuctionSuccessful(AuctionHouseObject* ah, AuctionEntry* entry)
@@ -1077,7 +1284,7 @@ void ScriptMgr::OnAuctionSuccessful(AuctionHouseObject* ah, AuctionEntry* entry)
     ASSERT(ah);
     ASSERT(entry);
 
-    FOREACH_SCRIPT(AuctionHouseScript)->OnAuctionSuccessful(ah, entry);
+    FOREACH_SCRIPT_HOOK(AuctionHouseScript, OnAuctionSuccessful, OnAuctionSuccessful(ah, entry));
 }
 
 void ScriptMgr::OnAuctionExpire(AuctionHouseObject* ah, AuctionEntry* entry)
@@ -1085,7 +1292,7 @@ void ScriptMgr::OnAuctionExpire(AuctionHouseObject* ah, AuctionEntry* entry)
     ASSERT(ah);
     ASSERT(entry);
 
-    FOREACH_SCRIPT(AuctionHouseScript)->OnAuctionExpire(ah, entry);
+    FOREACH_SCRIPT_HOOK(AuctionHouseScript, OnAuctionExpire, OnAuctionExpire(ah, entry));
 }
 
 bool ScriptMgr::OnConditionCheck(Condition const* condition, ConditionSourceInfo& sourceInfo)
@@ -1204,12 +1411,12 @@ void ScriptMgr::OnRelocate(Transport* transport, uint32 waypointId, uint32 mapId
 
 void ScriptMgr::OnStartup()
 {
-    FOREACH_SCRIPT(WorldScript)->OnStartup();
+    FOREACH_SCRIPT_HOOK(WorldScript, OnStartup, OnStartup());
 }
 
 void ScriptMgr::OnShutdown()
 {
-    FOREACH_SCRIPT(WorldScript)->OnShutdown();
+    FOREACH_SCRIPT_HOOK(WorldScript, OnShutdown, OnShutdown());
 }
 
 bool ScriptMgr::OnCriteriaCheck(uint32 scriptId, Player* source, Unit* target)
@@ -1224,297 +1431,297 @@ bool ScriptMgr::OnCriteriaCheck(uint32 scriptId, Player* source, Unit* target)
 // Player
 void ScriptMgr::OnPVPKill(Player* killer, Player* killed)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnPVPKill(killer, killed);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPVPKill, OnPVPKill(killer, killed));
 }
 
 void ScriptMgr::OnCreatureKill(Player* killer, Creature* killed)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnCreatureKill(killer, killed);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnCreatureKill, OnCreatureKill(killer, killed));
 }
 
 void ScriptMgr::OnPlayerKilledByCreature(Creature* killer, Player* killed)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnPlayerKilledByCreature(killer, killed);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerKilledByCreature, OnPlayerKilledByCreature(killer, killed));
 }
 
 void ScriptMgr::OnPlayerLevelChanged(Player* player, uint8 oldLevel)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnLevelChanged(player, oldLevel);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerLevelChanged, OnLevelChanged(player, oldLevel));
 }
 
 void ScriptMgr::OnPlayerFreeTalentPointsChanged(Player* player, uint32 points)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnFreeTalentPointsChanged(player, points);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerFreeTalentPointsChanged, OnFreeTalentPointsChanged(player, points));
 }
 
 void ScriptMgr::OnPlayerTalentsReset(Player* player, bool noCost)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnTalentsReset(player, noCost);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerTalentsReset, OnTalentsReset(player, noCost));
 }
 
 void ScriptMgr::OnPlayerMoneyChanged(Player* player, int32& amount)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnMoneyChanged(player, amount);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerMoneyChanged, OnMoneyChanged(player, amount));
 }
 
 void ScriptMgr::OnPlayerMoneyLimit(Player* player, int32 amount)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnMoneyLimit(player, amount);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerMoneyLimit, OnMoneyLimit(player, amount));
 }
 
 void ScriptMgr::OnGivePlayerXP(Player* player, uint32& amount, Unit* victim)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnGiveXP(player, amount, victim);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnGivePlayerXP, OnGiveXP(player, amount, victim));
 }
 
 void ScriptMgr::OnPlayerReputationChange(Player* player, uint32 factionID, int32& standing, bool incremental)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnReputationChange(player, factionID, standing, incremental);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerReputationChange, OnReputationChange(player, factionID, standing, incremental));
 }
 
 void ScriptMgr::OnPlayerDuelRequest(Player* target, Player* challenger)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnDuelRequest(target, challenger);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerDuelRequest, OnDuelRequest(target, challenger));
 }
 
 void ScriptMgr::OnPlayerDuelStart(Player* player1, Player* player2)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnDuelStart(player1, player2);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerDuelStart, OnDuelStart(player1, player2));
 }
 
 void ScriptMgr::OnPlayerDuelEnd(Player* winner, Player* loser, DuelCompleteType type)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnDuelEnd(winner, loser, type);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerDuelEnd, OnDuelEnd(winner, loser, type));
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerChat, OnChat(player, type, lang, msg));
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Player* receiver)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, receiver);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerWhisper, OnChat(player, type, lang, msg, receiver));
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Group* group)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, group);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerGroupChat, OnChat(player, type, lang, msg, group));
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Guild* guild)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, guild);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerGuildChat, OnChat(player, type, lang, msg, guild));
 }
 
 void ScriptMgr::OnPlayerChat(Player* player, uint32 type, uint32 lang, std::string& msg, Channel* channel)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnChat(player, type, lang, msg, channel);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerChannelChat, OnChat(player, type, lang, msg, channel));
 }
 
 void ScriptMgr::OnPlayerEmote(Player* player, uint32 emote)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnEmote(player, emote);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerEmote, OnEmote(player, emote));
 }
 
 void ScriptMgr::OnPlayerTextEmote(Player* player, uint32 textEmote, uint32 emoteNum, ObjectGuid guid)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnTextEmote(player, textEmote, emoteNum, guid);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerTextEmote, OnTextEmote(player, textEmote, emoteNum, guid));
 }
 
 void ScriptMgr::OnPlayerSpellCast(Player* player, Spell* spell, bool skipCheck)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnSpellCast(player, spell, skipCheck);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerSpellCast, OnSpellCast(player, spell, skipCheck));
 }
 
 void ScriptMgr::OnPlayerLogin(Player* player, bool firstLogin)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnLogin(player, firstLogin);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerLogin, OnLogin(player, firstLogin));
 }
 
 void ScriptMgr::OnPlayerLogout(Player* player)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnLogout(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerLogout, OnLogout(player));
 }
 
 void ScriptMgr::OnPlayerCreate(Player* player)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnCreate(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerCreate, OnCreate(player));
 }
 
 void ScriptMgr::OnPlayerDelete(ObjectGuid guid, uint32 accountId)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnDelete(guid, accountId);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerDelete, OnDelete(guid, accountId));
 }
 
 void ScriptMgr::OnPlayerFailedDelete(ObjectGuid guid, uint32 accountId)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnFailedDelete(guid, accountId);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerFailedDelete, OnFailedDelete(guid, accountId));
 }
 
 void ScriptMgr::OnPlayerSave(Player* player)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnSave(player);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerSave, OnSave(player));
 }
 
 void ScriptMgr::OnPlayerBindToInstance(Player* player, Difficulty difficulty, uint32 mapid, bool permanent, uint8 extendState)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnBindToInstance(player, difficulty, mapid, permanent, extendState);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerBindToInstance, OnBindToInstance(player, difficulty, mapid, permanent, extendState));
 }
 
 void ScriptMgr::OnPlayerUpdateZone(Player* player, uint32 newZone, uint32 newArea)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnUpdateZone(player, newZone, newArea);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnPlayerUpdateZone, OnUpdateZone(player, newZone, newArea));
 }
 
 void ScriptMgr::OnQuestStatusChange(Player* player, uint32 questId, QuestStatus status)
 {
-    FOREACH_SCRIPT(PlayerScript)->OnQuestStatusChange(player, questId, status);
+    FOREACH_SCRIPT_HOOK(PlayerScript, OnQuestStatusChange, OnQuestStatusChange(player, questId, status));
 }
 
 // Account
 void ScriptMgr::OnAccountLogin(uint32 accountId)
 {
-    FOREACH_SCRIPT(AccountScript)->OnAccountLogin(accountId);
+    FOREACH_SCRIPT_HOOK(AccountScript, OnAccountLogin, OnAccountLogin(accountId));
 }
 
 void ScriptMgr::OnFailedAccountLogin(uint32 accountId)
 {
-    FOREACH_SCRIPT(AccountScript)->OnFailedAccountLogin(accountId);
+    FOREACH_SCRIPT_HOOK(AccountScript, OnFailedAccountLogin, OnFailedAccountLogin(accountId));
 }
 
 void ScriptMgr::OnEmailChange(uint32 accountId)
 {
-    FOREACH_SCRIPT(AccountScript)->OnEmailChange(accountId);
+    FOREACH_SCRIPT_HOOK(AccountScript, OnEmailChange, OnEmailChange(accountId));
 }
 
 void ScriptMgr::OnFailedEmailChange(uint32 accountId)
 {
-    FOREACH_SCRIPT(AccountScript)->OnFailedEmailChange(accountId);
+    FOREACH_SCRIPT_HOOK(AccountScript, OnFailedEmailChange, OnFailedEmailChange(accountId));
 }
 
 void ScriptMgr::OnPasswordChange(uint32 accountId)
 {
-    FOREACH_SCRIPT(AccountScript)->OnPasswordChange(accountId);
+    FOREACH_SCRIPT_HOOK(AccountScript, OnPasswordChange, OnPasswordChange(accountId));
 }
 
 void ScriptMgr::OnFailedPasswordChange(uint32 accountId)
 {
-    FOREACH_SCRIPT(AccountScript)->OnFailedPasswordChange(accountId);
+    FOREACH_SCRIPT_HOOK(AccountScript, OnFailedPasswordChange, OnFailedPasswordChange(accountId));
 }
 
 // Guild
 void ScriptMgr::OnGuildAddMember(Guild* guild, Player* player, uint8& plRank)
 {
-    FOREACH_SCRIPT(GuildScript)->OnAddMember(guild, player, plRank);
+    FOREACH_SCRIPT_HOOK(GuildScript, OnGuildAddMember, OnAddMember(guild, player, plRank));
 }
 
 void ScriptMgr::OnGuildRemoveMember(Guild* guild, Player* player, bool isDisbanding, bool isKicked)
 {
-    FOREACH_SCRIPT(GuildScript)->OnRemoveMember(guild, player, isDisbanding, isKicked);
+    FOREACH_SCRIPT_HOOK(GuildScript, OnGuildRemoveMember, OnRemoveMember(guild, player, isDisbanding, isKicked));
 }
 
 void ScriptMgr::OnGuildMOTDChanged(Guild* guild, const std::string& newMotd)
 {
-    FOREACH_SCRIPT(GuildScript)->OnMOTDChanged(guild, newMotd);
+    FOREACH_SCRIPT_HOOK(GuildScript, OnGuildMOTDChanged, OnMOTDChanged(guild, newMotd));
 }
 
 void ScriptMgr::OnGuildInfoChanged(Guild* guild, const std::string& newInfo)
 {
-    FOREACH_SCRIPT(GuildScript)->OnInfoChanged(guild, newInfo);
+    FOREACH_SCRIPT_HOOK(GuildScript, OnGuildInfoChanged, OnInfoChanged(guild, newInfo));
 }
 
 void ScriptMgr::OnGuildCreate(Guild* guild, Player* leader, const std::string& name)
 {
-    FOREACH_SCRIPT(GuildScript)->OnCreate(guild, leader, name);
+    FOREACH_SCRIPT_HOOK(GuildScript, OnGuildCreate, OnCreate(guild, leader, name));
 }
 
 void ScriptMgr::OnGuildDisband(Guild* guild)
 {
-    FOREACH_SCRIPT(GuildScript)->OnDisband(guild);
+    FOREACH_SCRIPT_HOOK(GuildScript, OnGuildDisband, OnDisband(guild));
 }
 
 void ScriptMgr::OnGuildMemberWitdrawMoney(Guild* guild, Player* player, uint32 &amount, bool isRepair)
 {
-    FOREACH_SCRIPT(GuildScript)->OnMemberWitdrawMoney(guild, player, amount, isRepair);
+    FOREACH_SCRIPT_HOOK(GuildScript, OnGuildMemberWitdrawMoney, OnMemberWitdrawMoney(guild, player, amount, isRepair));
 }
 
 void ScriptMgr::OnGuildMemberDepositMoney(Guild* guild, Player* player, uint32 &amount)
 {
-    FOREACH_SCRIPT(GuildScript)->OnMemberDepositMoney(guild, player, amount);
+    FOREACH_SCRIPT_HOOK(GuildScript, OnGuildMemberDepositMoney, OnMemberDepositMoney(guild, player, amount));
 }
 
 void ScriptMgr::OnGuildItemMove(Guild* guild, Player* player, Item* pItem, bool isSrcBank, uint8 srcContainer, uint8 srcSlotId,
             bool isDestBank, uint8 destContainer, uint8 destSlotId)
 {
-    FOREACH_SCRIPT(GuildScript)->OnItemMove(guild, player, pItem, isSrcBank, srcContainer, srcSlotId, isDestBank, destContainer, destSlotId);
+    FOREACH_SCRIPT_HOOK(GuildScript, OnGuildItemMove, OnItemMove(guild, player, pItem, isSrcBank, srcContainer, srcSlotId, isDestBank, destContainer, destSlotId));
 }
 
 void ScriptMgr::OnGuildEvent(Guild* guild, uint8 eventType, ObjectGuid::LowType playerGuid1, ObjectGuid::LowType playerGuid2, uint8 newRank)
 {
-    FOREACH_SCRIPT(GuildScript)->OnEvent(guild, eventType, playerGuid1, playerGuid2, newRank);
+    FOREACH_SCRIPT_HOOK(GuildScript, OnGuildEvent, OnEvent(guild, eventType, playerGuid1, playerGuid2, newRank));
 }
 
 void ScriptMgr::OnGuildBankEvent(Guild* guild, uint8 eventType, uint8 tabId, ObjectGuid::LowType playerGuid, uint32 itemOrMoney, uint16 itemStackCount, uint8 destTabId)
 {
-    FOREACH_SCRIPT(GuildScript)->OnBankEvent(guild, eventType, tabId, playerGuid, itemOrMoney, itemStackCount, destTabId);
+    FOREACH_SCRIPT_HOOK(GuildScript, OnGuildBankEvent, OnBankEvent(guild, eventType, tabId, playerGuid, itemOrMoney, itemStackCount, destTabId));
 }
 
 // Group
 void ScriptMgr::OnGroupAddMember(Group* group, ObjectGuid guid)
 {
     ASSERT(group);
-    FOREACH_SCRIPT(GroupScript)->OnAddMember(group, guid);
+    FOREACH_SCRIPT_HOOK(GroupScript, OnGroupAddMember, OnAddMember(group, guid));
 }
 
 void ScriptMgr::OnGroupInviteMember(Group* group, ObjectGuid guid)
 {
     ASSERT(group);
-    FOREACH_SCRIPT(GroupScript)->OnInviteMember(group, guid);
+    FOREACH_SCRIPT_HOOK(GroupScript, OnGroupInviteMember, OnInviteMember(group, guid));
 }
 
 void ScriptMgr::OnGroupRemoveMember(Group* group, ObjectGuid guid, RemoveMethod method, ObjectGuid kicker, const char* reason)
 {
     ASSERT(group);
-    FOREACH_SCRIPT(GroupScript)->OnRemoveMember(group, guid, method, kicker, reason);
+    FOREACH_SCRIPT_HOOK(GroupScript, OnGroupRemoveMember, OnRemoveMember(group, guid, method, kicker, reason));
 }
 
 void ScriptMgr::OnGroupChangeLeader(Group* group, ObjectGuid newLeaderGuid, ObjectGuid oldLeaderGuid)
 {
     ASSERT(group);
-    FOREACH_SCRIPT(GroupScript)->OnChangeLeader(group, newLeaderGuid, oldLeaderGuid);
+    FOREACH_SCRIPT_HOOK(GroupScript, OnGroupChangeLeader, OnChangeLeader(group, newLeaderGuid, oldLeaderGuid));
 }
 
 void ScriptMgr::OnGroupDisband(Group* group)
 {
     ASSERT(group);
-    FOREACH_SCRIPT(GroupScript)->OnDisband(group);
+    FOREACH_SCRIPT_HOOK(GroupScript, OnGroupDisband, OnDisband(group));
 }
 
 // Unit
 void ScriptMgr::OnHeal(Unit* healer, Unit* reciever, uint32& gain)
 {
-    FOREACH_SCRIPT(UnitScript)->OnHeal(healer, reciever, gain);
+    FOREACH_SCRIPT_HOOK(UnitScript, OnHeal, OnHeal(healer, reciever, gain));
 }
 
 void ScriptMgr::OnDamage(Unit* attacker, Unit* victim, uint32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->OnDamage(attacker, victim, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, OnDamage, OnDamage(attacker, victim, damage));
 }
 
 void ScriptMgr::ModifyPeriodicDamageAurasTick(Unit* target, Unit* attacker, uint32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->ModifyPeriodicDamageAurasTick(target, attacker, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, ModifyPeriodicDamageAurasTick, ModifyPeriodicDamageAurasTick(target, attacker, damage));
 }
 
 void ScriptMgr::ModifyMeleeDamage(Unit* target, Unit* attacker, uint32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->ModifyMeleeDamage(target, attacker, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, ModifyMeleeDamage, ModifyMeleeDamage(target, attacker, damage));
 }
 
 void ScriptMgr::ModifySpellDamageTaken(Unit* target, Unit* attacker, int32& damage)
 {
-    FOREACH_SCRIPT(UnitScript)->ModifySpellDamageTaken(target, attacker, damage);
+    FOREACH_SCRIPT_HOOK(UnitScript, ModifySpellDamageTaken, ModifySpellDamageTaken(target, attacker, damage));
 }
 
 SpellScriptLoader::SpellScriptLoader(const char* name)
@@ -1718,7 +1925,7 @@ template class TC_GAME_API ScriptRegistry<AccountScript>;
 // Undefine utility macros.
 #undef GET_SCRIPT_RET
 #undef GET_SCRIPT
-#undef FOREACH_SCRIPT
+#undef FOREACH_SCRIPT_HOOK
 #undef FOR_SCRIPTS_RET
 #undef FOR_SCRIPTS
 #undef SCR_REG_LST
@@ -21,6 +21,7 @@
 
 #include "Common.h"
 #include <atomic>
+#include <initializer_list>
 #include "DBCStores.h"
 #include "QuestDef.h"
 #include "SharedDefines.h"
@@ -155,6 +156,9 @@ class TC_GAME_API ScriptObject
 
         const std::string& GetName() const { return _name; }
 
+        // True if the script registered the hook, or registered no hooks at all
+        bool ImplementsHook(char const* hook) const;
+
     protected:
 
         ScriptObject(const char* name)
@@ -166,9 +170,15 @@ class TC_GAME_API ScriptObject
         {
         }
 
+        // Hooks called for every script of a type (ServerScript, PlayerScript, ...) are only dispatched to the
+        // scripts implementing them. Scripts list their hooks here by the names shown by .server scripthooks,
+        // scripts which register none are called for every hook of their type.
+        void RegisterHooks(std::initializer_list<char const*> hooks);
+
     private:
 
         const std::string _name;
+        std::vector<std::string> _hooks;
 };
 
 template<class TObject> class UpdatableScript
@@ -751,22 +761,22 @@ class TC_GAME_API AccountScript : public ScriptObject
     public:
 
         // Called when an account logged in succesfully
-        virtual void OnAccountLogin(uint32 /*accountId*/) {}
+        virtual void OnAccountLogin(uint32 /*accountId*/) { }
 
         // Called when an account login failed
-        virtual void OnFailedAccountLogin(uint32 /*accountId*/) {}
+        virtual void OnFailedAccountLogin(uint32 /*accountId*/) { }
 
         // Called when Email is successfully changed for Account
-        virtual void OnEmailChange(uint32 /*accountId*/) {}
+        virtual void OnEmailChange(uint32 /*accountId*/) { }
 
         // Called when Email failed to change for Account
-        virtual void OnFailedEmailChange(uint32 /*accountId*/) {}
+        virtual void OnFailedEmailChange(uint32 /*accountId*/) { }
 
         // Called when Password is successfully changed for Account
-        virtual void OnPasswordChange(uint32 /*accountId*/) {}
+        virtual void OnPasswordChange(uint32 /*accountId*/) { }
 
         // Called when Password failed to change for Account
-        virtual void OnFailedPasswordChange(uint32 /*accountId*/) {}
+        virtual void OnFailedPasswordChange(uint32 /*accountId*/) { }
 };
 
 class TC_GAME_API GuildScript : public ScriptObject
@@ -834,6 +844,14 @@ class TC_GAME_API GroupScript : public ScriptObject
         virtual void OnDisband(Group* /*group*/) { }
 };
 
+struct ScriptHookProfile
+{
+    std::string Name;
+    uint64 Calls;
+    uint32 Subscribers;
+    uint32 Scripts;
+};
+
 // Placed here due to ScriptRegistry::AddScript dependency.
 #define sScriptMgr ScriptMgr::instance()
 
@@ -1094,6 +1112,14 @@ class TC_GAME_API ScriptMgr
         void ModifyMeleeDamage(Unit* target, Unit* attacker, uint32& damage);
         void ModifySpellDamageTaken(Unit* target, Unit* attacker, int32& damage);
 
+    public: /* Hook profiling */
+
+        std::vector<ScriptHookProfile> GetHookProfile() const;
+        void ResetHookProfile();
+        /// Hook calls are only counted with Debug.ScriptHookStats
+        void SetHookCallCounting(bool enable);
+        bool IsHookCallCounting() const;
+
     public: /* Scheduled scripts */
 
         uint32 IncreaseScheduledScriptsCount() { return ++_scheduledScripts; }
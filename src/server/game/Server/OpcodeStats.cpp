@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2008-2016 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "OpcodeStats.h"
+#include "Opcodes.h"
+#include <algorithm>
+
+OpcodeStats::Counter OpcodeStats::_counters[NUM_MSG_TYPES];
+
+void OpcodeStats::Record(uint16 opcode, uint32 time)
+{
+    if (opcode >= NUM_MSG_TYPES)
+        return;
+
+    Counter& counter = _counters[opcode];
+    ++counter.Count;
+    counter.TotalTime += time;
+
+    uint32 maxTime = counter.MaxTime;
+    while (time > maxTime && !counter.MaxTime.compare_exchange_weak(maxTime, time))
+        ;
+}
+
+std::vector<OpcodeStats::Entry> OpcodeStats::GetTop(uint32 count)
+{
+    std::vector<Entry> entries;
+    for (uint32 i = 0; i < NUM_MSG_TYPES; ++i)
+    {
+        Counter const& counter = _counters[i];
+        if (!counter.Count)
+            continue;
+
+        Entry entry;
+        entry.Opcode = uint16(i);
+        entry.Count = counter.Count;
+        entry.TotalTime = counter.TotalTime;
+        entry.MaxTime = counter.MaxTime;
+        entries.push_back(entry);
+    }
+
+    std::sort(entries.begin(), entries.end(), [](Entry const& left, Entry const& right)
+    {
+        return left.TotalTime > right.TotalTime;
+    });
+
+    if (entries.size() > count)
+        entries.resize(count);
+
+    return entries;
+}
+
+void OpcodeStats::Reset()
+{
+    for (uint32 i = 0; i < NUM_MSG_TYPES; ++i)
+    {
+        _counters[i].Count = 0;
+        _counters[i].TotalTime = 0;
+        _counters[i].MaxTime = 0;
+    }
+}
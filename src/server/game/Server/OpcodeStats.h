@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2008-2016 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_OPCODESTATS_H
+#define TRINITY_OPCODESTATS_H
+
+#include "Define.h"
+#include <atomic>
+#include <vector>
+
+/// Time spent in each client opcode handler, recorded from map, world and session updater threads alike
+class TC_GAME_API OpcodeStats
+{
+    public:
+        struct Entry
+        {
+            uint16 Opcode;
+            uint64 Count;
+            uint64 TotalTime;
+            uint32 MaxTime;
+        };
+
+        /// time is in microseconds
+        static void Record(uint16 opcode, uint32 time);
+
+        /// Returns the opcodes handled at least once, most expensive in total first
+        static std::vector<Entry> GetTop(uint32 count);
+        static void Reset();
+
+    private:
+        struct Counter
+        {
+            Counter() : Count(0), TotalTime(0), MaxTime(0) { }
+
+            std::atomic<uint64> Count;
+            std::atomic<uint64> TotalTime;
+            std::atomic<uint32> MaxTime;
+        };
+
+        static Counter _counters[];
+};
+
+#endif
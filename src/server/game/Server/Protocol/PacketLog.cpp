@@ -17,8 +17,15 @@
 
 #include "PacketLog.h"
 #include "Config.h"
+#include "Log.h"
 #include "WorldPacket.h"
 #include "Timer.h"
+#include "Util.h"
+
+#include <boost/filesystem/operations.hpp>
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <chrono>
+#include <limits>
 
 #pragma pack(push, 1)
 
@@ -56,17 +63,168 @@ struct PacketHeader
 
 #pragma pack(pop)
 
-PacketLog::PacketLog() : _file(NULL)
+namespace
+{
+    uint32 const RingWrapMarker = 0xFFFFFFFF;
+
+    inline std::size_t AlignRecord(std::size_t size)
+    {
+        return (size + 3) & ~std::size_t(3);
+    }
+}
+
+/// Single producer, single consumer byte ring. The producer is the thread owning it, the consumer is the writer thread.
+/// Each record is prefixed by its unaligned length, records that would not fit before the end of the buffer
+/// are preceded by a wrap marker and stored at its beginning instead.
+class PacketLogRing
+{
+public:
+    explicit PacketLogRing(std::size_t capacity) : _buffer(new uint8[capacity]), _capacity(capacity), _head(0), _tail(0),
+        Packets(0), Bytes(0), Dropped(0), Filtered(0), ProducerNanoseconds(0) { }
+
+    bool Write(PacketHeader const& header, uint8 const* data, std::size_t dataSize)
+    {
+        uint32 length = uint32(sizeof(header) + dataSize);
+        std::size_t recordSize = AlignRecord(sizeof(uint32) + length);
+        uint64 head = _head.load(std::memory_order_relaxed);
+        uint64 tail = _tail.load(std::memory_order_acquire);
+
+        std::size_t offset = std::size_t(head % _capacity);
+        std::size_t contiguous = _capacity - offset;
+        std::size_t needed = contiguous < recordSize ? recordSize + contiguous : recordSize;
+        if (needed > _capacity - std::size_t(head - tail))
+            return false;
+
+        if (contiguous < recordSize)
+        {
+            memcpy(&_buffer[offset], &RingWrapMarker, sizeof(uint32));
+            head += contiguous;
+            offset = 0;
+        }
+
+        memcpy(&_buffer[offset], &length, sizeof(uint32));
+        memcpy(&_buffer[offset + sizeof(uint32)], &header, sizeof(header));
+        if (dataSize)
+            memcpy(&_buffer[offset + sizeof(uint32) + sizeof(header)], data, dataSize);
+
+        _head.store(head + recordSize, std::memory_order_release);
+        return true;
+    }
+
+    template<class Consumer>
+    void Drain(Consumer&& consumer)
+    {
+        uint64 tail = _tail.load(std::memory_order_relaxed);
+        uint64 head = _head.load(std::memory_order_acquire);
+        if (tail == head)
+            return;
+
+        while (tail != head)
+        {
+            std::size_t offset = std::size_t(tail % _capacity);
+            uint32 length;
+            memcpy(&length, &_buffer[offset], sizeof(uint32));
+            if (length == RingWrapMarker)
+            {
+                tail += _capacity - offset;
+                continue;
+            }
+
+            consumer(&_buffer[offset + sizeof(uint32)], length);
+            tail += AlignRecord(sizeof(uint32) + length);
+        }
+
+        _tail.store(tail, std::memory_order_release);
+    }
+
+    // counters are only written by the producing thread
+    static void Increment(std::atomic<uint64>& counter, uint64 value)
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+
+private:
+    std::unique_ptr<uint8[]> _buffer;
+    std::size_t _capacity;
+    std::atomic<uint64> _head;
+    std::atomic<uint64> _tail;
+
+public:
+    std::atomic<uint64> Packets;
+    std::atomic<uint64> Bytes;
+    std::atomic<uint64> Dropped;
+    std::atomic<uint64> Filtered;
+    std::atomic<uint64> ProducerNanoseconds;
+};
+
+/// One memory-mapped capture file, truncated to its used size when closed
+class PacketLogSegment
+{
+public:
+    PacketLogSegment(std::string const& path, std::size_t size) : _path(path), _offset(0)
+    {
+        boost::iostreams::mapped_file_params params(path);
+        params.new_file_size = size;
+        params.flags = boost::iostreams::mapped_file::readwrite;
+        _file.open(params);
+    }
+
+    ~PacketLogSegment()
+    {
+        if (!_file.is_open())
+            return;
+
+        _file.close();
+        boost::system::error_code error;
+        boost::filesystem::resize_file(_path, _offset, error);
+    }
+
+    bool IsOpen() const { return _file.is_open(); }
+    std::size_t GetFreeSpace() const { return _file.size() - _offset; }
+
+    void Append(void const* data, std::size_t size)
+    {
+        memcpy(_file.data() + _offset, data, size);
+        _offset += size;
+    }
+
+private:
+    std::string _path;
+    boost::iostreams::mapped_file_sink _file;
+    std::size_t _offset;
+};
+
+bool PacketLogFilter::Matches(boost::asio::ip::address const& addr, uint32 accountId) const
+{
+    if (accountId && Accounts.count(accountId))
+        return true;
+
+    return !Addresses.empty() && Addresses.count(addr.to_string());
+}
+
+PacketLog::PacketLog() : _active(false), _filter(nullptr), _stopWriter(false), _threadBufferSize(0), _segmentSize(0), _flushInterval(0),
+    _segmentCount(0), _writtenBytes(0), _writerDropped(0)
 {
     std::call_once(_initializeFlag, &PacketLog::Initialize, this);
 }
 
 PacketLog::~PacketLog()
 {
-    if (_file)
-        fclose(_file);
+    _active = false;
+
+    if (_writerThread.joinable())
+    {
+        {
+            std::lock_guard<std::mutex> lock(_writerLock);
+            _stopWriter = true;
+        }
 
-    _file = NULL;
+        _writerCondition.notify_one();
+        _writerThread.join();
+    }
+
+    _segment.reset();
+    delete _filter.load();
 }
 
 PacketLog* PacketLog::instance()
@@ -84,29 +242,82 @@ void PacketLog::Initialize()
             logsDir.push_back('/');
 
     std::string logname = sConfigMgr->GetStringDefault("PacketLogFile", "");
-    if (!logname.empty())
+    if (logname.empty())
+        return;
+
+    _fileName = logsDir + logname;
+    // sizes are computed in 64 bits, the configured kilobytes and megabytes overflow 32 bit byte counts
+    uint64 threadBufferSize = uint64(std::max(sConfigMgr->GetIntDefault("PacketLog.ThreadBufferSize", 1024), 64)) * 1024;
+    uint64 segmentSize = uint64(std::max(sConfigMgr->GetIntDefault("PacketLog.SegmentSize", 256), 1)) * 1024 * 1024;
+    if (threadBufferSize > std::numeric_limits<std::size_t>::max())
+    {
+        TC_LOG_ERROR("server.loading", "PacketLog.ThreadBufferSize (" UI64FMTD " KB) is too large for this platform, set to 1024 KB.", threadBufferSize / 1024);
+        threadBufferSize = 1024 * 1024;
+    }
+
+    if (segmentSize > std::numeric_limits<std::size_t>::max())
     {
-        _file = fopen((logsDir + logname).c_str(), "wb");
+        TC_LOG_ERROR("server.loading", "PacketLog.SegmentSize (" UI64FMTD " MB) is too large for this platform, set to 256 MB.", segmentSize / (1024 * 1024));
+        segmentSize = 256 * 1024 * 1024;
+    }
+
+    _threadBufferSize = std::size_t(threadBufferSize);
+    _segmentSize = std::size_t(segmentSize);
+    _flushInterval = std::max(sConfigMgr->GetIntDefault("PacketLog.FlushInterval", 100), 1);
+
+    PacketLogFilter* filter = new PacketLogFilter();
+    for (char const* account : Tokenizer(sConfigMgr->GetStringDefault("PacketLog.Filter.Accounts", ""), ' '))
+        if (uint32 accountId = atoul(account))
+            filter->Accounts.insert(accountId);
 
-        LogHeader header;
-        header.Signature[0] = 'P'; header.Signature[1] = 'K'; header.Signature[2] = 'T';
-        header.FormatVersion = 0x0301;
-        header.SnifferId = 'T';
-        header.Build = 12340;
-        header.Locale[0] = 'e'; header.Locale[1] = 'n'; header.Locale[2] = 'U'; header.Locale[3] = 'S';
-        std::memset(header.SessionKey, 0, sizeof(header.SessionKey));
-        header.SniffStartUnixtime = time(NULL);
-        header.SniffStartTicks = getMSTime();
-        header.OptionalDataSize = 0;
+    for (char const* address : Tokenizer(sConfigMgr->GetStringDefault("PacketLog.Filter.Addresses", ""), ' '))
+        filter->Addresses.insert(address);
+
+    if (!filter->IsEmpty())
+        _filter = filter;
+    else
+        delete filter;
+
+    if (!OpenSegment())
+        return;
+
+    _writerThread = std::thread(&PacketLog::WriterThread, this);
+    _active = sConfigMgr->GetBoolDefault("PacketLog.Enabled", true);
+}
 
-        if (CanLogPacket())
-            fwrite(&header, sizeof(header), 1, _file);
+bool PacketLog::SetActive(bool active)
+{
+    if (!IsAvailable())
+        return false;
+
+    _active = active;
+    return true;
+}
+
+PacketLogRing* PacketLog::GetThreadRing()
+{
+    static thread_local PacketLogRing* ring = nullptr;
+    if (!ring)
+    {
+        std::lock_guard<std::mutex> lock(_ringsLock);
+        _rings.emplace_back(new PacketLogRing(_threadBufferSize));
+        ring = _rings.back().get();
     }
+
+    return ring;
 }
 
-void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port)
+void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port, uint32 accountId)
 {
-    std::lock_guard<std::mutex> lock(_logPacketLock);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    PacketLogRing* ring = GetThreadRing();
+
+    PacketLogFilter const* filter = _filter.load(std::memory_order_acquire);
+    if (filter && !filter->Matches(addr, accountId))
+    {
+        PacketLogRing::Increment(ring->Filtered, 1);
+        return;
+    }
 
     PacketHeader header;
     *reinterpret_cast<uint32*>(header.Direction) = direction == CLIENT_TO_SERVER ? 0x47534d43 : 0x47534d53;
@@ -130,9 +341,200 @@ void PacketLog::LogPacket(WorldPacket const& packet, Direction direction, boost:
     header.Length = packet.size() + sizeof(header.Opcode);
     header.Opcode = packet.GetOpcode();
 
-    fwrite(&header, sizeof(header), 1, _file);
-    if (!packet.empty())
-        fwrite(packet.contents(), 1, packet.size(), _file);
+    if (ring->Write(header, packet.empty() ? nullptr : packet.contents(), packet.size()))
+    {
+        PacketLogRing::Increment(ring->Packets, 1);
+        PacketLogRing::Increment(ring->Bytes, sizeof(header) + packet.size());
+    }
+    else
+        PacketLogRing::Increment(ring->Dropped, 1);
+
+    PacketLogRing::Increment(ring->ProducerNanoseconds,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+void PacketLog::PublishFilter(PacketLogFilter* filter)
+{
+    // caller holds _filterLock
+    if (filter->IsEmpty())
+    {
+        delete filter;
+        filter = nullptr;
+    }
+
+    PacketLogFilter const* old = _filter.exchange(filter, std::memory_order_acq_rel);
+    if (old)
+        _retiredFilters.emplace_back(const_cast<PacketLogFilter*>(old));
+}
+
+void PacketLog::AddAccountFilter(uint32 accountId)
+{
+    std::lock_guard<std::mutex> lock(_filterLock);
+    PacketLogFilter const* current = _filter.load(std::memory_order_relaxed);
+    PacketLogFilter* filter = current ? new PacketLogFilter(*current) : new PacketLogFilter();
+    filter->Accounts.insert(accountId);
+    PublishFilter(filter);
+}
+
+void PacketLog::AddAddressFilter(std::string const& address)
+{
+    std::lock_guard<std::mutex> lock(_filterLock);
+    PacketLogFilter const* current = _filter.load(std::memory_order_relaxed);
+    PacketLogFilter* filter = current ? new PacketLogFilter(*current) : new PacketLogFilter();
+    filter->Addresses.insert(address);
+    PublishFilter(filter);
+}
+
+void PacketLog::ClearFilters()
+{
+    std::lock_guard<std::mutex> lock(_filterLock);
+    PublishFilter(new PacketLogFilter());
+}
+
+PacketLogFilter PacketLog::GetFilter() const
+{
+    std::lock_guard<std::mutex> lock(_filterLock);
+    if (PacketLogFilter const* filter = _filter.load(std::memory_order_relaxed))
+        return *filter;
+
+    return PacketLogFilter();
+}
+
+PacketLogStatistics PacketLog::GetStatistics() const
+{
+    PacketLogStatistics stats;
+
+    {
+        std::lock_guard<std::mutex> lock(_ringsLock);
+        for (std::unique_ptr<PacketLogRing> const& ring : _rings)
+        {
+            stats.Packets += ring->Packets.load(std::memory_order_relaxed);
+            stats.Bytes += ring->Bytes.load(std::memory_order_relaxed);
+            stats.Dropped += ring->Dropped.load(std::memory_order_relaxed);
+            stats.Filtered += ring->Filtered.load(std::memory_order_relaxed);
+            stats.ProducerNanoseconds += ring->ProducerNanoseconds.load(std::memory_order_relaxed);
+        }
+
+        stats.ProducerThreads = uint32(_rings.size());
+    }
+
+    stats.Dropped += _writerDropped.load(std::memory_order_relaxed);
+    stats.WrittenBytes = _writtenBytes.load(std::memory_order_relaxed);
+    stats.Segments = _segmentCount.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void PacketLog::WriterThread()
+{
+    std::unique_lock<std::mutex> lock(_writerLock);
+    while (!_stopWriter)
+    {
+        _writerCondition.wait_for(lock, std::chrono::milliseconds(_flushInterval));
+
+        lock.unlock();
+        DrainRings();
+        lock.lock();
+    }
+
+    lock.unlock();
+    DrainRings();
+}
+
+void PacketLog::DrainRings()
+{
+    // rings are only ever added, work on a snapshot so threads creating their ring never wait for the writer
+    std::vector<PacketLogRing*> rings;
+    {
+        std::lock_guard<std::mutex> lock(_ringsLock);
+        rings.reserve(_rings.size());
+        for (std::unique_ptr<PacketLogRing> const& ring : _rings)
+            rings.push_back(ring.get());
+    }
+
+    // copy the records out first, this frees the rings before the slower writes into the mapped file
+    _drainBuffer.clear();
+    for (PacketLogRing* ring : rings)
+    {
+        ring->Drain([this](uint8 const* record, uint32 length)
+        {
+            uint8 const* prefix = reinterpret_cast<uint8 const*>(&length);
+            _drainBuffer.insert(_drainBuffer.end(), prefix, prefix + sizeof(uint32));
+            _drainBuffer.insert(_drainBuffer.end(), record, record + length);
+        });
+    }
+
+    std::size_t const maxRecordSize = _segmentSize - sizeof(LogHeader);
+    std::size_t offset = 0;
+    while (offset < _drainBuffer.size())
+    {
+        uint32 length;
+        memcpy(&length, &_drainBuffer[offset], sizeof(uint32));
+        uint8 const* record = &_drainBuffer[offset + sizeof(uint32)];
+        offset += sizeof(uint32) + length;
+
+        // would not even fit an empty segment, rotating would only leave empty files behind
+        if (length > maxRecordSize)
+        {
+            _writerDropped.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (!_segment || _segment->GetFreeSpace() < length)
+        {
+            CloseSegment();
+            if (!OpenSegment())
+            {
+                _writerDropped.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+        }
 
-    fflush(_file);
+        _segment->Append(record, length);
+        _writtenBytes.fetch_add(length, std::memory_order_relaxed);
+    }
+}
+
+bool PacketLog::OpenSegment()
+{
+    std::string path = _fileName;
+    if (uint32 segment = _segmentCount.load(std::memory_order_relaxed))
+    {
+        std::size_t extension = path.find_last_of('.');
+        std::size_t separator = path.find_last_of("/\\");
+        if (extension == std::string::npos || (separator != std::string::npos && extension < separator))
+            extension = path.length();
+
+        path.insert(extension, Trinity::StringFormat("_%04u", segment));
+    }
+
+    try
+    {
+        _segment.reset(new PacketLogSegment(path, _segmentSize));
+    }
+    catch (std::exception const& e)
+    {
+        TC_LOG_ERROR("network", "PacketLog: Could not map capture file %s: %s", path.c_str(), e.what());
+        _segment.reset();
+        return false;
+    }
+
+    LogHeader header;
+    header.Signature[0] = 'P'; header.Signature[1] = 'K'; header.Signature[2] = 'T';
+    header.FormatVersion = 0x0301;
+    header.SnifferId = 'T';
+    header.Build = 12340;
+    header.Locale[0] = 'e'; header.Locale[1] = 'n'; header.Locale[2] = 'U'; header.Locale[3] = 'S';
+    std::memset(header.SessionKey, 0, sizeof(header.SessionKey));
+    header.SniffStartUnixtime = time(NULL);
+    header.SniffStartTicks = getMSTime();
+    header.OptionalDataSize = 0;
+
+    _segment->Append(&header, sizeof(header));
+    _segmentCount.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+void PacketLog::CloseSegment()
+{
+    _segment.reset();
 }
@@ -21,7 +21,13 @@
 #include "Common.h"
 
 #include <boost/asio/ip/address.hpp>
+#include <atomic>
+#include <condition_variable>
+#include <memory>
 #include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
 
 enum Direction
 {
@@ -30,24 +36,92 @@ enum Direction
 };
 
 class WorldPacket;
+class PacketLogRing;
+class PacketLogSegment;
 
+struct PacketLogFilter
+{
+    std::set<uint32> Accounts;
+    std::set<std::string> Addresses;
+
+    bool IsEmpty() const { return Accounts.empty() && Addresses.empty(); }
+    bool Matches(boost::asio::ip::address const& addr, uint32 accountId) const;
+};
+
+struct PacketLogStatistics
+{
+    uint64 Packets = 0;
+    uint64 Bytes = 0;
+    uint64 Dropped = 0;
+    uint64 Filtered = 0;
+    uint64 ProducerNanoseconds = 0;
+    uint64 WrittenBytes = 0;
+    uint32 Segments = 0;
+    uint32 ProducerThreads = 0;
+};
+
+/// Captures world packets in PKT 3.1 format.
+/// Every producing thread appends to its own lock-free ring buffer, a background writer drains
+/// the rings into a memory-mapped capture file which is rotated once it reaches PacketLog.SegmentSize.
+/// Packets that do not fit into a full ring are dropped (and counted) instead of stalling the caller.
 class TC_GAME_API PacketLog
 {
     private:
         PacketLog();
         ~PacketLog();
-        std::mutex _logPacketLock;
         std::once_flag _initializeFlag;
 
     public:
         static PacketLog* instance();
 
         void Initialize();
-        bool CanLogPacket() const { return (_file != NULL); }
-        void LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port);
+        bool CanLogPacket() const { return _active.load(std::memory_order_relaxed); }
+        void LogPacket(WorldPacket const& packet, Direction direction, boost::asio::ip::address const& addr, uint16 port, uint32 accountId);
+
+        /// Writer is only available when PacketLogFile is configured
+        bool IsAvailable() const { return _writerThread.joinable(); }
+        bool SetActive(bool active);
+
+        void AddAccountFilter(uint32 accountId);
+        void AddAddressFilter(std::string const& address);
+        void ClearFilters();
+        PacketLogFilter GetFilter() const;
+
+        PacketLogStatistics GetStatistics() const;
 
     private:
-        FILE* _file;
+        PacketLogRing* GetThreadRing();
+        void PublishFilter(PacketLogFilter* filter);
+
+        void WriterThread();
+        void DrainRings();
+        bool OpenSegment();
+        void CloseSegment();
+
+        std::atomic<bool> _active;
+
+        // filters are immutable once published, old ones are retired and released on shutdown
+        std::atomic<PacketLogFilter const*> _filter;
+        std::vector<std::unique_ptr<PacketLogFilter>> _retiredFilters;
+        mutable std::mutex _filterLock;
+
+        std::vector<std::unique_ptr<PacketLogRing>> _rings;
+        mutable std::mutex _ringsLock;
+
+        std::thread _writerThread;
+        std::mutex _writerLock;
+        std::condition_variable _writerCondition;
+        bool _stopWriter;
+
+        std::unique_ptr<PacketLogSegment> _segment;
+        std::vector<uint8> _drainBuffer;                    // records copied out of the rings, only used by the writer
+        std::string _fileName;
+        std::size_t _threadBufferSize;
+        std::size_t _segmentSize;
+        uint32 _flushInterval;
+        std::atomic<uint32> _segmentCount;
+        std::atomic<uint64> _writtenBytes;
+        std::atomic<uint64> _writerDropped;                 // records the writer could not store in a segment
 };
 
 #define sPacketLog PacketLog::instance()
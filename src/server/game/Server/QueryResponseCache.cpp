@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2008-2016 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "QueryResponseCache.h"
+#include "Opcodes.h"
+#include "World.h"
+
+QueryResponseCache* QueryResponseCache::instance()
+{
+    static QueryResponseCache instance;
+    return &instance;
+}
+
+QueryResponseCache::ResponsePtr QueryResponseCache::Find(QueryResponseType type, uint32 entry, LocaleConstant locale)
+{
+    if (!sWorld->getBoolConfig(CONFIG_QUERY_RESPONSE_CACHE))
+        return nullptr;
+
+    ResponseStore& store = _stores[type];
+    boost::shared_lock<boost::shared_mutex> lock(store.Lock);
+
+    auto itr = store.Responses.find(MakeKey(entry, locale));
+    if (itr == store.Responses.end())
+        return nullptr;
+
+    return itr->second;
+}
+
+void QueryResponseCache::Store(QueryResponseType type, uint32 entry, LocaleConstant locale, Response&& response)
+{
+    if (!sWorld->getBoolConfig(CONFIG_QUERY_RESPONSE_CACHE))
+        return;
+
+    ResponsePtr ptr = std::make_shared<Response const>(std::move(response));
+
+    ResponseStore& store = _stores[type];
+    boost::unique_lock<boost::shared_mutex> lock(store.Lock);
+    store.Responses[MakeKey(entry, locale)] = ptr;
+    ++store.Misses;
+}
+
+void QueryResponseCache::Store(QueryResponseType type, uint32 entry, LocaleConstant locale, WorldPacket const& packet)
+{
+    Store(type, entry, locale, Response(1, packet));
+}
+
+void QueryResponseCache::Invalidate(QueryResponseType type)
+{
+    ResponseStore& store = _stores[type];
+    boost::unique_lock<boost::shared_mutex> lock(store.Lock);
+    store.Responses.clear();
+}
+
+void QueryResponseCache::InvalidateAll()
+{
+    for (uint8 i = 0; i < MAX_QUERY_RESPONSE_TYPES; ++i)
+        Invalidate(QueryResponseType(i));
+}
+
+bool QueryResponseCache::GetResponseTypeForOpcode(uint16 opcode, QueryResponseType& type)
+{
+    switch (opcode)
+    {
+        case CMSG_CREATURE_QUERY:
+            type = QUERY_RESPONSE_CREATURE;
+            return true;
+        case CMSG_GAMEOBJECT_QUERY:
+            type = QUERY_RESPONSE_GAMEOBJECT;
+            return true;
+        case CMSG_ITEM_QUERY_SINGLE:
+            type = QUERY_RESPONSE_ITEM;
+            return true;
+        case CMSG_QUEST_QUERY:
+            type = QUERY_RESPONSE_QUEST;
+            return true;
+        case CMSG_PAGE_TEXT_QUERY:
+            type = QUERY_RESPONSE_PAGE_TEXT;
+            return true;
+        default:
+            return false;
+    }
+}
+
+char const* QueryResponseCache::GetResponseTypeName(QueryResponseType type)
+{
+    switch (type)
+    {
+        case QUERY_RESPONSE_CREATURE:   return "creature";
+        case QUERY_RESPONSE_GAMEOBJECT: return "gameobject";
+        case QUERY_RESPONSE_ITEM:       return "item";
+        case QUERY_RESPONSE_QUEST:      return "quest";
+        case QUERY_RESPONSE_PAGE_TEXT:  return "page text";
+        default:                        return "unknown";
+    }
+}
+
+uint32 QueryResponseCache::GetSize(QueryResponseType type) const
+{
+    ResponseStore const& store = _stores[type];
+    boost::shared_lock<boost::shared_mutex> lock(store.Lock);
+    return uint32(store.Responses.size());
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2008-2016 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRINITY_QUERYRESPONSECACHE_H
+#define TRINITY_QUERYRESPONSECACHE_H
+
+#include "Define.h"
+#include "Common.h"
+#include "WorldPacket.h"
+#include <boost/thread/shared_mutex.hpp>
+#include <atomic>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+enum QueryResponseType : uint8
+{
+    QUERY_RESPONSE_CREATURE     = 0,
+    QUERY_RESPONSE_GAMEOBJECT   = 1,
+    QUERY_RESPONSE_ITEM         = 2,
+    QUERY_RESPONSE_QUEST        = 3,
+    QUERY_RESPONSE_PAGE_TEXT    = 4,
+    MAX_QUERY_RESPONSE_TYPES
+};
+
+/// Holds the SMSG_*_QUERY_RESPONSE packets built from static templates, once per (entry, locale).
+/// Entries are immutable after being stored, so they can be sent from any thread, including the network threads.
+class TC_GAME_API QueryResponseCache
+{
+    public:
+        typedef std::vector<WorldPacket> Response;
+        typedef std::shared_ptr<Response const> ResponsePtr;
+
+        static QueryResponseCache* instance();
+
+        /// Returns the cached response for the given entry or null
+        ResponsePtr Find(QueryResponseType type, uint32 entry, LocaleConstant locale);
+        /// Counts a hit once a found response was actually sent
+        void CountHit(QueryResponseType type) { ++_stores[type].Hits; }
+        /// Stores a freshly built response, counts a miss
+        void Store(QueryResponseType type, uint32 entry, LocaleConstant locale, Response&& response);
+        void Store(QueryResponseType type, uint32 entry, LocaleConstant locale, WorldPacket const& packet);
+
+        /// Drops all responses of one type, called when the templates or locales behind them are reloaded
+        void Invalidate(QueryResponseType type);
+        void InvalidateAll();
+
+        /// Maps a client query opcode to the cache it is answered from
+        static bool GetResponseTypeForOpcode(uint16 opcode, QueryResponseType& type);
+        static char const* GetResponseTypeName(QueryResponseType type);
+
+        uint32 GetSize(QueryResponseType type) const;
+        uint64 GetHits(QueryResponseType type) const { return _stores[type].Hits; }
+        uint64 GetMisses(QueryResponseType type) const { return _stores[type].Misses; }
+
+    private:
+        QueryResponseCache() { }
+        ~QueryResponseCache() { }
+
+        static uint64 MakeKey(uint32 entry, LocaleConstant locale) { return uint64(entry) | (uint64(locale) << 32); }
+
+        struct ResponseStore
+        {
+            ResponseStore() : Hits(0), Misses(0) { }
+
+            mutable boost::shared_mutex Lock;
+            std::unordered_map<uint64, ResponsePtr> Responses;
+            std::atomic<uint64> Hits;
+            std::atomic<uint64> Misses;
+        };
+
+        ResponseStore _stores[MAX_QUERY_RESPONSE_TYPES];
+};
+
+#define sQueryResponseCache QueryResponseCache::instance()
+
+#endif
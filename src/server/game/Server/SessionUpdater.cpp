@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2008-2016 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "SessionUpdater.h"
+#include "Opcodes.h"
+#include "WorldSession.h"
+
+namespace
+{
+    std::mutex SubsystemLocks[MAX_PACKET_SUBSYSTEMS];
+
+    uint8 const OPCODE_SUBSYSTEM_GLOBAL = 0xFF;
+
+    /// Opcodes not listed here are handled by the ordered World::UpdateSessions() loop as before.
+    /// Listed handlers must not change update fields, items or map state: Map::AddUpdateObject, inventories,
+    /// money and achievement criteria (which visit grid cells) are only safe on the world and map threads.
+    class OpcodeSubsystemTable
+    {
+        public:
+            OpcodeSubsystemTable()
+            {
+                for (uint32 i = 0; i < NUM_MSG_TYPES; ++i)
+                    _masks[i] = OPCODE_SUBSYSTEM_GLOBAL;
+
+                // only touch the session and its own player
+                uint8 const session = 0;
+                Set(CMSG_NAME_QUERY, session);
+                Set(CMSG_PAGE_TEXT_QUERY, session);
+                Set(CMSG_QUEST_QUERY, session);
+                Set(CMSG_NPC_TEXT_QUERY, session);
+                Set(CMSG_ITEM_NAME_QUERY, session);
+                Set(CMSG_QUERY_QUESTS_COMPLETED, session);
+                Set(CMSG_QUERY_TIME, session);
+                Set(CMSG_PLAYED_TIME, session);
+                Set(CMSG_TUTORIAL_FLAG, session);
+                Set(CMSG_TUTORIAL_CLEAR, session);
+                Set(CMSG_TUTORIAL_RESET, session);
+                Set(CMSG_REQUEST_ACCOUNT_DATA, session);
+                Set(CMSG_UPDATE_ACCOUNT_DATA, session);
+                Set(CMSG_READY_FOR_ACCOUNT_DATA_TIMES, session);
+                Set(CMSG_SET_ACTION_BUTTON, session);
+
+                // only the mail list of the player, sending, taking and returning mail moves items and money
+                uint8 const mail = PACKET_SUBSYSTEM_MASK(PACKET_SUBSYSTEM_MAIL);
+                Set(CMSG_GET_MAIL_LIST, mail);
+                Set(CMSG_ITEM_TEXT_QUERY, mail);
+                Set(CMSG_MAIL_MARK_AS_READ, mail);
+                Set(CMSG_MAIL_DELETE, mail);
+                Set(MSG_QUERY_NEXT_MAIL_TIME, mail);
+
+                // listing only reads the auction house, apart from the getall throttle which is also auction house state,
+                // feign death removal is left to the ordered loop by ParallelSessionFilter
+                uint8 const auction = PACKET_SUBSYSTEM_MASK(PACKET_SUBSYSTEM_AUCTION);
+                Set(MSG_AUCTION_HELLO, auction);
+                Set(CMSG_AUCTION_LIST_ITEMS, auction);
+                Set(CMSG_AUCTION_LIST_OWNER_ITEMS, auction);
+                Set(CMSG_AUCTION_LIST_BIDDER_ITEMS, auction);
+                Set(CMSG_AUCTION_LIST_PENDING_SALES, auction);
+
+                uint8 const calendar = PACKET_SUBSYSTEM_MASK(PACKET_SUBSYSTEM_CALENDAR);
+                Set(CMSG_CALENDAR_GET_CALENDAR, calendar);
+                Set(CMSG_CALENDAR_GET_EVENT, calendar);
+                Set(CMSG_CALENDAR_GUILD_FILTER, calendar);
+                Set(CMSG_CALENDAR_ARENA_TEAM, calendar);
+                Set(CMSG_CALENDAR_ADD_EVENT, calendar);
+                Set(CMSG_CALENDAR_UPDATE_EVENT, calendar);
+                Set(CMSG_CALENDAR_COPY_EVENT, calendar);
+                Set(CMSG_CALENDAR_EVENT_INVITE, calendar);
+                Set(CMSG_CALENDAR_EVENT_RSVP, calendar);
+                Set(CMSG_CALENDAR_EVENT_REMOVE_INVITE, calendar);
+                Set(CMSG_CALENDAR_EVENT_STATUS, calendar);
+                Set(CMSG_CALENDAR_EVENT_MODERATOR_STATUS, calendar);
+                Set(CMSG_CALENDAR_EVENT_SIGNUP, calendar);
+                Set(CMSG_CALENDAR_COMPLAIN, calendar);
+                Set(CMSG_CALENDAR_GET_NUM_PENDING, calendar);
+                // removing an event mails its invitees
+                Set(CMSG_CALENDAR_REMOVE_EVENT, calendar | mail);
+            }
+
+            uint8 Get(uint16 opcode) const { return opcode < NUM_MSG_TYPES ? _masks[opcode] : OPCODE_SUBSYSTEM_GLOBAL; }
+
+        private:
+            void Set(uint16 opcode, uint8 mask) { _masks[opcode] = mask; }
+
+            uint8 _masks[NUM_MSG_TYPES];
+    };
+
+    OpcodeSubsystemTable const OpcodeSubsystems;
+}
+
+PacketSubsystemGuard::PacketSubsystemGuard(uint8 mask) : _mask(mask == OPCODE_SUBSYSTEM_GLOBAL ? 0 : mask)
+{
+    for (uint8 i = 0; i < MAX_PACKET_SUBSYSTEMS; ++i)
+        if (_mask & PACKET_SUBSYSTEM_MASK(i))
+            SubsystemLocks[i].lock();
+}
+
+PacketSubsystemGuard::~PacketSubsystemGuard()
+{
+    for (uint8 i = MAX_PACKET_SUBSYSTEMS; i > 0; --i)
+        if (_mask & PACKET_SUBSYSTEM_MASK(i - 1))
+            SubsystemLocks[i - 1].unlock();
+}
+
+class SessionUpdateRequest
+{
+    private:
+
+        WorldSession& m_session;
+        SessionUpdater& m_updater;
+
+    public:
+
+        SessionUpdateRequest(WorldSession& s, SessionUpdater& u)
+            : m_session(s), m_updater(u)
+        {
+        }
+
+        void call()
+        {
+            ParallelSessionFilter filter(&m_session);
+            m_session.ProcessParallelPackets(filter);
+            m_updater.update_finished();
+        }
+};
+
+bool SessionUpdater::IsParallelOpcode(uint16 opcode)
+{
+    return OpcodeSubsystems.Get(opcode) != OPCODE_SUBSYSTEM_GLOBAL;
+}
+
+uint8 SessionUpdater::GetOpcodeSubsystemMask(uint16 opcode)
+{
+    return OpcodeSubsystems.Get(opcode);
+}
+
+void SessionUpdater::activate(size_t num_threads)
+{
+    for (size_t i = 0; i < num_threads; ++i)
+    {
+        _workerThreads.push_back(std::thread(&SessionUpdater::WorkerThread, this));
+    }
+}
+
+void SessionUpdater::deactivate()
+{
+    _cancelationToken = true;
+
+    wait();
+
+    _queue.Cancel();
+
+    for (auto& thread : _workerThreads)
+    {
+        thread.join();
+    }
+}
+
+void SessionUpdater::wait()
+{
+    std::unique_lock<std::mutex> lock(_lock);
+
+    while (pending_requests > 0)
+        _condition.wait(lock);
+
+    lock.unlock();
+}
+
+void SessionUpdater::schedule_update(WorldSession& session)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    ++pending_requests;
+
+    _queue.Push(new SessionUpdateRequest(session, *this));
+}
+
+bool SessionUpdater::activated()
+{
+    return _workerThreads.size() > 0;
+}
+
+void SessionUpdater::update_finished()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+
+    --pending_requests;
+
+    _condition.notify_all();
+}
+
+void SessionUpdater::WorkerThread()
+{
+    while (1)
+    {
+        SessionUpdateRequest* request = nullptr;
+
+        _queue.WaitAndPop(request);
+
+        if (_cancelationToken)
+            return;
+
+        request->call();
+
+        delete request;
+    }
+}
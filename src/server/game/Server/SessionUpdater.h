@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2008-2016 TrinityCore <http://www.trinitycore.org/>
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License as published by the
+ * Free Software Foundation; either version 2 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _SESSION_UPDATER_H_INCLUDED
+#define _SESSION_UPDATER_H_INCLUDED
+
+#include "Define.h"
+#include "ProducerConsumerQueue.h"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class WorldSession;
+class SessionUpdateRequest;
+
+/// Global state touched by thread-unsafe opcode handlers, each one guarded by its own lock
+enum PacketSubsystem : uint8
+{
+    PACKET_SUBSYSTEM_MAIL       = 0,    // mail boxes and the mail id generator
+    PACKET_SUBSYSTEM_AUCTION    = 1,    // auction houses and the auction item store
+    PACKET_SUBSYSTEM_CALENDAR   = 2,    // calendar events and invites
+    MAX_PACKET_SUBSYSTEMS
+};
+
+#define PACKET_SUBSYSTEM_MASK(s)    (1 << (s))
+
+/// Locks the subsystems of one opcode for the duration of its handler, always in ascending order
+class PacketSubsystemGuard
+{
+    public:
+        explicit PacketSubsystemGuard(uint8 mask);
+        ~PacketSubsystemGuard();
+
+    private:
+        PacketSubsystemGuard(PacketSubsystemGuard const&) = delete;
+        PacketSubsystemGuard& operator=(PacketSubsystemGuard const&) = delete;
+
+        uint8 _mask;
+};
+
+/// Processes the thread-unsafe packets whose handlers only touch the session itself or the subsystems above
+/// on a pool of worker threads, before World::UpdateSessions() handles everything else in order.
+class TC_GAME_API SessionUpdater
+{
+    public:
+
+        SessionUpdater() : _cancelationToken(false), pending_requests(0) {}
+        ~SessionUpdater() { };
+
+        friend class SessionUpdateRequest;
+
+        void schedule_update(WorldSession& session);
+
+        void wait();
+
+        void activate(size_t num_threads);
+
+        void deactivate();
+
+        bool activated();
+
+        /// Returns true when the opcode may be handled outside of the ordered World::UpdateSessions() loop
+        static bool IsParallelOpcode(uint16 opcode);
+        /// Returns the PACKET_SUBSYSTEM_MASK of the subsystems an opcode handler has to lock
+        static uint8 GetOpcodeSubsystemMask(uint16 opcode);
+
+    private:
+
+        ProducerConsumerQueue<SessionUpdateRequest*> _queue;
+
+        std::vector<std::thread> _workerThreads;
+        std::atomic<bool> _cancelationToken;
+
+        std::mutex _lock;
+        std::condition_variable _condition;
+        size_t pending_requests;
+
+        void update_finished();
+
+        void WorkerThread();
+};
+
+#endif //_SESSION_UPDATER_H_INCLUDED
@@ -24,6 +24,9 @@
 #include "Config.h"
 #include "Common.h"
 #include "DatabaseEnv.h"
+#include "SynchronousQueryWatch.h"
+#include "SessionUpdater.h"
+#include "OpcodeStats.h"
 #include "AccountMgr.h"
 #include "Log.h"
 #include "Opcodes.h"
@@ -45,6 +48,7 @@
 #include "WardenMac.h"
 
 #include <zlib.h>
+#include <chrono>
 
 namespace {
 
@@ -94,6 +98,27 @@ bool WorldSessionFilter::Process(WorldPacket* packet)
     return (player->IsInWorld() == false);
 }
 
+bool ParallelSessionFilter::Process(WorldPacket* packet)
+{
+    OpcodeHandler const& opHandle = opcodeTable[packet->GetOpcode()];
+    if (opHandle.packetProcessing != PROCESS_THREADUNSAFE)
+        return false;
+
+    if (opHandle.status != STATUS_LOGGEDIN && opHandle.status != STATUS_AUTHED)
+        return false;
+
+    //login, logout and map changes stay in World::UpdateSessions()
+    Player* player = m_pSession->GetPlayer();
+    if (!player || !player->IsInWorld() || m_pSession->PlayerLogout())
+        return false;
+
+    // npc interaction removes feign death, which changes update fields
+    if (player->HasUnitState(UNIT_STATE_DIED))
+        return false;
+
+    return SessionUpdater::IsParallelOpcode(packet->GetOpcode());
+}
+
 /// WorldSession constructor
 WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldSocket> sock, AccountTypes sec, uint8 expansion, time_t mute_time, LocaleConstant locale, uint32 recruiter, bool isARecruiter):
     m_muteTime(mute_time),
@@ -110,6 +135,7 @@ WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldS
     _logoutTime(0),
     m_inQueue(false),
     m_playerLoading(false),
+    m_playerInWorld(false),
     m_playerLogout(false),
     m_playerRecentlyLogout(false),
     m_playerSave(false),
@@ -120,6 +146,7 @@ WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldS
     m_TutorialsChanged(false),
     recruiterId(recruiter),
     isRecruiter(isARecruiter),
+    m_worldPacketBudget(0),
     _RBACData(NULL),
     expireTime(60000), // 1 min after socket loss, session is deleted
     forceExit(false),
@@ -232,6 +259,17 @@ void WorldSession::SendPacket(WorldPacket const* packet)
     m_Socket->SendPacket(*packet);
 }
 
+void WorldSession::SendSharedPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    if (!m_Socket)
+        return;
+
+    sScriptMgr->OnPacketSend(this, *packet);
+
+    TC_LOG_TRACE("network.opcode", "S->C: %s %s", GetPlayerInfo().c_str(), GetOpcodeNameForLogging(packet->GetOpcode()).c_str());
+    m_Socket->SendPacket(packet);
+}
+
 /// Add an incoming packet to the queue
 void WorldSession::QueuePacket(WorldPacket* new_packet)
 {
@@ -256,29 +294,32 @@ void WorldSession::LogUnprocessedTail(WorldPacket* packet)
     packet->print_storage();
 }
 
-/// Update the WorldSession (triggered by World update)
-bool WorldSession::Update(uint32 diff, PacketFilter& updater)
-{
-    /// Update Timeout timer.
-    UpdateTimeOutTime(diff);
+#define MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE 100
 
-    ///- Before we process anything:
-    /// If necessary, kick the player from the character select screen
-    if (IsConnectionIdle())
-        m_Socket->CloseSocket();
+void WorldSession::ResetWorldPacketBudget()
+{
+    m_worldPacketBudget = MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE;
+}
 
-    ///- Retrieve packets from the receive queue and call the appropriate handlers
+/// Retrieve packets from the receive queue accepted by the filter and call the appropriate handlers
+void WorldSession::ProcessPackets(PacketFilter& updater, uint32& budget)
+{
     /// not process packets if socket already closed
     WorldPacket* packet = NULL;
     //! Delete packet after processing by default
     bool deletePacket = true;
     std::vector<WorldPacket*> requeuePackets;
-    uint32 processedPackets = 0;
     time_t currentTime = time(NULL);
 
-    while (m_Socket && _recvQueue.next(packet, updater))
+    //process only a max amout of packets in 1 Update() call.
+    //Any leftover will be processed in next update
+    while (budget && m_Socket && _recvQueue.next(packet, updater))
     {
-        OpcodeHandler const& opHandle = opcodeTable[packet->GetOpcode()];
+        uint16 opcode = packet->GetOpcode();
+        OpcodeHandler const& opHandle = opcodeTable[opcode];
+        SynchronousQueryWatch::Scope queryWatchScope(opHandle.name);
+        PacketSubsystemGuard subsystemGuard(SessionUpdater::GetOpcodeSubsystemMask(opcode));
+        std::chrono::steady_clock::time_point handlerStart = std::chrono::steady_clock::now();
         try
         {
             switch (opHandle.status)
@@ -366,21 +407,32 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
             packet->hexlike();
         }
 
+        OpcodeStats::Record(opcode, uint32(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - handlerStart).count()));
+
         if (deletePacket)
             delete packet;
 
         deletePacket = true;
-
-#define MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE 100
-        processedPackets++;
-
-        //process only a max amout of packets in 1 Update() call.
-        //Any leftover will be processed in next update
-        if (processedPackets > MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE)
-            break;
+        --budget;
     }
 
     _recvQueue.readd(requeuePackets.begin(), requeuePackets.end());
+}
+
+/// Update the WorldSession (triggered by World update)
+bool WorldSession::Update(uint32 diff, PacketFilter& updater)
+{
+    /// Update Timeout timer.
+    UpdateTimeOutTime(diff);
+
+    ///- Before we process anything:
+    /// If necessary, kick the player from the character select screen
+    if (IsConnectionIdle())
+        m_Socket->CloseSocket();
+
+    // only the World::UpdateSessions() pass processes logout, it continues the budget of the parallel pass
+    uint32 mapBudget = MAX_PROCESSED_PACKETS_IN_SAME_WORLDSESSION_UPDATE;
+    ProcessPackets(updater, updater.ProcessLogout() ? m_worldPacketBudget : mapBudget);
 
     if (m_Socket && m_Socket->IsOpen() && _warden)
         _warden->Update();
@@ -391,6 +443,8 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
     //logout procedure should happen only in World::UpdateSessions() method!!!
     if (updater.ProcessLogout())
     {
+        _queryProcessor.ProcessReadyQueries();
+
         time_t currTime = time(NULL);
         ///- If necessary, log the player out
         if (ShouldLogOut(currTime) && !m_playerLoading)
@@ -426,6 +480,9 @@ void WorldSession::LogoutPlayer(bool save)
     m_playerLogout = true;
     m_playerSave = save;
 
+    // callbacks queued for this character must not resume on the next one logged in with this session
+    _queryProcessor.CancelAll();
+
     if (_player)
     {
         if (ObjectGuid lguid = _player->GetLootGUID())
@@ -1257,7 +1314,7 @@ void WorldSession::InitializeSession()
         return;
     }
 
-    _realmAccountLoginCallback = CharacterDatabase.DelayQueryHolder(realmHolder);
+    _realmAccountLoginCallback = CharacterDatabase.DelayQueryHolder(realmHolder, "account data");
 }
 
 void WorldSession::InitializeSessionCallback(SQLQueryHolder* realmHolder)
@@ -1313,20 +1370,26 @@ bool WorldSession::DosProtection::EvaluateOpcode(WorldPacket& p, time_t time) co
     if (!maxPacketCounterAllowed)
         return true;
 
-    PacketCounter& packetCounter = _PacketThrottlingMap[p.GetOpcode()];
-    if (packetCounter.lastReceiveTime != time)
+    uint32 amountCounter;
     {
-        packetCounter.lastReceiveTime = time;
-        packetCounter.amountCounter = 0;
+        std::lock_guard<std::mutex> lock(_PacketThrottlingLock);
+        PacketCounter& packetCounter = _PacketThrottlingMap[p.GetOpcode()];
+        if (packetCounter.lastReceiveTime != time)
+        {
+            packetCounter.lastReceiveTime = time;
+            packetCounter.amountCounter = 0;
+        }
+
+        amountCounter = ++packetCounter.amountCounter;
     }
 
     // Check if player is flooding some packets
-    if (++packetCounter.amountCounter <= maxPacketCounterAllowed)
+    if (amountCounter <= maxPacketCounterAllowed)
         return true;
 
     TC_LOG_WARN("network", "AntiDOS: Account %u, IP: %s, Ping: %u, Character: %s, flooding packet (opc: %s (0x%X), count: %u)",
         Session->GetAccountId(), Session->GetRemoteAddress().c_str(), Session->GetLatency(), Session->GetPlayerName().c_str(),
-        opcodeTable[p.GetOpcode()].name, p.GetOpcode(), packetCounter.amountCounter);
+        opcodeTable[p.GetOpcode()].name, p.GetOpcode(), amountCounter);
 
     switch (_policy)
     {
@@ -1359,6 +1422,26 @@ bool WorldSession::DosProtection::EvaluateOpcode(WorldPacket& p, time_t time) co
     }
 }
 
+bool WorldSession::DosProtection::ChargeOpcode(uint16 opcode, time_t time) const
+{
+    uint32 maxPacketCounterAllowed = GetMaxPacketCounterAllowed(opcode);
+    if (!maxPacketCounterAllowed)
+        return true;
+
+    std::lock_guard<std::mutex> lock(_PacketThrottlingLock);
+    PacketCounter& packetCounter = _PacketThrottlingMap[opcode];
+    if (packetCounter.lastReceiveTime != time)
+    {
+        packetCounter.lastReceiveTime = time;
+        packetCounter.amountCounter = 0;
+    }
+
+    if (packetCounter.amountCounter >= maxPacketCounterAllowed)
+        return false;
+
+    ++packetCounter.amountCounter;
+    return true;
+}
 
 uint32 WorldSession::DosProtection::GetMaxPacketCounterAllowed(uint16 opcode) const
 {
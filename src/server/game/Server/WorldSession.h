@@ -33,6 +33,7 @@
 #include "Cryptography/BigNumber.h"
 #include "AccountMgr.h"
 #include <unordered_set>
+#include <mutex>
 
 class Creature;
 class GameObject;
@@ -54,6 +55,8 @@ struct ItemTemplate;
 struct MovementInfo;
 struct TradeStatusInfo;
 
+enum QueryResponseType : uint8;
+
 namespace lfg
 {
 struct LfgJoinResultData;
@@ -183,6 +186,18 @@ public:
     virtual bool Process(WorldPacket* packet) override;
 };
 
+//process thread-unsafe packets of players in world whose handlers only need the session or per subsystem locks
+//used by SessionUpdater before World::UpdateSessions() handles the remaining packets in order
+class ParallelSessionFilter : public PacketFilter
+{
+public:
+    explicit ParallelSessionFilter(WorldSession* pSession) : PacketFilter(pSession) { }
+    ~ParallelSessionFilter() { }
+
+    virtual bool Process(WorldPacket* packet) override;
+    virtual bool ProcessLogout() const override { return false; }
+};
+
 // Proxy structure to contain data passed to callback function,
 // only to prevent bloating the parameter list
 class CharacterCreateInfo
@@ -237,6 +252,16 @@ struct CharacterFactionChangeInfo : public CharacterCustomizeInfo
 
     protected:
         uint8 Race = 0;
+
+        /// Server side data
+        uint16 Opcode = 0;
+        uint8 OldRace = 0;
+        uint8 Class = 0;
+        uint8 Level = 0;
+        uint16 AtLoginFlags = 0;
+        std::string KnownTitles;
+        ObjectGuid::LowType GuildId = 0;
+        std::unordered_map<uint32, int32> Reputations;  // faction -> standing stored in db
 };
 
 struct PacketCounter
@@ -265,6 +290,8 @@ class TC_GAME_API WorldSession
         void WriteMovementInfo(WorldPacket* data, MovementInfo* mi);
 
         void SendPacket(WorldPacket const* packet);
+        /// Sends a packet built once for many receivers, see WorldSocket::SendPacket
+        void SendSharedPacket(std::shared_ptr<WorldPacket const> const& packet);
         void SendNotification(const char *format, ...) ATTR_PRINTF(2, 3);
         void SendNotification(uint32 string_id, ...);
         void SendPetNameInvalid(uint32 error, std::string const& name, DeclinedName *declinedName);
@@ -288,6 +315,11 @@ class TC_GAME_API WorldSession
         AccountTypes GetSecurity() const { return _security; }
         uint32 GetAccountId() const { return _accountId; }
         Player* GetPlayer() const { return _player; }
+        // readable without the session update, used by the network threads
+        bool IsPlayerInWorld() const { return m_playerInWorld; }
+        void SetPlayerInWorld(bool inWorld) { m_playerInWorld = inWorld; }
+        // charges a query answered by the network thread to the AntiDOS counters
+        bool ChargeCachedQuery(uint16 opcode) const { return AntiDOS.ChargeOpcode(opcode, time(NULL)); }
         std::string const& GetPlayerName() const;
         std::string GetPlayerInfo() const;
 
@@ -322,11 +354,15 @@ class TC_GAME_API WorldSession
 
         void QueuePacket(WorldPacket* new_packet);
         bool Update(uint32 diff, PacketFilter& updater);
+        // the parallel and the ordered pass of World::UpdateSessions() share one packet budget per tick
+        void ResetWorldPacketBudget();
+        void ProcessParallelPackets(ParallelSessionFilter& updater) { ProcessPackets(updater, m_worldPacketBudget); }
 
         /// Handle the authentication waiting queue (to be completed)
         void SendAuthWaitQue(uint32 position);
 
         void SendNameQueryOpcode(ObjectGuid guid);
+        bool SendCachedQueryResponse(QueryResponseType type, uint32 entry);
 
         void SendTrainerList(ObjectGuid guid);
         void SendTrainerList(ObjectGuid guid, std::string const& strTitle);
@@ -346,6 +382,7 @@ class TC_GAME_API WorldSession
         void SendUpdateTrade(bool trader_data = true);
         void SendCancelTrade();
 
+        bool CanTurnInPetition(uint32 type, std::string const& name);
         void SendPetitionQueryOpcode(ObjectGuid petitionguid);
 
         // Spell
@@ -437,6 +474,9 @@ class TC_GAME_API WorldSession
         uint32 GetRecruiterId() const { return recruiterId; }
         bool IsARecruiter() const { return isRecruiter; }
 
+        /// Async queries whose callbacks resume in this session's world thread update
+        QueryCallbackProcessor& GetQueryProcessor() { return _queryProcessor; }
+
     public:                                                 // opcodes handlers
 
         void Handle_NULL(WorldPacket& recvPacket);          // not used
@@ -452,6 +492,8 @@ class TC_GAME_API WorldSession
         void HandleCharEnum(PreparedQueryResult result);
         void HandlePlayerLogin(LoginQueryHolder * holder);
         void HandleCharFactionOrRaceChange(WorldPacket& recvData);
+        void HandleCharFactionOrRaceChangeCallback(PreparedQueryResult result, std::shared_ptr<CharacterFactionChangeInfo> factionChangeInfo);
+        void FinishCharFactionOrRaceChange(std::shared_ptr<CharacterFactionChangeInfo> factionChangeInfo);
         void SendCharCreate(ResponseCodes result);
         void SendCharDelete(ResponseCodes result);
         void SendCharRename(ResponseCodes result, CharacterRenameInfo const& renameInfo);
@@ -713,6 +755,7 @@ class TC_GAME_API WorldSession
 
         void HandleUseItemOpcode(WorldPacket& recvPacket);
         void HandleOpenItemOpcode(WorldPacket& recvPacket);
+        void HandleOpenWrappedItemCallback(PreparedQueryResult result, ObjectGuid itemGuid);
         void HandleCastSpellOpcode(WorldPacket& recvPacket);
         void HandleCancelCastOpcode(WorldPacket& recvPacket);
         void HandleCancelAuraOpcode(WorldPacket& recvPacket);
@@ -951,6 +994,7 @@ class TC_GAME_API WorldSession
         void HandleAlterAppearance(WorldPacket& recvData);
         void HandleRemoveGlyph(WorldPacket& recvData);
         void HandleCharCustomize(WorldPacket& recvData);
+        void HandleCharCustomizeCallback(PreparedQueryResult result, CharacterCustomizeInfo customizeInfo);
         void HandleQueryInspectAchievements(WorldPacket& recvData);
         void HandleEquipmentSetSave(WorldPacket& recvData);
         void HandleEquipmentSetDelete(WorldPacket& recvData);
@@ -979,6 +1023,7 @@ class TC_GAME_API WorldSession
         QueryCallback<PreparedQueryResult, ObjectGuid> _sendStabledPetCallback;
         QueryCallback<PreparedQueryResult, CharacterCreateInfo*, true> _charCreateCallback;
         QueryResultHolderFuture _charLoginCallback;
+        QueryCallbackProcessor _queryProcessor;
 
     friend class World;
     protected:
@@ -988,6 +1033,9 @@ class TC_GAME_API WorldSession
             public:
                 DosProtection(WorldSession* s) : Session(s), _policy((Policy)sWorld->getIntConfig(CONFIG_PACKET_SPOOF_POLICY)) { }
                 bool EvaluateOpcode(WorldPacket& p, time_t time) const;
+                // charges a packet answered by the network thread, false once the opcode reached its limit
+                // so the packet has to go through EvaluateOpcode and the configured policy instead
+                bool ChargeOpcode(uint16 opcode, time_t time) const;
             protected:
                 enum Policy
                 {
@@ -1005,6 +1053,8 @@ class TC_GAME_API WorldSession
                 typedef std::unordered_map<uint16, PacketCounter> PacketThrottlingMap;
                 // mark this member as "mutable" so it can be modified even in const functions
                 mutable PacketThrottlingMap _PacketThrottlingMap;
+                // the network thread charges cached query responses while the session updates
+                mutable std::mutex _PacketThrottlingLock;
 
                 DosProtection(DosProtection const& right) = delete;
                 DosProtection& operator=(DosProtection const& right) = delete;
@@ -1016,6 +1066,9 @@ class TC_GAME_API WorldSession
 
         bool CanUseBank(ObjectGuid bankerGUID = ObjectGuid::Empty) const;
 
+        // handles at most budget packets accepted by the filter, the budget is decreased by the handled packets
+        void ProcessPackets(PacketFilter& updater, uint32& budget);
+
         // logging helper
         void LogUnexpectedOpcode(WorldPacket* packet, const char* status, const char *reason);
         void LogUnprocessedTail(WorldPacket* packet);
@@ -1049,6 +1102,7 @@ class TC_GAME_API WorldSession
         time_t _logoutTime;
         bool m_inQueue;                                     // session wait in auth.queue
         bool m_playerLoading;                               // code processed in LoginPlayer
+        std::atomic<bool> m_playerInWorld;                  // _player->IsInWorld(), for STATUS_LOGGEDIN checks outside of the session update
         bool m_playerLogout;                                // code processed in LogoutPlayer
         bool m_playerRecentlyLogout;
         bool m_playerSave;
@@ -1063,6 +1117,7 @@ class TC_GAME_API WorldSession
         uint32 recruiterId;
         bool isRecruiter;
         LockedQueue<WorldPacket*> _recvQueue;
+        uint32 m_worldPacketBudget;                         // packets left to World::UpdateSessions() in the current tick
         rbac::RBACData* _RBACData;
         uint32 expireTime;
         bool forceExit;
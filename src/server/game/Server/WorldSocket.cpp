@@ -22,6 +22,7 @@
 #include "ScriptMgr.h"
 #include "SHA1.h"
 #include "PacketLog.h"
+#include "QueryResponseCache.h"
 
 #include <memory>
 
@@ -29,17 +30,21 @@ class EncryptablePacket : public WorldPacket
 {
 public:
     EncryptablePacket(WorldPacket const& packet, bool encrypt) : WorldPacket(packet), _encrypt(encrypt) { }
+    EncryptablePacket(std::shared_ptr<WorldPacket const> const& packet, bool encrypt) : WorldPacket(), _shared(packet), _encrypt(encrypt) { }
 
+    /// Packets broadcast to many sockets are serialized once and shared instead of being copied per socket
+    WorldPacket const& GetPacket() const { return _shared ? *_shared : *this; }
     bool NeedsEncryption() const { return _encrypt; }
 
 private:
+    std::shared_ptr<WorldPacket const> _shared;
     bool _encrypt;
 };
 
 using boost::asio::ip::tcp;
 
 WorldSocket::WorldSocket(tcp::socket&& socket)
-    : Socket(std::move(socket)), _authSeed(rand32()), _OverSpeedPings(0), _worldSession(nullptr), _authed(false)
+    : Socket(std::move(socket)), _authSeed(rand32()), _OverSpeedPings(0), _worldSession(nullptr), _authed(false), _accountId(0)
 {
     _headerBuffer.Resize(sizeof(ClientPktHeader));
 }
@@ -90,28 +95,29 @@ bool WorldSocket::Update()
     MessageBuffer buffer;
     while (_bufferQueue.Dequeue(queued))
     {
-        ServerPktHeader header(queued->size() + 2, queued->GetOpcode());
+        WorldPacket const& packet = queued->GetPacket();
+        ServerPktHeader header(packet.size() + 2, packet.GetOpcode());
         if (queued->NeedsEncryption())
             _authCrypt.EncryptSend(header.header, header.getHeaderLength());
 
-        if (buffer.GetRemainingSpace() < queued->size() + header.getHeaderLength())
+        if (buffer.GetRemainingSpace() < packet.size() + header.getHeaderLength())
         {
             QueuePacket(std::move(buffer));
             buffer.Resize(4096);
         }
 
-        if (buffer.GetRemainingSpace() >= queued->size() + header.getHeaderLength())
+        if (buffer.GetRemainingSpace() >= packet.size() + header.getHeaderLength())
         {
             buffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                buffer.Write(queued->contents(), queued->size());
+            if (!packet.empty())
+                buffer.Write(packet.contents(), packet.size());
         }
         else    // single packet larger than 4096 bytes
         {
-            MessageBuffer packetBuffer(queued->size() + header.getHeaderLength());
+            MessageBuffer packetBuffer(packet.size() + header.getHeaderLength());
             packetBuffer.Write(header.header, header.getHeaderLength());
-            if (!queued->empty())
-                packetBuffer.Write(queued->contents(), queued->size());
+            if (!packet.empty())
+                packetBuffer.Write(packet.contents(), packet.size());
 
             QueuePacket(std::move(packetBuffer));
         }
@@ -317,7 +323,7 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
     WorldPacket packet(opcode, std::move(_packetBuffer));
 
     if (sPacketLog->CanLogPacket())
-        sPacketLog->LogPacket(packet, CLIENT_TO_SERVER, GetRemoteIpAddress(), GetRemotePort());
+        sPacketLog->LogPacket(packet, CLIENT_TO_SERVER, GetRemoteIpAddress(), GetRemotePort(), _accountId);
 
     std::unique_lock<std::mutex> sessionGuard(_worldSessionLock, std::defer_lock);
 
@@ -356,6 +362,10 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
             // Catches people idling on the login screen and any lingering ingame connections.
             _worldSession->ResetTimeOutTime();
 
+            // Static template queries are answered right here once their response has been built
+            if (SendCachedQueryResponse(packet))
+                break;
+
             // Copy the packet to the heap before enqueuing
             _worldSession->QueuePacket(new WorldPacket(std::move(packet)));
             break;
@@ -365,6 +375,35 @@ WorldSocket::ReadDataHandlerResult WorldSocket::ReadDataHandler()
     return ReadDataHandlerResult::Ok;
 }
 
+bool WorldSocket::SendCachedQueryResponse(WorldPacket const& packet)
+{
+    QueryResponseType type;
+    if (!QueryResponseCache::GetResponseTypeForOpcode(packet.GetOpcode(), type))
+        return false;
+
+    // the cached opcodes are STATUS_LOGGEDIN, anything else is left to the session update to reject
+    if (!_worldSession->IsPlayerInWorld())
+        return false;
+
+    // every cached query starts with the entry it asks for
+    if (packet.size() < sizeof(uint32))
+        return false;
+
+    QueryResponseCache::ResponsePtr response = sQueryResponseCache->Find(type, packet.read<uint32>(0), _worldSession->GetSessionDbLocaleIndex());
+    if (!response)
+        return false;
+
+    // floods go through the session update, where AntiDOS applies its policy
+    if (!_worldSession->ChargeCachedQuery(packet.GetOpcode()))
+        return false;
+
+    sQueryResponseCache->CountHit(type);
+    for (WorldPacket const& responsePacket : *response)
+        SendPacket(responsePacket);
+
+    return true;
+}
+
 void WorldSocket::LogOpcodeText(uint16 opcode, std::unique_lock<std::mutex> const& guard) const
 {
     if (!guard)
@@ -390,7 +429,18 @@ void WorldSocket::SendPacket(WorldPacket const& packet)
         return;
 
     if (sPacketLog->CanLogPacket())
-        sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort());
+        sPacketLog->LogPacket(packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort(), _accountId);
+
+    _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
+}
+
+void WorldSocket::SendPacket(std::shared_ptr<WorldPacket const> const& packet)
+{
+    if (!IsOpen())
+        return;
+
+    if (sPacketLog->CanLogPacket())
+        sPacketLog->LogPacket(*packet, SERVER_TO_CLIENT, GetRemoteIpAddress(), GetRemotePort(), _accountId);
 
     _bufferQueue.Enqueue(new EncryptablePacket(packet, _authCrypt.IsInitialized()));
 }
@@ -434,6 +484,7 @@ void WorldSocket::HandleAuthSessionCallback(std::shared_ptr<AuthSession> authSes
     }
 
     AccountInfo account(result->Fetch());
+    _accountId = account.Id;
 
     // For hook purposes, we get Remoteaddress at this point.
     std::string address = GetRemoteIpAddress().to_string();
@@ -62,6 +62,8 @@ public:
     bool Update() override;
 
     void SendPacket(WorldPacket const& packet);
+    /// queues a packet shared with other sockets, the payload is not copied
+    void SendPacket(std::shared_ptr<WorldPacket const> const& packet);
 
 protected:
     void OnClose() override;
@@ -92,6 +94,9 @@ private:
     void SendAuthResponseError(uint8 code);
 
     bool HandlePing(WorldPacket& recvPacket);
+    /// answers static template queries from QueryResponseCache without queueing them to the session
+    /// only call it when holding _worldSessionLock
+    bool SendCachedQueryResponse(WorldPacket const& packet);
 
     uint32 _authSeed;
     AuthCrypt _authCrypt;
@@ -102,6 +107,7 @@ private:
     std::mutex _worldSessionLock;
     WorldSession* _worldSession;
     bool _authed;
+    std::atomic<uint32> _accountId; // packet log filtering, readable without _worldSessionLock
 
     MessageBuffer _headerBuffer;
     MessageBuffer _packetBuffer;
@@ -627,6 +627,107 @@ m_caster((info->HasAttribute(SPELL_ATTR6_CAST_BY_CHARMER) && caster->GetCharmerO
         m_destTargets[i] = SpellDestination(*m_caster);
 }
 
+namespace
+{
+    // Finished spells kept for reuse per thread, beyond this they go back to the heap
+    uint32 const SPELL_POOL_MAX_FREE = 512;
+
+    class SpellPool
+    {
+        public:
+            SpellPool() : _free(nullptr), _count(0) { }
+
+            ~SpellPool()
+            {
+                while (_free)
+                {
+                    FreeSpell* next = _free->Next;
+                    ::operator delete(_free);
+                    _free = next;
+                }
+            }
+
+            void* Acquire()
+            {
+                if (!_free)
+                    return nullptr;
+
+                FreeSpell* spell = _free;
+                _free = spell->Next;
+                --_count;
+                return spell;
+            }
+
+            bool Release(void* ptr)
+            {
+                if (_count >= SPELL_POOL_MAX_FREE)
+                    return false;
+
+                FreeSpell* spell = static_cast<FreeSpell*>(ptr);
+                spell->Next = _free;
+                _free = spell;
+                ++_count;
+                return true;
+            }
+
+        private:
+            struct FreeSpell
+            {
+                FreeSpell* Next;
+            };
+
+            FreeSpell* _free;
+            uint32 _count;
+    };
+
+    // Maps are updated by the map update threads, so each thread's pool serves the maps it updates
+    thread_local SpellPool LocalSpellPool;
+}
+
+void SpellAllocationStats::Reset()
+{
+    Spells = 0;
+    PooledSpells = 0;
+    TargetSpills = 0;
+    Scripts = 0;
+    ExecuteLogs = 0;
+}
+
+SpellAllocationStats& Spell::GetAllocationStats()
+{
+    static SpellAllocationStats stats;
+    return stats;
+}
+
+void* Spell::operator new(size_t size)
+{
+    SpellAllocationStats& stats = GetAllocationStats();
+    bool const countAllocations = stats.Enabled;
+    if (countAllocations)
+        ++stats.Spells;
+
+    if (size == sizeof(Spell))
+    {
+        if (void* ptr = LocalSpellPool.Acquire())
+        {
+            if (countAllocations)
+                ++stats.PooledSpells;
+            return ptr;
+        }
+    }
+
+    return ::operator new(size);
+}
+
+void Spell::operator delete(void* ptr, size_t size)
+{
+    if (!ptr)
+        return;
+
+    if (size != sizeof(Spell) || !LocalSpellPool.Release(ptr))
+        ::operator delete(ptr);
+}
+
 Spell::~Spell()
 {
     // unload scripts
@@ -789,7 +890,7 @@ void Spell::SelectSpellTargets()
         if (m_spellInfo->IsChanneled())
         {
             uint8 mask = (1 << i);
-            for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+            for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
             {
                 if (ihit->effectMask & mask)
                 {
@@ -801,7 +902,7 @@ void Spell::SelectSpellTargets()
         else if (m_auraScaleMask)
         {
             bool checkLvl = !m_UniqueTargetInfo.empty();
-            for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end();)
+            for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end();)
             {
                 // remove targets which did not pass min level check
                 if (m_auraScaleMask && ihit->effectMask == m_auraScaleMask)
@@ -809,7 +910,7 @@ void Spell::SelectSpellTargets()
                     // Do not check for selfcast
                     if (!ihit->scaleAura && ihit->targetGUID != m_caster->GetGUID())
                     {
-                         m_UniqueTargetInfo.erase(ihit++);
+                         ihit = m_UniqueTargetInfo.erase(ihit);
                          continue;
                     }
                 }
@@ -1160,7 +1261,7 @@ void Spell::SelectImplicitAreaTargets(SpellEffIndex effIndex, SpellImplicitTarge
         case TARGET_REFERENCE_TYPE_LAST:
         {
             // find last added target for this effect
-            for (std::list<TargetInfo>::reverse_iterator ihit = m_UniqueTargetInfo.rbegin(); ihit != m_UniqueTargetInfo.rend(); ++ihit)
+            for (TargetInfoList::reverse_iterator ihit = m_UniqueTargetInfo.rbegin(); ihit != m_UniqueTargetInfo.rend(); ++ihit)
             {
                 if (ihit->effectMask & (1<<effIndex))
                 {
@@ -2032,7 +2133,7 @@ void Spell::AddUnitTarget(Unit* target, uint32 effectMask, bool checkIfValid /*=
     ObjectGuid targetGUID = target->GetGUID();
 
     // Lookup target in already in list
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if (targetGUID == ihit->targetGUID)             // Found in list
         {
@@ -2111,6 +2212,8 @@ void Spell::AddUnitTarget(Unit* target, uint32 effectMask, bool checkIfValid /*=
         targetInfo.reflectResult = SPELL_MISS_NONE;
 
     // Add target to list
+    if (m_UniqueTargetInfo.size() == m_UniqueTargetInfo.capacity() && GetAllocationStats().Enabled)
+        ++GetAllocationStats().TargetSpills;
     m_UniqueTargetInfo.push_back(targetInfo);
 }
 
@@ -2142,7 +2245,7 @@ void Spell::AddGOTarget(GameObject* go, uint32 effectMask)
     ObjectGuid targetGUID = go->GetGUID();
 
     // Lookup target in already in list
-    for (std::list<GOTargetInfo>::iterator ihit = m_UniqueGOTargetInfo.begin(); ihit != m_UniqueGOTargetInfo.end(); ++ihit)
+    for (GOTargetInfoList::iterator ihit = m_UniqueGOTargetInfo.begin(); ihit != m_UniqueGOTargetInfo.end(); ++ihit)
     {
         if (targetGUID == ihit->targetGUID)                 // Found in list
         {
@@ -2173,6 +2276,8 @@ void Spell::AddGOTarget(GameObject* go, uint32 effectMask)
         target.timeDelay = 0LL;
 
     // Add target to list
+    if (m_UniqueGOTargetInfo.size() == m_UniqueGOTargetInfo.capacity() && GetAllocationStats().Enabled)
+        ++GetAllocationStats().TargetSpills;
     m_UniqueGOTargetInfo.push_back(target);
 }
 
@@ -2187,7 +2292,7 @@ void Spell::AddItemTarget(Item* item, uint32 effectMask)
         return;
 
     // Lookup target in already in list
-    for (std::list<ItemTargetInfo>::iterator ihit = m_UniqueItemInfo.begin(); ihit != m_UniqueItemInfo.end(); ++ihit)
+    for (ItemTargetInfoList::iterator ihit = m_UniqueItemInfo.begin(); ihit != m_UniqueItemInfo.end(); ++ihit)
     {
         if (item == ihit->item)                            // Found in list
         {
@@ -2202,6 +2307,8 @@ void Spell::AddItemTarget(Item* item, uint32 effectMask)
     target.item       = item;
     target.effectMask = effectMask;
 
+    if (m_UniqueItemInfo.size() == m_UniqueItemInfo.capacity() && GetAllocationStats().Enabled)
+        ++GetAllocationStats().TargetSpills;
     m_UniqueItemInfo.push_back(target);
 }
 
@@ -2210,12 +2317,16 @@ void Spell::AddDestTarget(SpellDestination const& dest, uint32 effIndex)
     m_destTargets[effIndex] = dest;
 }
 
-void Spell::DoAllEffectOnTarget(TargetInfo* target)
+void Spell::DoAllEffectOnTarget(TargetInfo* targetInfo)
 {
-    if (!target || target->processed)
+    if (!targetInfo || targetInfo->processed)
         return;
 
-    target->processed = true;                               // Target checked in apply effects procedure
+    targetInfo->processed = true;                           // Target checked in apply effects procedure
+
+    // effect handlers may add targets and move the target list, work on a copy from here on
+    TargetInfo const copy = *targetInfo;
+    TargetInfo const* target = &copy;
 
     // Get mask of effects for target
     uint8 mask = target->effectMask;
@@ -2749,7 +2860,8 @@ void Spell::DoAllEffectOnTarget(GOTargetInfo* target)
 void Spell::DoAllEffectOnTarget(ItemTargetInfo* target)
 {
     uint32 effectMask = target->effectMask;
-    if (!target->item || !effectMask)
+    Item* item = target->item;
+    if (!item || !effectMask)
         return;
 
     PrepareScriptHitHandlers();
@@ -2757,7 +2869,7 @@ void Spell::DoAllEffectOnTarget(ItemTargetInfo* target)
 
     for (uint32 effectNumber = 0; effectNumber < MAX_SPELL_EFFECTS; ++effectNumber)
         if (effectMask & (1 << effectNumber))
-            HandleEffects(NULL, target->item, NULL, effectNumber, SPELL_EFFECT_HANDLE_HIT_TARGET);
+            HandleEffects(NULL, item, NULL, effectNumber, SPELL_EFFECT_HANDLE_HIT_TARGET);
 
     CallScriptOnHitHandlers();
 
@@ -2786,7 +2898,7 @@ bool Spell::UpdateChanneledTargetList()
             modOwner->ApplySpellMod(m_spellInfo->Id, SPELLMOD_RANGE, range, this);
     }
 
-    for (std::list<TargetInfo>::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoList::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if (ihit->missCondition == SPELL_MISS_NONE && (channelTargetEffectMask & ihit->effectMask))
         {
@@ -3031,7 +3143,7 @@ void Spell::cancel()
             break;
 
         case SPELL_STATE_CASTING:
-            for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+            for (TargetInfoList::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
                 if ((*ihit).missCondition == SPELL_MISS_NONE)
                     if (Unit* unit = m_caster->GetGUID() == ihit->targetGUID ? m_caster : ObjectAccessor::GetUnit(*m_caster, ihit->targetGUID))
                         unit->RemoveOwnedAura(m_spellInfo->Id, m_originalCasterGUID, 0, AURA_REMOVE_BY_CANCEL);
@@ -3316,11 +3428,12 @@ void Spell::handle_immediate()
     // process immediate effects (items, ground, etc.) also initialize some variables
     _handle_immediate_phase();
 
-    for (std::list<TargetInfo>::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
-        DoAllEffectOnTarget(&(*ihit));
+    // effect handlers may add targets, so walk by index
+    for (size_t i = 0; i < m_UniqueTargetInfo.size(); ++i)
+        DoAllEffectOnTarget(&m_UniqueTargetInfo[i]);
 
-    for (std::list<GOTargetInfo>::iterator ihit= m_UniqueGOTargetInfo.begin(); ihit != m_UniqueGOTargetInfo.end(); ++ihit)
-        DoAllEffectOnTarget(&(*ihit));
+    for (size_t i = 0; i < m_UniqueGOTargetInfo.size(); ++i)
+        DoAllEffectOnTarget(&m_UniqueGOTargetInfo[i]);
 
     FinishTargetProcessing();
 
@@ -3363,29 +3476,32 @@ uint64 Spell::handle_delayed(uint64 t_offset)
     bool single_missile = (m_targets.HasDst());
 
     // now recheck units targeting correctness (need before any effects apply to prevent adding immunity at first effect not allow apply second spell effect and similar cases)
-    for (std::list<TargetInfo>::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    // effect handlers may add targets, so walk by index
+    for (size_t i = 0; i < m_UniqueTargetInfo.size(); ++i)
     {
-        if (ihit->processed == false)
+        TargetInfo& target = m_UniqueTargetInfo[i];
+        if (target.processed == false)
         {
-            if (single_missile || ihit->timeDelay <= t_offset)
+            if (single_missile || target.timeDelay <= t_offset)
             {
-                ihit->timeDelay = t_offset;
-                DoAllEffectOnTarget(&(*ihit));
+                target.timeDelay = t_offset;
+                DoAllEffectOnTarget(&target);
             }
-            else if (next_time == 0 || ihit->timeDelay < next_time)
-                next_time = ihit->timeDelay;
+            else if (next_time == 0 || target.timeDelay < next_time)
+                next_time = target.timeDelay;
         }
     }
 
     // now recheck gameobject targeting correctness
-    for (std::list<GOTargetInfo>::iterator ighit= m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end(); ++ighit)
+    for (size_t i = 0; i < m_UniqueGOTargetInfo.size(); ++i)
     {
-        if (ighit->processed == false)
+        GOTargetInfo& target = m_UniqueGOTargetInfo[i];
+        if (target.processed == false)
         {
-            if (single_missile || ighit->timeDelay <= t_offset)
-                DoAllEffectOnTarget(&(*ighit));
-            else if (next_time == 0 || ighit->timeDelay < next_time)
-                next_time = ighit->timeDelay;
+            if (single_missile || target.timeDelay <= t_offset)
+                DoAllEffectOnTarget(&target);
+            else if (next_time == 0 || target.timeDelay < next_time)
+                next_time = target.timeDelay;
         }
     }
 
@@ -3436,8 +3552,8 @@ void Spell::_handle_immediate_phase()
     }
 
     // process items
-    for (std::list<ItemTargetInfo>::iterator ihit= m_UniqueItemInfo.begin(); ihit != m_UniqueItemInfo.end(); ++ihit)
-        DoAllEffectOnTarget(&(*ihit));
+    for (size_t i = 0; i < m_UniqueItemInfo.size(); ++i)
+        DoAllEffectOnTarget(&m_UniqueItemInfo[i]);
 
     if (!m_originalCaster)
         return;
@@ -4033,7 +4149,7 @@ void Spell::WriteSpellGoTargets(WorldPacket* data)
 {
     // This function also fill data for channeled spells:
     // m_needAliveTargetMask req for stop channelig if one target die
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         if ((*ihit).effectMask == 0)                  // No effect apply - all immuned add state
             // possibly SPELL_MISS_IMMUNE2 for this??
@@ -4049,7 +4165,7 @@ void Spell::WriteSpellGoTargets(WorldPacket* data)
     uint32 hit = 0;
     size_t hitPos = data->wpos();
     *data << (uint8)0; // placeholder
-    for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end() && hit < 255; ++ihit)
+    for (TargetInfoList::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end() && hit < 255; ++ihit)
     {
         if ((*ihit).missCondition == SPELL_MISS_NONE)       // Add only hits
         {
@@ -4059,7 +4175,7 @@ void Spell::WriteSpellGoTargets(WorldPacket* data)
         }
     }
 
-    for (std::list<GOTargetInfo>::const_iterator ighit = m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end() && hit < 255; ++ighit)
+    for (GOTargetInfoList::const_iterator ighit = m_UniqueGOTargetInfo.begin(); ighit != m_UniqueGOTargetInfo.end() && hit < 255; ++ighit)
     {
         *data << uint64(ighit->targetGUID);                 // Always hits
         ++hit;
@@ -4068,7 +4184,7 @@ void Spell::WriteSpellGoTargets(WorldPacket* data)
     uint32 miss = 0;
     size_t missPos = data->wpos();
     *data << (uint8)0; // placeholder
-    for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end() && miss < 255; ++ihit)
+    for (TargetInfoList::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end() && miss < 255; ++ihit)
     {
         if (ihit->missCondition != SPELL_MISS_NONE)        // Add only miss
         {
@@ -4344,7 +4460,7 @@ void Spell::TakePower()
     {
         if (powerType == POWER_RAGE || powerType == POWER_ENERGY || powerType == POWER_RUNE)
             if (ObjectGuid targetGUID = m_targets.GetUnitTargetGUID())
-                for (std::list<TargetInfo>::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+                for (TargetInfoList::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
                     if (ihit->targetGUID == targetGUID)
                     {
                         if (ihit->missCondition != SPELL_MISS_NONE)
@@ -4632,7 +4748,7 @@ void Spell::HandleThreatSpells()
     // since 2.0.1 threat from positive effects also is distributed among all targets, so the overall caused threat is at most the defined bonus
     threat /= m_UniqueTargetInfo.size();
 
-    for (std::list<TargetInfo>::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoList::iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
     {
         float threatToAdd = threat;
         if (ihit->missCondition != SPELL_MISS_NONE)
@@ -5745,7 +5861,7 @@ bool Spell::CanAutoCast(Unit* target)
     {
         SelectSpellTargets();
         //check if among target units, our WANTED target is as well (->only self cast spells return false)
-        for (std::list<TargetInfo>::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+        for (TargetInfoList::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
             if (ihit->targetGUID == targetguid)
                 return true;
     }
@@ -6429,7 +6545,7 @@ void Spell::DelayedChannel()
 
     TC_LOG_DEBUG("spells", "Spell %u partially interrupted for %i ms, new duration: %u ms", m_spellInfo->Id, delaytime, m_timer);
 
-    for (std::list<TargetInfo>::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    for (TargetInfoList::const_iterator ihit = m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
         if ((*ihit).missCondition == SPELL_MISS_NONE)
             if (Unit* unit = (m_caster->GetGUID() == ihit->targetGUID) ? m_caster : ObjectAccessor::GetUnit(*m_caster, ihit->targetGUID))
                 unit->DelayOwnedAuras(m_spellInfo->Id, m_originalCasterGUID, delaytime);
@@ -6600,15 +6716,15 @@ bool Spell::IsNeedSendToClient() const
 
 bool Spell::HaveTargetsForEffect(uint8 effect) const
 {
-    for (std::list<TargetInfo>::const_iterator itr = m_UniqueTargetInfo.begin(); itr != m_UniqueTargetInfo.end(); ++itr)
+    for (TargetInfoList::const_iterator itr = m_UniqueTargetInfo.begin(); itr != m_UniqueTargetInfo.end(); ++itr)
         if (itr->effectMask & (1 << effect))
             return true;
 
-    for (std::list<GOTargetInfo>::const_iterator itr = m_UniqueGOTargetInfo.begin(); itr != m_UniqueGOTargetInfo.end(); ++itr)
+    for (GOTargetInfoList::const_iterator itr = m_UniqueGOTargetInfo.begin(); itr != m_UniqueGOTargetInfo.end(); ++itr)
         if (itr->effectMask & (1 << effect))
             return true;
 
-    for (std::list<ItemTargetInfo>::const_iterator itr = m_UniqueItemInfo.begin(); itr != m_UniqueItemInfo.end(); ++itr)
+    for (ItemTargetInfoList::const_iterator itr = m_UniqueItemInfo.begin(); itr != m_UniqueItemInfo.end(); ++itr)
         if (itr->effectMask & (1 << effect))
             return true;
 
@@ -6770,11 +6886,10 @@ void Spell::HandleLaunchPhase()
             usesAmmo=false;
     }
 
-    for (std::list<TargetInfo>::iterator ihit= m_UniqueTargetInfo.begin(); ihit != m_UniqueTargetInfo.end(); ++ihit)
+    // launch handlers may add targets and move the target list, so walk by index
+    for (size_t i = 0; i < m_UniqueTargetInfo.size(); ++i)
     {
-        TargetInfo& target = *ihit;
-
-        uint32 mask = target.effectMask;
+        uint32 mask = m_UniqueTargetInfo[i].effectMask;
         if (!mask)
             continue;
 
@@ -6803,12 +6918,16 @@ void Spell::HandleLaunchPhase()
                     break;
             }
         }
-        DoAllEffectOnLaunchTarget(target, multiplier);
+        DoAllEffectOnLaunchTarget(i, multiplier);
     }
 }
 
-void Spell::DoAllEffectOnLaunchTarget(TargetInfo& targetInfo, float* multiplier)
+void Spell::DoAllEffectOnLaunchTarget(size_t targetIndex, float* multiplier)
 {
+    // effect handlers may add targets and move the target list, only access the entry through its index
+    TargetInfo const& targetInfo = m_UniqueTargetInfo[targetIndex];
+    uint8 const effectMask = targetInfo.effectMask;
+
     Unit* unit = NULL;
     // In case spell hit target, do all effect on that target
     if (targetInfo.missCondition == SPELL_MISS_NONE)
@@ -6821,7 +6940,7 @@ void Spell::DoAllEffectOnLaunchTarget(TargetInfo& targetInfo, float* multiplier)
 
     for (uint32 i = 0; i < MAX_SPELL_EFFECTS; ++i)
     {
-        if (targetInfo.effectMask & (1<<i))
+        if (effectMask & (1<<i))
         {
             m_damage = 0;
             m_healing = 0;
@@ -6850,11 +6969,11 @@ void Spell::DoAllEffectOnLaunchTarget(TargetInfo& targetInfo, float* multiplier)
                 m_damage = int32(m_damage * m_damageMultipliers[i]);
                 m_damageMultipliers[i] *= multiplier[i];
             }
-            targetInfo.damage += m_damage;
+            m_UniqueTargetInfo[targetIndex].damage += m_damage;
         }
     }
 
-    targetInfo.crit = m_caster->IsSpellCrit(unit, m_spellInfo, m_spellSchoolMask, m_attackType);
+    m_UniqueTargetInfo[targetIndex].crit = m_caster->IsSpellCrit(unit, m_spellInfo, m_spellSchoolMask, m_attackType);
 }
 
 SpellCastResult Spell::CanOpenLock(uint32 effIndex, uint32 lockId, SkillType& skillId, int32& reqSkillValue, int32& skillValue)
@@ -6960,6 +7079,8 @@ void Spell::InitEffectExecuteData(uint8 effIndex)
     if (!m_effectExecuteData[effIndex])
     {
         m_effectExecuteData[effIndex] = new ByteBuffer(0x20);
+        if (GetAllocationStats().Enabled)
+            ++GetAllocationStats().ExecuteLogs;
         // first dword - target counter
         *m_effectExecuteData[effIndex] << uint32(1);
     }
@@ -6980,6 +7101,9 @@ void Spell::CheckEffectExecuteData()
 void Spell::LoadScripts()
 {
     sScriptMgr->CreateSpellScripts(m_spellInfo->Id, m_loadedScripts);
+    if (!m_loadedScripts.empty() && GetAllocationStats().Enabled)
+        GetAllocationStats().Scripts += m_loadedScripts.size();
+
     for (std::list<SpellScript*>::iterator itr = m_loadedScripts.begin(); itr != m_loadedScripts.end();)
     {
         if (!(*itr)->_Load(this))
@@ -24,6 +24,9 @@
 #include "ObjectMgr.h"
 #include "SpellInfo.h"
 #include "PathGenerator.h"
+#include "SmallVector.h"
+
+#include <atomic>
 
 class Unit;
 class Player;
@@ -218,6 +221,24 @@ enum SpellEffectHandleMode
 
 typedef std::list<std::pair<uint32, ObjectGuid>> DispelList;
 
+// Heap allocations made on the spell cast path, for .debug spellalloc
+// Only counted with Debug.SpellAllocationStats enabled, the shared counters are too costly on every cast otherwise
+struct SpellAllocationStats
+{
+    SpellAllocationStats() : Enabled(false), Spells(0), PooledSpells(0), TargetSpills(0), Scripts(0), ExecuteLogs(0) { }
+
+    std::atomic<bool> Enabled;
+
+    std::atomic<uint64> Spells;                             // Spell objects created
+    std::atomic<uint64> PooledSpells;                       // of which reused memory of a finished spell
+    std::atomic<uint64> TargetSpills;                       // target lists that outgrew their inline storage
+    std::atomic<uint64> Scripts;                            // SpellScript instances loaded for casts
+    std::atomic<uint64> ExecuteLogs;                        // effect execute log buffers
+
+    uint64 GetHeapAllocations() const { return Spells - PooledSpells + TargetSpills + Scripts + ExecuteLogs; }
+    void Reset();
+};
+
 class TC_GAME_API Spell
 {
     friend void Unit::SetCurrentCastSpell(Spell* pSpell);
@@ -355,6 +376,12 @@ class TC_GAME_API Spell
         Spell(Unit* caster, SpellInfo const* info, TriggerCastFlags triggerFlags, ObjectGuid originalCasterGUID = ObjectGuid::Empty, bool skipCheck = false);
         ~Spell();
 
+        // Spell memory is recycled through a free list owned by the (map update) thread releasing it
+        static void* operator new(size_t size);
+        static void operator delete(void* ptr, size_t size);
+
+        static SpellAllocationStats& GetAllocationStats();
+
         void InitExplicitTargets(SpellCastTargets const& targets);
         void SelectExplicitTargets();
 
@@ -597,7 +624,8 @@ class TC_GAME_API Spell
             bool   scaleAura:1;
             int32  damage;
         };
-        std::list<TargetInfo> m_UniqueTargetInfo;
+        typedef Trinity::SmallVector<TargetInfo, 8> TargetInfoList;
+        TargetInfoList m_UniqueTargetInfo;
         uint8 m_channelTargetEffectMask;                        // Mask req. alive targets
 
         struct GOTargetInfo
@@ -607,14 +635,16 @@ class TC_GAME_API Spell
             uint8  effectMask:8;
             bool   processed:1;
         };
-        std::list<GOTargetInfo> m_UniqueGOTargetInfo;
+        typedef Trinity::SmallVector<GOTargetInfo, 2> GOTargetInfoList;
+        GOTargetInfoList m_UniqueGOTargetInfo;
 
         struct ItemTargetInfo
         {
             Item  *item;
             uint8 effectMask;
         };
-        std::list<ItemTargetInfo> m_UniqueItemInfo;
+        typedef Trinity::SmallVector<ItemTargetInfo, 2> ItemTargetInfoList;
+        ItemTargetInfoList m_UniqueItemInfo;
 
         SpellDestination m_destTargets[MAX_SPELL_EFFECTS];
 
@@ -631,7 +661,7 @@ class TC_GAME_API Spell
         bool UpdateChanneledTargetList();
         bool IsValidDeadOrAliveTarget(Unit const* target) const;
         void HandleLaunchPhase();
-        void DoAllEffectOnLaunchTarget(TargetInfo& targetInfo, float* multiplier);
+        void DoAllEffectOnLaunchTarget(size_t targetIndex, float* multiplier);
 
         void PrepareTargetProcessing();
         void FinishTargetProcessing();
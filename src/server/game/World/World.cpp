@@ -36,6 +36,7 @@
 #include "CreatureGroups.h"
 #include "CreatureTextMgr.h"
 #include "DatabaseEnv.h"
+#include "SynchronousQueryWatch.h"
 #include "DisableMgr.h"
 #include "GameEventMgr.h"
 #include "GameObjectModel.h"
@@ -57,6 +58,7 @@
 #include "SkillDiscovery.h"
 #include "SkillExtraItems.h"
 #include "SmartAI.h"
+#include "Spell.h"
 #include "TicketMgr.h"
 #include "TransportMgr.h"
 #include "Unit.h"
@@ -123,6 +125,9 @@ World::World()
 /// World destructor
 World::~World()
 {
+    if (m_sessionUpdater.activated())
+        m_sessionUpdater.deactivate();
+
     ///- Empty the kicked session set
     while (!m_sessions.empty())
     {
@@ -612,6 +617,8 @@ void World::LoadConfigSettings(bool reload)
         TC_LOG_ERROR("server.loading", "InstanceMapLoadAllGrids enabled, but GridUnload also enabled. GridUnload must be disabled to enable instance map pre-loading. Instance map pre-loading disabled");
         m_bool_configs[CONFIG_INSTANCEMAP_LOAD_GRIDS] = false;
     }
+    m_bool_configs[CONFIG_GRID_PRELOAD] = sConfigMgr->GetBoolDefault("GridPreload.Enable", true);
+    m_int_configs[CONFIG_GRID_PRELOAD_LOOKAHEAD] = sConfigMgr->GetIntDefault("GridPreload.LookAhead", 10);
     m_int_configs[CONFIG_INTERVAL_SAVE] = sConfigMgr->GetIntDefault("PlayerSaveInterval", 15 * MINUTE * IN_MILLISECONDS);
     m_int_configs[CONFIG_INTERVAL_DISCONNECT_TOLERANCE] = sConfigMgr->GetIntDefault("DisconnectToleranceInterval", 0);
     m_bool_configs[CONFIG_STATS_SAVE_ONLY_ON_LOGOUT] = sConfigMgr->GetBoolDefault("PlayerSave.Stats.SaveOnlyOnLogout", true);
@@ -965,6 +972,8 @@ void World::LoadConfigSettings(bool reload)
         m_bool_configs[CONFIG_SAVE_RESPAWN_TIME_IMMEDIATELY] = true;
     }
 
+    m_int_configs[CONFIG_RESPAWN_JOURNAL_SAVE_INTERVAL] = sConfigMgr->GetIntDefault("SaveRespawnTimeInterval", 10);
+
     m_bool_configs[CONFIG_WEATHER] = sConfigMgr->GetBoolDefault("ActivateWeather", true);
 
     m_int_configs[CONFIG_DISABLE_BREATHING] = sConfigMgr->GetIntDefault("DisableWaterBreath", SEC_CONSOLE);
@@ -985,6 +994,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_CHATFLOOD_MUTE_TIME]     = sConfigMgr->GetIntDefault("ChatFlood.MuteTime", 10);
 
     m_bool_configs[CONFIG_EVENT_ANNOUNCE] = sConfigMgr->GetBoolDefault("Event.Announce", false);
+    m_int_configs[CONFIG_GAME_EVENT_SPAWNS_PER_UPDATE] = sConfigMgr->GetIntDefault("Event.SpawnsPerMapUpdate", 200);
 
     m_float_configs[CONFIG_CREATURE_FAMILY_FLEE_ASSISTANCE_RADIUS] = sConfigMgr->GetFloatDefault("CreatureFamilyFleeAssistanceRadius", 30.0f);
     m_float_configs[CONFIG_CREATURE_FAMILY_ASSISTANCE_RADIUS] = sConfigMgr->GetFloatDefault("CreatureFamilyAssistanceRadius", 10.0f);
@@ -1100,6 +1110,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_GUILD_BANK_EVENT_LOG_COUNT] = sConfigMgr->GetIntDefault("Guild.BankEventLogRecordsCount", GUILD_BANKLOG_MAX_RECORDS);
     if (m_int_configs[CONFIG_GUILD_BANK_EVENT_LOG_COUNT] > GUILD_BANKLOG_MAX_RECORDS)
         m_int_configs[CONFIG_GUILD_BANK_EVENT_LOG_COUNT] = GUILD_BANKLOG_MAX_RECORDS;
+    m_int_configs[CONFIG_GUILD_LAZY_DATA_IDLE_TIME] = sConfigMgr->GetIntDefault("Guild.LazyDataIdleTime", 1800);
 
     //visibility on continents
     m_MaxVisibleDistanceOnContinents = sConfigMgr->GetFloatDefault("Visibility.Distance.Continents", DEFAULT_VISIBILITY_DISTANCE);
@@ -1144,11 +1155,27 @@ void World::LoadConfigSettings(bool reload)
     m_visibility_notify_periodInInstances = sConfigMgr->GetIntDefault("Visibility.Notify.Period.InInstances",   DEFAULT_VISIBILITY_NOTIFY_PERIOD);
     m_visibility_notify_periodInBGArenas = sConfigMgr->GetIntDefault("Visibility.Notify.Period.InBGArenas",    DEFAULT_VISIBILITY_NOTIFY_PERIOD);
 
+    m_float_configs[CONFIG_VISIBILITY_RELOCATION_LOWER_LIMIT] = sConfigMgr->GetFloatDefault("Visibility.RelocationLowerLimit", 0.0f);
+    if (m_float_configs[CONFIG_VISIBILITY_RELOCATION_LOWER_LIMIT] < 0.0f)
+    {
+        TC_LOG_ERROR("server.loading", "Visibility.RelocationLowerLimit (%f) can't be negative. Set to 0.", m_float_configs[CONFIG_VISIBILITY_RELOCATION_LOWER_LIMIT]);
+        m_float_configs[CONFIG_VISIBILITY_RELOCATION_LOWER_LIMIT] = 0.0f;
+    }
+
     ///- Load the CharDelete related config options
     m_int_configs[CONFIG_CHARDELETE_METHOD] = sConfigMgr->GetIntDefault("CharDelete.Method", 0);
     m_int_configs[CONFIG_CHARDELETE_MIN_LEVEL] = sConfigMgr->GetIntDefault("CharDelete.MinLevel", 0);
     m_int_configs[CONFIG_CHARDELETE_HEROIC_MIN_LEVEL] = sConfigMgr->GetIntDefault("CharDelete.Heroic.MinLevel", 0);
     m_int_configs[CONFIG_CHARDELETE_KEEP_DAYS] = sConfigMgr->GetIntDefault("CharDelete.KeepDays", 30);
+    m_int_configs[CONFIG_CALENDAR_ARCHIVE_DAYS] = sConfigMgr->GetIntDefault("Calendar.ArchiveAfterDays", 0);
+
+    m_int_configs[CONFIG_MAIL_EXPIRY_CHUNK_SIZE] = sConfigMgr->GetIntDefault("Mail.Expiry.ChunkSize", 1000);
+    if (m_int_configs[CONFIG_MAIL_EXPIRY_CHUNK_SIZE] == 0)
+    {
+        TC_LOG_ERROR("server.loading", "Mail.Expiry.ChunkSize (%u) must be greater than 0. Set to 1000.", m_int_configs[CONFIG_MAIL_EXPIRY_CHUNK_SIZE]);
+        m_int_configs[CONFIG_MAIL_EXPIRY_CHUNK_SIZE] = 1000;
+    }
+    m_int_configs[CONFIG_MAIL_EXPIRY_UPDATE_BUDGET] = sConfigMgr->GetIntDefault("Mail.Expiry.UpdateBudget", 5);
 
     // No aggro from gray mobs
     m_int_configs[CONFIG_NO_GRAY_AGGRO_ABOVE] = sConfigMgr->GetIntDefault("NoGrayAggro.Above", 0);
@@ -1201,6 +1228,7 @@ void World::LoadConfigSettings(bool reload)
     bool enableIndoor = sConfigMgr->GetBoolDefault("vmap.enableIndoorCheck", true);
     bool enableLOS = sConfigMgr->GetBoolDefault("vmap.enableLOS", true);
     bool enableHeight = sConfigMgr->GetBoolDefault("vmap.enableHeight", true);
+    m_int_configs[CONFIG_VMAP_LOS_CACHE_TIME] = sConfigMgr->GetIntDefault("vmap.lineOfSightCacheTime", 500);
 
     if (!enableHeight)
         TC_LOG_ERROR("server.loading", "VMap height checking disabled! Creatures movements and other various things WILL be broken! Expect no support.");
@@ -1233,6 +1261,7 @@ void World::LoadConfigSettings(bool reload)
     m_int_configs[CONFIG_INTERVAL_LOG_UPDATE] = sConfigMgr->GetIntDefault("RecordUpdateTimeDiffInterval", 60000);
     m_int_configs[CONFIG_MIN_LOG_UPDATE] = sConfigMgr->GetIntDefault("MinRecordUpdateTimeDiff", 100);
     m_int_configs[CONFIG_NUMTHREADS] = sConfigMgr->GetIntDefault("MapUpdate.Threads", 1);
+    m_int_configs[CONFIG_SESSION_UPDATE_THREADS] = sConfigMgr->GetIntDefault("SessionUpdate.Threads", 0);
     m_int_configs[CONFIG_MAX_RESULTS_LOOKUP_COMMANDS] = sConfigMgr->GetIntDefault("Command.LookupMaxResults", 0);
 
     // Warden
@@ -1284,6 +1313,14 @@ void World::LoadConfigSettings(bool reload)
     m_bool_configs[CONFIG_PDUMP_NO_PATHS] = sConfigMgr->GetBoolDefault("PlayerDump.DisallowPaths", true);
     m_bool_configs[CONFIG_PDUMP_NO_OVERWRITE] = sConfigMgr->GetBoolDefault("PlayerDump.DisallowOverwrite", true);
     m_bool_configs[CONFIG_UI_QUESTLEVELS_IN_DIALOGS] = sConfigMgr->GetBoolDefault("UI.ShowQuestLevelsInDialogs", false);
+    m_bool_configs[CONFIG_QUERY_RESPONSE_CACHE] = sConfigMgr->GetBoolDefault("Network.QueryResponseCache", true);
+
+    // kept by the database library, the query pools check it on every synchronous query
+    SynchronousQueryWatch::SetEnabled(sConfigMgr->GetBoolDefault("Database.LogSynchronousQueries", false));
+
+    Spell::GetAllocationStats().Enabled = sConfigMgr->GetBoolDefault("Debug.SpellAllocationStats", false);
+    sScriptMgr->SetHookCallCounting(sConfigMgr->GetBoolDefault("Debug.ScriptHookStats", false));
+    sAchievementMgr->SetCriteriaUpdateStatsEnabled(sConfigMgr->GetBoolDefault("Debug.AchievementCriteriaStats", false));
 
     // Wintergrasp battlefield
     m_bool_configs[CONFIG_WINTERGRASP_ENABLE] = sConfigMgr->GetBoolDefault("Wintergrasp.Enable", false);
@@ -1844,6 +1881,12 @@ void World::SetInitialWorldSettings()
     TC_LOG_INFO("server.loading", "Starting Map System");
     sMapMgr->Initialize();
 
+    if (uint32 sessionThreads = getIntConfig(CONFIG_SESSION_UPDATE_THREADS))
+    {
+        TC_LOG_INFO("server.loading", "Starting %u session update threads", sessionThreads);
+        m_sessionUpdater.activate(sessionThreads);
+    }
+
     TC_LOG_INFO("server.loading", "Starting Game Event system...");
     uint32 nextGameEvent = sGameEventMgr->StartSystem();
     m_timers[WUPDATE_EVENTS].SetInterval(nextGameEvent);    //depend on next event
@@ -2028,6 +2071,8 @@ void World::LoadAutobroadcasts()
 /// Update the World !
 void World::Update(uint32 diff)
 {
+    SynchronousQueryWatch::Scope queryWatchScope("world update");
+
     m_updateTime = diff;
 
     if (m_int_configs[CONFIG_INTERVAL_LOG_UPDATE] && diff > m_int_configs[CONFIG_MIN_LOG_UPDATE])
@@ -2161,6 +2206,9 @@ void World::Update(uint32 diff)
     sMapMgr->Update(diff);
     RecordTimeDiff("UpdateMapMgr");
 
+    sBattlefieldMgr->ProcessWorldTasks();
+    RecordTimeDiff("BattlefieldMgr");
+
     if (sWorld->getBoolConfig(CONFIG_AUTOBROADCAST))
     {
         if (m_timers[WUPDATE_AUTOBROADCAST].Passed())
@@ -2176,14 +2224,12 @@ void World::Update(uint32 diff)
     sOutdoorPvPMgr->Update(diff);
     RecordTimeDiff("UpdateOutdoorPvPMgr");
 
-    sBattlefieldMgr->Update(diff);
-    RecordTimeDiff("BattlefieldMgr");
-
     ///- Delete all characters which have been deleted X days before
     if (m_timers[WUPDATE_DELETECHARS].Passed())
     {
         m_timers[WUPDATE_DELETECHARS].Reset();
         Player::DeleteOldCharacters();
+        sCalendarMgr->ArchiveOldEvents();
     }
 
     sLFGMgr->Update(diff);
@@ -2193,6 +2239,13 @@ void World::Update(uint32 diff)
     ProcessQueryCallbacks();
     RecordTimeDiff("ProcessQueryCallbacks");
 
+    ///- Return or delete the expired mails fetched so far
+    sObjectMgr->UpdateExpiredMails();
+    RecordTimeDiff("UpdateExpiredMails");
+
+    sGuildMgr->Update(diff);
+    RecordTimeDiff("UpdateGuildMgr");
+
     ///- Erase corpses once every 20 minutes
     if (m_timers[WUPDATE_CORPSES].Passed())
     {
@@ -2741,6 +2794,17 @@ void World::UpdateSessions(uint32 diff)
     while (addSessQueue.next(sess))
         AddSession_ (sess);
 
+    ///- Handle the packets that do not depend on global ordering in parallel first, within the same packet budget
+    for (SessionMap::const_iterator itr = m_sessions.begin(); itr != m_sessions.end(); ++itr)
+    {
+        itr->second->ResetWorldPacketBudget();
+        if (m_sessionUpdater.activated())
+            m_sessionUpdater.schedule_update(*itr->second);
+    }
+
+    if (m_sessionUpdater.activated())
+        m_sessionUpdater.wait();
+
     ///- Then send an update signal to remaining ones
     for (SessionMap::iterator itr = m_sessions.begin(), next; itr != m_sessions.end(); itr = next)
     {
@@ -3168,6 +3232,9 @@ void World::LoadWorldStates()
 // Setting a worldstate will save it to DB
 void World::setWorldState(uint32 index, uint64 value)
 {
+    // battlefields update from their map thread
+    std::lock_guard<std::mutex> lock(m_worldStatesLock);
+
     WorldStatesMap::const_iterator it = m_worldstates.find(index);
     if (it != m_worldstates.end())
     {
@@ -3192,6 +3259,7 @@ void World::setWorldState(uint32 index, uint64 value)
 
 uint64 World::getWorldState(uint32 index) const
 {
+    std::lock_guard<std::mutex> lock(m_worldStatesLock);
     WorldStatesMap::const_iterator it = m_worldstates.find(index);
     return it != m_worldstates.end() ? it->second : 0;
 }
@@ -3249,6 +3317,7 @@ void World::LoadCharacterInfoStore()
     TC_LOG_INFO("server.loading", "Loading character info store");
 
     _characterInfoStore.clear();
+    _characterGuidByName.clear();
 
     QueryResult result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters");
     if (!result)
@@ -3270,6 +3339,12 @@ void World::LoadCharacterInfoStore()
 void World::AddCharacterInfo(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level)
 {
     CharacterInfo& data = _characterInfoStore[guid];
+    if (!data.Name.empty())
+        _characterGuidByName.erase(data.Name);
+
+    if (!name.empty())
+        _characterGuidByName[name] = guid;
+
     data.Name = name;
     data.AccountId = accountId;
     data.Race = race;
@@ -3284,6 +3359,10 @@ void World::UpdateCharacterInfo(ObjectGuid const& guid, std::string const& name,
     if (itr == _characterInfoStore.end())
         return;
 
+    _characterGuidByName.erase(itr->second.Name);
+    if (!name.empty())
+        _characterGuidByName[name] = guid;
+
     itr->second.Name = name;
 
     if (gender != GENDER_NONE)
@@ -3297,6 +3376,25 @@ void World::UpdateCharacterInfo(ObjectGuid const& guid, std::string const& name,
     SendGlobalMessage(&data);
 }
 
+void World::DeleteCharacterInfo(ObjectGuid const& guid)
+{
+    CharacterInfoContainer::iterator itr = _characterInfoStore.find(guid);
+    if (itr == _characterInfoStore.end())
+        return;
+
+    _characterGuidByName.erase(itr->second.Name);
+    _characterInfoStore.erase(itr);
+}
+
+ObjectGuid World::GetCharacterGuidByName(std::string const& name) const
+{
+    CharacterGuidByNameContainer::const_iterator itr = _characterGuidByName.find(name);
+    if (itr != _characterGuidByName.end())
+        return itr->second;
+
+    return ObjectGuid::Empty;
+}
+
 void World::UpdateCharacterInfoLevel(ObjectGuid const& guid, uint8 level)
 {
     CharacterInfoContainer::iterator itr = _characterInfoStore.find(guid);
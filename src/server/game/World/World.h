@@ -30,11 +30,13 @@
 #include "QueryResult.h"
 #include "Callback.h"
 #include "Realm/Realm.h"
+#include "SessionUpdater.h"
 
 #include <atomic>
 #include <map>
 #include <set>
 #include <list>
+#include <mutex>
 
 class Object;
 class WorldPacket;
@@ -133,6 +135,7 @@ enum WorldBoolConfigs
     CONFIG_ARENA_LOG_EXTENDED_INFO,
     CONFIG_OFFHAND_CHECK_AT_SPELL_UNLEARN,
     CONFIG_VMAP_INDOOR_CHECK,
+    CONFIG_GRID_PRELOAD,
     CONFIG_START_ALL_SPELLS,
     CONFIG_START_ALL_EXPLORED,
     CONFIG_START_ALL_REP,
@@ -167,6 +170,7 @@ enum WorldBoolConfigs
     CONFIG_RESET_DUEL_HEALTH_MANA,
     CONFIG_BASEMAP_LOAD_GRIDS,
     CONFIG_INSTANCEMAP_LOAD_GRIDS,
+    CONFIG_QUERY_RESPONSE_CACHE,
     BOOL_CONFIG_VALUE_COUNT
 };
 
@@ -191,6 +195,7 @@ enum WorldFloatConfigs
     CONFIG_ARENA_WIN_RATING_MODIFIER_2,
     CONFIG_ARENA_LOSE_RATING_MODIFIER,
     CONFIG_ARENA_MATCHMAKER_RATING_MODIFIER,
+    CONFIG_VISIBILITY_RELOCATION_LOWER_LIMIT,
     FLOAT_CONFIG_VALUE_COUNT
 };
 
@@ -306,15 +311,24 @@ enum WorldIntConfigs
     CONFIG_ENABLE_SINFO_LOGIN,
     CONFIG_PLAYER_ALLOW_COMMANDS,
     CONFIG_NUMTHREADS,
+    CONFIG_SESSION_UPDATE_THREADS,
     CONFIG_LOGDB_CLEARINTERVAL,
     CONFIG_LOGDB_CLEARTIME,
     CONFIG_CLIENTCACHE_VERSION,
     CONFIG_GUILD_EVENT_LOG_COUNT,
     CONFIG_GUILD_BANK_EVENT_LOG_COUNT,
+    CONFIG_GUILD_LAZY_DATA_IDLE_TIME,
+    CONFIG_VMAP_LOS_CACHE_TIME,
+    CONFIG_GRID_PRELOAD_LOOKAHEAD,
+    CONFIG_GAME_EVENT_SPAWNS_PER_UPDATE,
+    CONFIG_RESPAWN_JOURNAL_SAVE_INTERVAL,
     CONFIG_MIN_LEVEL_STAT_SAVE,
     CONFIG_RANDOM_BG_RESET_HOUR,
     CONFIG_GUILD_RESET_HOUR,
     CONFIG_CHARDELETE_KEEP_DAYS,
+    CONFIG_CALENDAR_ARCHIVE_DAYS,
+    CONFIG_MAIL_EXPIRY_CHUNK_SIZE,
+    CONFIG_MAIL_EXPIRY_UPDATE_BUDGET,
     CONFIG_CHARDELETE_METHOD,
     CONFIG_CHARDELETE_MIN_LEVEL,
     CONFIG_CHARDELETE_HEROIC_MIN_LEVEL,
@@ -750,7 +764,8 @@ class TC_GAME_API World
 
         CharacterInfo const* GetCharacterInfo(ObjectGuid const& guid) const;
         void AddCharacterInfo(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level);
-        void DeleteCharacterInfo(ObjectGuid const& guid) { _characterInfoStore.erase(guid); }
+        void DeleteCharacterInfo(ObjectGuid const& guid);
+        ObjectGuid GetCharacterGuidByName(std::string const& name) const;
         bool HasCharacterInfo(ObjectGuid const& guid) { return _characterInfoStore.find(guid) != _characterInfoStore.end(); }
         void UpdateCharacterInfo(ObjectGuid const& guid, std::string const& name, uint8 gender = GENDER_NONE, uint8 race = RACE_NONE);
         void UpdateCharacterInfoLevel(ObjectGuid const& guid, uint8 level);
@@ -816,6 +831,7 @@ class TC_GAME_API World
         float m_float_configs[FLOAT_CONFIG_VALUE_COUNT];
         typedef std::map<uint32, uint64> WorldStatesMap;
         WorldStatesMap m_worldstates;
+        mutable std::mutex m_worldStatesLock;
         uint32 m_playerLimit;
         AccountTypes m_allowedSecurityLevel;
         LocaleConstant m_defaultDbcLocale;                     // from config for one from loaded DBC locales
@@ -851,6 +867,9 @@ class TC_GAME_API World
         void AddSession_(WorldSession* s);
         LockedQueue<WorldSession*> addSessQueue;
 
+        // handles the packets of SessionUpdater::IsParallelOpcode before the ordered session update
+        SessionUpdater m_sessionUpdater;
+
         // used versions
         std::string m_DBVersion;
 
@@ -862,6 +881,8 @@ class TC_GAME_API World
 
         typedef std::unordered_map<ObjectGuid, CharacterInfo> CharacterInfoContainer;
         CharacterInfoContainer _characterInfoStore;
+        typedef std::unordered_map<std::string, ObjectGuid> CharacterGuidByNameContainer;
+        CharacterGuidByNameContainer _characterGuidByName;  // names of _characterInfoStore, deleted characters have none
         void LoadCharacterInfoStore();
 
         void ProcessQueryCallbacks();
@@ -34,6 +34,12 @@ EndScriptData */
 #include "Transport.h"
 #include "Language.h"
 #include "MapManager.h"
+#include "GridPreloader.h"
+#include "AchievementMgr.h"
+#include "Spell.h"
+#include "QueryResponseCache.h"
+#include "OpcodeStats.h"
+#include "Opcodes.h"
 
 #include <fstream>
 
@@ -94,7 +100,16 @@ public:
             { "transport",     rbac::RBAC_PERM_COMMAND_DEBUG_TRANSPORT,     false, &HandleDebugTransportCommand,        "" },
             { "loadcells",     rbac::RBAC_PERM_COMMAND_DEBUG_LOADCELLS,     false, &HandleDebugLoadCellsCommand,        "" },
             { "boundary",      rbac::RBAC_PERM_COMMAND_DEBUG_BOUNDARY,      false, &HandleDebugBoundaryCommand,         "" },
-            { "raidreset",     rbac::RBAC_PERM_COMMAND_INSTANCE_UNBIND,     false, &HandleDebugRaidResetCommand,        "" }
+            { "raidreset",     rbac::RBAC_PERM_COMMAND_INSTANCE_UNBIND,     false, &HandleDebugRaidResetCommand,        "" },
+            { "spellalloc",    rbac::RBAC_PERM_COMMAND_DEBUG_SPELLALLOC,    true,  &HandleDebugSpellAllocCommand,       "" },
+            { "gridload",      rbac::RBAC_PERM_COMMAND_DEBUG_GRIDLOAD,      true,  &HandleDebugGridLoadCommand,         "" },
+            { "achievementcriteria", rbac::RBAC_PERM_COMMAND_DEBUG_ACHIEVEMENTCRITERIA, true, &HandleDebugAchievementCriteriaCommand, "" },
+            { "bgupdate",      rbac::RBAC_PERM_COMMAND_DEBUG_BGUPDATE, true, &HandleDebugBgUpdateCommand, "" },
+            { "gameeventspawns", rbac::RBAC_PERM_COMMAND_DEBUG_GAMEEVENTSPAWNS, true, &HandleDebugGameEventSpawnsCommand, "" },
+            { "respawnqueue",  rbac::RBAC_PERM_COMMAND_DEBUG_RESPAWNQUEUE, true, &HandleDebugRespawnQueueCommand, "" },
+            { "querycache",    rbac::RBAC_PERM_COMMAND_DEBUG_QUERYCACHE, true, &HandleDebugQueryCacheCommand, "" },
+            { "opcodestats",   rbac::RBAC_PERM_COMMAND_DEBUG_OPCODESTATS, true, &HandleDebugOpcodeStatsCommand, "" },
+            { "mailexpiry",    rbac::RBAC_PERM_COMMAND_DEBUG_MAILEXPIRY, true, &HandleDebugMailExpiryCommand, "" }
         };
         static std::vector<ChatCommand> commandTable =
         {
@@ -1054,6 +1069,18 @@ public:
     {
         if (Unit* unit = handler->getSelectedUnit())
             handler->PSendSysMessage("Unit %s (GuidLow: %u) is %sin LoS", unit->GetName().c_str(), unit->GetGUID().GetCounter(), handler->GetSession()->GetPlayer()->IsWithinLOSInMap(unit) ? "" : "not ");
+
+        Map* map = handler->GetSession()->GetPlayer()->GetMap();
+        LineOfSightCache const& cache = map->GetLineOfSightCache();
+        uint64 checks = cache.GetHits() + cache.GetMisses();
+        handler->PSendSysMessage("LoS cache of this map: " UI64FMTD " hits, " UI64FMTD " misses (%.1f%% hit rate)",
+            cache.GetHits(), cache.GetMisses(), checks ? cache.GetHits() * 100.0 / checks : 0.0);
+
+        uint32 rebuilds;
+        uint64 rebuildTime;
+        map->GetGameObjectModelRebuildStats(rebuilds, rebuildTime);
+        handler->PSendSysMessage("Dynamic collision of this map: %d models, %u tree rebuilds taking " UI64FMTD " us (avg %u us)",
+            map->GetGameObjectModelCount(), rebuilds, rebuildTime, rebuilds ? uint32(rebuildTime / rebuilds) : 0);
         return true;
     }
 
@@ -1467,6 +1494,190 @@ public:
             sInstanceSaveMgr->ForceGlobalReset(mEntry->MapID, Difficulty(difficulty));
         return true;
     }
+
+    static bool HandleDebugSpellAllocCommand(ChatHandler* handler, char const* args)
+    {
+        SpellAllocationStats& stats = Spell::GetAllocationStats();
+        if (*args)
+        {
+            if (strcmp(args, "reset"))
+                return false;
+
+            stats.Reset();
+            handler->SendSysMessage("Spell allocation counters reset.");
+            return true;
+        }
+
+        if (!stats.Enabled)
+            handler->SendSysMessage("Spell allocations are not counted, enable Debug.SpellAllocationStats in worldserver.conf.");
+
+        uint64 spells = stats.Spells;
+        uint64 pooled = stats.PooledSpells;
+        handler->PSendSysMessage("Spells created: " UI64FMTD ", from pool: " UI64FMTD " (%.1f%%)",
+            spells, pooled, spells ? pooled * 100.0 / spells : 0.0);
+        handler->PSendSysMessage("Target list spills: " UI64FMTD ", script instances: " UI64FMTD ", execute logs: " UI64FMTD,
+            uint64(stats.TargetSpills), uint64(stats.Scripts), uint64(stats.ExecuteLogs));
+        handler->PSendSysMessage("Heap allocations on the spell path: " UI64FMTD " (%.2f per spell)",
+            stats.GetHeapAllocations(), spells ? double(stats.GetHeapAllocations()) / spells : 0.0);
+        return true;
+    }
+
+    static bool HandleDebugGridLoadCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        GridPreloadStats const& stats = sGridPreloader->GetStats();
+        handler->PSendSysMessage("Grid preloader %s: %u requested, %u loaded, %u used, %u expired, %u pending",
+            sGridPreloader->IsRunning() ? "running" : "stopped", uint32(stats.Requests), uint32(stats.Loaded),
+            uint32(stats.Taken), uint32(stats.Expired), sGridPreloader->GetPendingCount());
+
+        sMapMgr->DoForAllMaps([handler](Map* map)
+        {
+            if (!map->GetGridLoadCount())
+                return;
+
+            handler->PSendSysMessage("Map %u (instance %u): %u grid loads, %u ms stalled, avg %u ms, max %u ms",
+                map->GetId(), map->GetInstanceId(), map->GetGridLoadCount(), map->GetGridLoadStallTime(),
+                map->GetGridLoadStallTime() / map->GetGridLoadCount(), map->GetGridLoadMaxStall());
+        });
+        return true;
+    }
+
+    static bool HandleDebugAchievementCriteriaCommand(ChatHandler* handler, char const* args)
+    {
+        if (*args)
+        {
+            if (strcmp(args, "reset"))
+                return false;
+
+            sAchievementMgr->ResetCriteriaUpdateStats();
+            handler->SendSysMessage("Achievement criteria counters reset.");
+            return true;
+        }
+
+        if (!sAchievementMgr->IsCriteriaUpdateStatsEnabled())
+            handler->SendSysMessage("Achievement criteria updates are not counted, enable Debug.AchievementCriteriaStats in worldserver.conf.");
+
+        // busiest types first
+        std::vector<std::pair<uint64, uint32>> types;
+        for (uint32 type = 0; type < ACHIEVEMENT_CRITERIA_TYPE_TOTAL; ++type)
+            if (uint64 events = sAchievementMgr->GetCriteriaUpdateStats(AchievementCriteriaTypes(type)).Events)
+                types.emplace_back(events, type);
+
+        std::sort(types.begin(), types.end(), std::greater<std::pair<uint64, uint32>>());
+        if (types.size() > 15)
+            types.resize(15);
+
+        for (std::pair<uint64, uint32> const& type : types)
+        {
+            AchievementCriteriaUpdateStats const& stats = sAchievementMgr->GetCriteriaUpdateStats(AchievementCriteriaTypes(type.second));
+            uint64 evaluated = stats.Evaluated;
+            handler->PSendSysMessage("%s (%u): " UI64FMTD " events, " UI64FMTD " criteria evaluated (%.2f per event), " UI64FMTD " skipped as completed",
+                AchievementGlobalMgr::GetCriteriaTypeString(type.second), type.second, type.first, evaluated, double(evaluated) / type.first,
+                uint64(stats.SkippedCompleted));
+        }
+
+        return true;
+    }
+
+    static bool HandleDebugBgUpdateCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        uint32 count = 0;
+        sBattlegroundMgr->DoForAllBattlegrounds([handler, &count](Battleground* bg)
+        {
+            ++count;
+            uint32 updates = bg->GetUpdateCount();
+            handler->PSendSysMessage("%s (map %u, instance %u): %u updates, avg %u us, max %u us",
+                bg->GetName().c_str(), bg->GetMapId(), bg->GetInstanceID(), updates,
+                updates ? uint32(bg->GetUpdateTimeTotal() / updates) : 0, bg->GetUpdateTimeMax());
+        });
+
+        if (!count)
+            handler->SendSysMessage("No running battlegrounds.");
+        return true;
+    }
+
+    static bool HandleDebugGameEventSpawnsCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        sMapMgr->DoForAllMaps([handler](Map* map)
+        {
+            uint32 pending = map->GetPendingGameEventSpawnCount();
+            if (!pending && !map->GetGameEventSpawnsApplied() && !map->GetGameEventSpawnsSkipped())
+                return;
+
+            handler->PSendSysMessage("Map %u (instance %u): %u pending, %u applied, %u skipped, %u updates over budget",
+                map->GetId(), map->GetInstanceId(), pending, map->GetGameEventSpawnsApplied(),
+                map->GetGameEventSpawnsSkipped(), map->GetGameEventSpawnStalls());
+        });
+        return true;
+    }
+
+    static bool HandleDebugRespawnQueueCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        sMapMgr->DoForAllMaps([handler](Map* map)
+        {
+            if (!map->GetRespawnQueueSize() && !map->GetRespawnsWokenTotal())
+                return;
+
+            handler->PSendSysMessage("Map %u (instance %u): %u queued, last update %u woken and %u polled, " UI64FMTD " woken in total",
+                map->GetId(), map->GetInstanceId(), map->GetRespawnQueueSize(), map->GetLastRespawnsWoken(),
+                map->GetLastRespawnsPolled(), map->GetRespawnsWokenTotal());
+        });
+        return true;
+    }
+
+    static bool HandleDebugQueryCacheCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        if (!sWorld->getBoolConfig(CONFIG_QUERY_RESPONSE_CACHE))
+            handler->SendSysMessage("Query response cache is disabled.");
+
+        for (uint8 i = 0; i < MAX_QUERY_RESPONSE_TYPES; ++i)
+        {
+            QueryResponseType type = QueryResponseType(i);
+            uint64 hits = sQueryResponseCache->GetHits(type);
+            uint64 misses = sQueryResponseCache->GetMisses(type);
+            float hitRate = hits + misses ? float(hits) * 100.0f / float(hits + misses) : 0.0f;
+
+            handler->PSendSysMessage("%s queries: %u responses cached, " UI64FMTD " hits, " UI64FMTD " misses (%.1f%% hit rate)",
+                QueryResponseCache::GetResponseTypeName(type), sQueryResponseCache->GetSize(type), hits, misses, hitRate);
+        }
+        return true;
+    }
+
+    static bool HandleDebugOpcodeStatsCommand(ChatHandler* handler, char const* args)
+    {
+        if (*args && strncmp(args, "reset", strlen(args)) == 0)
+        {
+            OpcodeStats::Reset();
+            handler->SendSysMessage("Opcode statistics have been reset.");
+            return true;
+        }
+
+        std::vector<OpcodeStats::Entry> entries = OpcodeStats::GetTop(20);
+        if (entries.empty())
+            handler->SendSysMessage("No opcodes have been handled yet.");
+
+        for (OpcodeStats::Entry const& entry : entries)
+            handler->PSendSysMessage("%s: " UI64FMTD " calls, " UI64FMTD " us total, " UI64FMTD " us avg, %u us max",
+                GetOpcodeNameForLogging(entry.Opcode).c_str(), entry.Count, entry.TotalTime, entry.TotalTime / entry.Count, entry.MaxTime);
+        return true;
+    }
+
+    static bool HandleDebugMailExpiryCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        MailExpiryProgress const& progress = sObjectMgr->GetMailExpiryProgress();
+        if (!progress.StartTime)
+        {
+            handler->SendSysMessage("Expired mails have not been processed since startup.");
+            return true;
+        }
+
+        if (progress.Running)
+            handler->PSendSysMessage("Expired mail job running for %u ms, fetched %u chunks up to mail id %u.", GetMSTimeDiffToNow(progress.StartTime), progress.Chunks, progress.LastMailId);
+        else
+            handler->PSendSysMessage("Last expired mail job finished in %u ms, fetched %u chunks up to mail id %u.", progress.Duration, progress.Chunks, progress.LastMailId);
+
+        handler->PSendSysMessage("Returned: %u, deleted: %u, skipped: %u", progress.Returned, progress.Deleted, progress.Skipped);
+        return true;
+    }
 };
 
 void AddSC_debug_commandscript()
@@ -45,6 +45,7 @@ public:
             { "rank",     rbac::RBAC_PERM_COMMAND_GUILD_RANK,     true, &HandleGuildRankCommand,             "" },
             { "rename",   rbac::RBAC_PERM_COMMAND_GUILD_RENAME,   true, &HandleGuildRenameCommand,           "" },
             { "info",     rbac::RBAC_PERM_COMMAND_GUILD_INFO,     true, &HandleGuildInfoCommand,             "" },
+            { "stats",    rbac::RBAC_PERM_COMMAND_GUILD_STATS,    true, &HandleGuildStatsCommand,            "" },
         };
         static std::vector<ChatCommand> commandTable =
         {
@@ -286,6 +287,24 @@ public:
         handler->PSendSysMessage(LANG_GUILD_INFO_EXTRA_INFO, guild->GetInfo().c_str()); // Extra Information
         return true;
     }
+
+    static bool HandleGuildStatsCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        static char const* const dataNames[GUILD_LAZY_MAX] = { "Event logs", "Bank logs", "Bank items" };
+
+        uint32 guildCount = sGuildMgr->GetGuildCount();
+        handler->PSendSysMessage("Guilds: %u, pending loads: %u, bank items in memory: %u",
+            guildCount, sGuildMgr->GetLazyDataPendingCount(), sGuildMgr->GetBankItemCount());
+
+        for (uint8 i = 0; i < GUILD_LAZY_MAX; ++i)
+        {
+            GuildLazyDataStats const& stats = sGuildMgr->GetLazyDataStats(GuildLazyData(i));
+            handler->PSendSysMessage("%s: loaded for %u/%u guilds, requests: %u, loads: %u (avg %u ms, max %u ms), unloads: %u",
+                dataNames[i], sGuildMgr->GetLazyDataLoadedCount(GuildLazyData(i)), guildCount, stats.Requests, stats.Loads,
+                stats.Loads ? uint32(stats.LoadTime / stats.Loads) : 0, stats.MaxLoadTime, stats.Unloads);
+        }
+        return true;
+    }
 };
 
 void AddSC_guild_commandscript()
@@ -33,6 +33,7 @@ EndScriptData */
 #include "LFGMgr.h"
 #include "MapManager.h"
 #include "ObjectMgr.h"
+#include "QueryResponseCache.h"
 #include "ScriptMgr.h"
 #include "SkillDiscovery.h"
 #include "SkillExtraItems.h"
@@ -322,6 +323,8 @@ public:
         TC_LOG_INFO("misc", "Re-Loading config settings...");
         sWorld->LoadConfigSettings(true);
         sMapMgr->InitializeVisibilityDistanceInfo();
+        // cached quest responses depend on UI.ShowQuestLevelsInDialogs
+        sQueryResponseCache->InvalidateAll();
         handler->SendGlobalGMSysMessage("World config settings reloaded.");
         return true;
     }
@@ -449,6 +452,8 @@ public:
             sObjectMgr->CheckCreatureTemplate(cInfo);
         }
 
+        sQueryResponseCache->Invalidate(QUERY_RESPONSE_CREATURE);
+
         handler->SendGlobalGMSysMessage("Creature template reloaded.");
         return true;
     }
@@ -22,6 +22,7 @@ Comment: All server related commands
 Category: commandscripts
 EndScriptData */
 
+#include "AccountMgr.h"
 #include "Chat.h"
 #include "Config.h"
 #include "Language.h"
@@ -29,6 +30,7 @@ EndScriptData */
 #include "Player.h"
 #include "ScriptMgr.h"
 #include "GitRevision.h"
+#include "PacketLog.h"
 
 class server_commandscript : public CommandScript
 {
@@ -69,6 +71,27 @@ public:
             { "closed",   rbac::RBAC_PERM_COMMAND_SERVER_SET_CLOSED,   true, &HandleServerSetClosedCommand,   "" },
         };
 
+        static std::vector<ChatCommand> serverPacketLogFilterCommandTable =
+        {
+            { "account", rbac::RBAC_PERM_COMMAND_SERVER_PACKETLOG_FILTER_ACCOUNT, true, &HandleServerPacketLogFilterAccountCommand, "" },
+            { "address", rbac::RBAC_PERM_COMMAND_SERVER_PACKETLOG_FILTER_ADDRESS, true, &HandleServerPacketLogFilterAddressCommand, "" },
+            { "clear",   rbac::RBAC_PERM_COMMAND_SERVER_PACKETLOG_FILTER_CLEAR,   true, &HandleServerPacketLogFilterClearCommand,   "" },
+        };
+
+        static std::vector<ChatCommand> serverPacketLogCommandTable =
+        {
+            { "status", rbac::RBAC_PERM_COMMAND_SERVER_PACKETLOG_STATUS, true, &HandleServerPacketLogStatusCommand, "" },
+            { "start",  rbac::RBAC_PERM_COMMAND_SERVER_PACKETLOG_START,  true, &HandleServerPacketLogStartCommand,  "" },
+            { "stop",   rbac::RBAC_PERM_COMMAND_SERVER_PACKETLOG_STOP,   true, &HandleServerPacketLogStopCommand,   "" },
+            { "filter", rbac::RBAC_PERM_COMMAND_SERVER_PACKETLOG_FILTER, true, NULL,                                "", serverPacketLogFilterCommandTable },
+        };
+
+        static std::vector<ChatCommand> serverScriptHooksCommandTable =
+        {
+            { "reset", rbac::RBAC_PERM_COMMAND_SERVER_SCRIPTHOOKS_RESET, true, &HandleServerScriptHooksResetCommand, "" },
+            { "",      rbac::RBAC_PERM_COMMAND_SERVER_SCRIPTHOOKS,       true, &HandleServerScriptHooksCommand,      "" },
+        };
+
         static std::vector<ChatCommand> serverCommandTable =
         {
             { "corpses",      rbac::RBAC_PERM_COMMAND_SERVER_CORPSES,      true, &HandleServerCorpsesCommand, "" },
@@ -77,8 +100,10 @@ public:
             { "idleshutdown", rbac::RBAC_PERM_COMMAND_SERVER_IDLESHUTDOWN, true, NULL,                        "", serverIdleShutdownCommandTable },
             { "info",         rbac::RBAC_PERM_COMMAND_SERVER_INFO,         true, &HandleServerInfoCommand,    "" },
             { "motd",         rbac::RBAC_PERM_COMMAND_SERVER_MOTD,         true, &HandleServerMotdCommand,    "" },
+            { "packetlog",    rbac::RBAC_PERM_COMMAND_SERVER_PACKETLOG,    true, NULL,                        "", serverPacketLogCommandTable },
             { "plimit",       rbac::RBAC_PERM_COMMAND_SERVER_PLIMIT,       true, &HandleServerPLimitCommand,  "" },
             { "restart",      rbac::RBAC_PERM_COMMAND_SERVER_RESTART,      true, NULL,                        "", serverRestartCommandTable },
+            { "scripthooks",  rbac::RBAC_PERM_COMMAND_SERVER_SCRIPTHOOKS,  true, NULL,                        "", serverScriptHooksCommandTable },
             { "shutdown",     rbac::RBAC_PERM_COMMAND_SERVER_SHUTDOWN,     true, NULL,                        "", serverShutdownCommandTable },
             { "set",          rbac::RBAC_PERM_COMMAND_SERVER_SET,          true, NULL,                        "", serverSetCommandTable },
         };
@@ -286,6 +311,151 @@ public:
         return true;
     }
 
+    static bool HandleServerPacketLogStatusCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        if (!sPacketLog->IsAvailable())
+        {
+            handler->SendSysMessage("Packet log is not configured (PacketLogFile is empty).");
+            return true;
+        }
+
+        PacketLogStatistics stats = sPacketLog->GetStatistics();
+        handler->PSendSysMessage("Packet log is %s, %u producer threads, %u segments written.",
+            sPacketLog->CanLogPacket() ? "running" : "stopped", stats.ProducerThreads, stats.Segments);
+        handler->PSendSysMessage("Packets: " UI64FMTD " captured (" UI64FMTD " bytes), " UI64FMTD " dropped, " UI64FMTD " filtered, " UI64FMTD " bytes written.",
+            stats.Packets, stats.Bytes, stats.Dropped, stats.Filtered, stats.WrittenBytes);
+
+        uint64 handled = stats.Packets + stats.Dropped + stats.Filtered;
+        handler->PSendSysMessage("Producer overhead: " UI64FMTD " ns total, " UI64FMTD " ns per packet.",
+            stats.ProducerNanoseconds, handled ? stats.ProducerNanoseconds / handled : UI64LIT(0));
+
+        PacketLogFilter filter = sPacketLog->GetFilter();
+        if (filter.IsEmpty())
+            handler->SendSysMessage("Filter: none, all packets are captured.");
+        else
+        {
+            std::ostringstream accounts, addresses;
+            for (uint32 accountId : filter.Accounts)
+                accounts << accountId << ' ';
+            for (std::string const& address : filter.Addresses)
+                addresses << address << ' ';
+
+            handler->PSendSysMessage("Filter accounts: %s", accounts.str().c_str());
+            handler->PSendSysMessage("Filter addresses: %s", addresses.str().c_str());
+        }
+
+        return true;
+    }
+
+    static bool HandleServerPacketLogStartCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        if (!sPacketLog->SetActive(true))
+        {
+            handler->SendSysMessage("Packet log is not configured (PacketLogFile is empty).");
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        handler->SendSysMessage("Packet log started.");
+        return true;
+    }
+
+    static bool HandleServerPacketLogStopCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        if (!sPacketLog->SetActive(false))
+        {
+            handler->SendSysMessage("Packet log is not configured (PacketLogFile is empty).");
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        handler->SendSysMessage("Packet log stopped.");
+        return true;
+    }
+
+    static bool HandleServerPacketLogFilterAccountCommand(ChatHandler* handler, char const* args)
+    {
+        if (!*args)
+            return false;
+
+        uint32 accountId = uint32(atoul(args));
+        if (!accountId)
+        {
+            std::string accountName = args;
+            if (!Utf8ToUpperOnlyLatin(accountName))
+                return false;
+
+            accountId = AccountMgr::GetId(accountName);
+        }
+
+        if (!accountId)
+        {
+            handler->PSendSysMessage(LANG_ACCOUNT_NOT_EXIST, args);
+            handler->SetSentErrorMessage(true);
+            return false;
+        }
+
+        sPacketLog->AddAccountFilter(accountId);
+        handler->PSendSysMessage("Packet log now captures account %u.", accountId);
+        return true;
+    }
+
+    static bool HandleServerPacketLogFilterAddressCommand(ChatHandler* handler, char const* args)
+    {
+        if (!*args)
+            return false;
+
+        boost::system::error_code error;
+        boost::asio::ip::address address = boost::asio::ip::address::from_string(args, error);
+        if (error)
+            return false;
+
+        sPacketLog->AddAddressFilter(address.to_string());
+        handler->PSendSysMessage("Packet log now captures address %s.", address.to_string().c_str());
+        return true;
+    }
+
+    static bool HandleServerPacketLogFilterClearCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        sPacketLog->ClearFilters();
+        handler->SendSysMessage("Packet log filter cleared, all packets are captured.");
+        return true;
+    }
+
+    // Show how often every script hook was called and how many scripts implement it
+    static bool HandleServerScriptHooksCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        if (!sScriptMgr->IsHookCallCounting())
+            handler->SendSysMessage("Script hook calls are not counted, enable Debug.ScriptHookStats in worldserver.conf.");
+
+        std::vector<ScriptHookProfile> profile = sScriptMgr->GetHookProfile();
+        std::sort(profile.begin(), profile.end(), [](ScriptHookProfile const& left, ScriptHookProfile const& right)
+        {
+            return left.Calls > right.Calls;
+        });
+
+        uint64 totalCalls = 0;
+        uint64 dispatchedCalls = 0;
+        for (ScriptHookProfile const& hook : profile)
+        {
+            totalCalls += hook.Calls;
+            if (hook.Subscribers)
+                dispatchedCalls += hook.Calls;
+
+            handler->PSendSysMessage("%s: " UI64FMTD " calls, %u of %u scripts subscribed", hook.Name.c_str(), hook.Calls, hook.Subscribers, hook.Scripts);
+        }
+
+        handler->PSendSysMessage("%u hooks, " UI64FMTD " calls, " UI64FMTD " calls on hooks with subscribers.", uint32(profile.size()), totalCalls, dispatchedCalls);
+        return true;
+    }
+
+    static bool HandleServerScriptHooksResetCommand(ChatHandler* handler, char const* /*args*/)
+    {
+        sScriptMgr->ResetHookProfile();
+        handler->SendSysMessage("Script hook call counters reset.");
+        return true;
+    }
+
 private:
     static bool ParseExitCode(char const* exitCodeStr, int32& exitCode)
     {
@@ -45,7 +45,10 @@ enum IPLoggingTypes
 class AccountActionIpLogger : public AccountScript
 {
     public:
-        AccountActionIpLogger() : AccountScript("AccountActionIpLogger") { }
+        AccountActionIpLogger() : AccountScript("AccountActionIpLogger")
+        {
+            RegisterHooks({ "OnAccountLogin", "OnFailedAccountLogin", "OnPasswordChange", "OnFailedPasswordChange", "OnEmailChange", "OnFailedEmailChange" });
+        }
 
         // We log last_ip instead of last_attempt_ip, as login was successful
         // ACCOUNT_LOGIN = 0
@@ -165,7 +168,10 @@ class AccountActionIpLogger : public AccountScript
 class CharacterActionIpLogger : public PlayerScript
 {
     public:
-        CharacterActionIpLogger() : PlayerScript("CharacterActionIpLogger") { }
+        CharacterActionIpLogger() : PlayerScript("CharacterActionIpLogger")
+        {
+            RegisterHooks({ "OnPlayerCreate", "OnPlayerLogin", "OnPlayerLogout" });
+        }
 
         // CHARACTER_CREATE = 7
         void OnCreate(Player* player) override
@@ -249,7 +255,10 @@ class CharacterActionIpLogger : public PlayerScript
 class CharacterDeleteActionIpLogger : public PlayerScript
 {
 public:
-    CharacterDeleteActionIpLogger() : PlayerScript("CharacterDeleteActionIpLogger") { }
+    CharacterDeleteActionIpLogger() : PlayerScript("CharacterDeleteActionIpLogger")
+    {
+        RegisterHooks({ "OnPlayerDelete", "OnPlayerFailedDelete" });
+    }
 
     // CHARACTER_DELETE = 10
     void OnDelete(ObjectGuid guid, uint32 accountId) override
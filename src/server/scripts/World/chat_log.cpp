@@ -23,7 +23,10 @@
 class ChatLogScript : public PlayerScript
 {
     public:
-        ChatLogScript() : PlayerScript("ChatLogScript") { }
+        ChatLogScript() : PlayerScript("ChatLogScript")
+        {
+            RegisterHooks({ "OnPlayerChat", "OnPlayerWhisper", "OnPlayerGroupChat", "OnPlayerGuildChat", "OnPlayerChannelChat" });
+        }
 
         void OnChat(Player* player, uint32 type, uint32 lang, std::string& msg) override
         {
@@ -23,7 +23,10 @@
 class DuelResetScript : public PlayerScript
 {
     public:
-        DuelResetScript() : PlayerScript("DuelResetScript") { }
+        DuelResetScript() : PlayerScript("DuelResetScript")
+        {
+            RegisterHooks({ "OnPlayerDuelStart", "OnPlayerDuelEnd" });
+        }
 
         // Called when a duel starts (after 3s countdown)
         void OnDuelStart(Player* player1, Player* player2) override
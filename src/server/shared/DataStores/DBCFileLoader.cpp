@@ -23,67 +23,51 @@
 #include "DBCFileLoader.h"
 #include "Errors.h"
 
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
 DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(NULL), data(NULL), stringTable(NULL) { }
 
 bool DBCFileLoader::Load(const char* filename, const char* fmt)
 {
-    uint32 header;
-    if (data)
-    {
-        delete [] data;
-        data = NULL;
-    }
-
-    FILE* f = fopen(filename, "rb");
-    if (!f)
-        return false;
-
-    if (fread(&header, 4, 1, f) != 1)                        // Number of records
-    {
-        fclose(f);
-        return false;
-    }
-
-
-    EndianConvert(header);
+    data = NULL;
+    mapping.reset();
+    delete[] fieldsOffset;
+    fieldsOffset = NULL;
 
-    if (header != 0x43424457)                                //'WDBC'
+    // Copy on write: pages stay shared with the page cache until a store patches one of its records
+    try
     {
-        fclose(f);
-        return false;
+        boost::interprocess::file_mapping file(filename, boost::interprocess::read_only);
+        mapping.reset(new boost::interprocess::mapped_region(file, boost::interprocess::copy_on_write));
     }
-
-    if (fread(&recordCount, 4, 1, f) != 1)                   // Number of records
+    catch (boost::interprocess::interprocess_exception const&)
     {
-        fclose(f);
+        mapping.reset();
         return false;
     }
 
-    EndianConvert(recordCount);
+    unsigned char* file = static_cast<unsigned char*>(mapping->get_address());
+    size_t fileSize = mapping->get_size();
 
-    if (fread(&fieldCount, 4, 1, f) != 1)                    // Number of fields
-    {
-        fclose(f);
+    uint32 header[5];
+    if (fileSize < sizeof(header))
         return false;
-    }
 
-    EndianConvert(fieldCount);
+    memcpy(header, file, sizeof(header));
+    for (uint32 i = 0; i < 5; ++i)
+        EndianConvert(header[i]);
 
-    if (fread(&recordSize, 4, 1, f) != 1)                    // Size of a record
-    {
-        fclose(f);
+    if (header[0] != 0x43424457)                             //'WDBC'
         return false;
-    }
 
-    EndianConvert(recordSize);
+    recordCount = header[1];                                 // Number of records
+    fieldCount = header[2];                                  // Number of fields
+    recordSize = header[3];                                  // Size of a record
+    stringSize = header[4];                                  // String size
 
-    if (fread(&stringSize, 4, 1, f) != 1)                    // String size
-    {
-        fclose(f);
+    if (!fieldCount || fileSize < sizeof(header) + size_t(recordSize) * recordCount + stringSize)
         return false;
-    }
-
-    EndianConvert(stringSize);
 
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
@@ -96,27 +80,22 @@ bool DBCFileLoader::Load(const char* filename, const char* fmt)
             fieldsOffset[i] += sizeof(uint32);
     }
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
+    data = file + sizeof(header);
     stringTable = data + recordSize*recordCount;
 
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
-    {
-        fclose(f);
-        return false;
-    }
-
-    fclose(f);
-
     return true;
 }
 
 DBCFileLoader::~DBCFileLoader()
 {
-    delete[] data;
-
     delete[] fieldsOffset;
 }
 
+size_t DBCFileLoader::GetMappedSize() const
+{
+    return mapping ? mapping->get_size() : 0;
+}
+
 DBCFileLoader::Record DBCFileLoader::getRecord(size_t id)
 {
     assert(data);
@@ -168,6 +147,65 @@ uint32 DBCFileLoader::GetFormatRecordSize(const char* format, int32* index_pos)
     return recordsize;
 }
 
+bool DBCFileLoader::CanUseInPlace(const char* format) const
+{
+#if TRINITY_ENDIAN == TRINITY_BIGENDIAN
+    (void)format;
+    return false;
+#else
+    if (strlen(format) != fieldCount || recordSize != fieldCount * sizeof(uint32))
+        return false;
+
+    for (uint32 x = 0; x < fieldCount; ++x)
+        if (format[x] != FT_IND && format[x] != FT_INT && format[x] != FT_FLOAT)
+            return false;
+
+    return true;
+#endif
+}
+
+char* DBCFileLoader::ProduceInPlaceData(const char* format, uint32& records, char**& indexTable)
+{
+    typedef char* ptr;
+    if (!CanUseInPlace(format))
+        return NULL;
+
+    int32 i;
+    GetFormatRecordSize(format, &i);
+
+    if (i >= 0)
+    {
+        uint32 maxi = 0;
+        for (uint32 y = 0; y < recordCount; ++y)
+        {
+            uint32 ind = getRecord(y).getUInt(i);
+            if (ind > maxi)
+                maxi = ind;
+        }
+
+        ++maxi;
+        records = maxi;
+        indexTable = new ptr[maxi];
+        memset(indexTable, 0, maxi * sizeof(ptr));
+    }
+    else
+    {
+        records = recordCount;
+        indexTable = new ptr[recordCount];
+    }
+
+    for (uint32 y = 0; y < recordCount; ++y)
+    {
+        char* record = reinterpret_cast<char*>(data + y * recordSize);
+        if (i >= 0)
+            indexTable[getRecord(y).getUInt(i)] = record;
+        else
+            indexTable[y] = record;
+    }
+
+    return reinterpret_cast<char*>(data);
+}
+
 char* DBCFileLoader::AutoProduceData(const char* format, uint32& records, char**& indexTable, uint32 sqlRecordCount, uint32 sqlHighestIndex, char*& sqlDataTable)
 {
     /*
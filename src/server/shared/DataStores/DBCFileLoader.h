@@ -21,6 +21,15 @@
 #include "Define.h"
 #include "Utilities/ByteConverter.h"
 #include <cassert>
+#include <memory>
+
+namespace boost
+{
+    namespace interprocess
+    {
+        class mapped_region;
+    }
+}
 
 enum DbcFieldFormat
 {
@@ -93,11 +102,19 @@ class TC_SHARED_API DBCFileLoader
         uint32 GetRowSize() const { return recordSize; }
         uint32 GetCols() const { return fieldCount; }
         uint32 GetOffset(size_t id) const { return (fieldsOffset != NULL && id < fieldCount) ? fieldsOffset[id] : 0; }
+        uint32 GetStringSize() const { return stringSize; }
+        size_t GetMappedSize() const;
         bool IsLoaded() const { return data != NULL; }
         char* AutoProduceData(const char* fmt, uint32& count, char**& indexTable, uint32 sqlRecordCount, uint32 sqlHighestIndex, char *& sqlDataTable);
         char* AutoProduceStrings(const char* fmt, char* dataTable);
         static uint32 GetFormatRecordSize(const char * format, int32 * index_pos = NULL);
+
+        // Records of formats made only of 4 byte numeric fields have the same layout in memory and on disk
+        bool CanUseInPlace(const char* fmt) const;
+        // Builds the index table over the mapped records, returns the first record
+        char* ProduceInPlaceData(const char* fmt, uint32& count, char**& indexTable);
     private:
+        std::unique_ptr<boost::interprocess::mapped_region> mapping;
 
         uint32 recordSize;
         uint32 recordCount;
@@ -75,7 +75,7 @@ class DBCStorage
     typedef std::list<char*> StringPoolList;
     public:
         explicit DBCStorage(char const* f)
-            : fmt(f), nCount(0), fieldCount(0), dataTable(NULL)
+            : fmt(f), nCount(0), fieldCount(0), dataTable(NULL), allocatedSize(0)
         {
             indexTable.asT = NULL;
         }
@@ -97,10 +97,13 @@ class DBCStorage
         uint32  GetNumRows() const { return nCount; }
         char const* GetFormat() const { return fmt; }
         uint32 GetFieldCount() const { return fieldCount; }
+        size_t GetAllocatedSize() const { return allocatedSize; }
+        bool IsMappedInPlace() const { return mappedFile != nullptr; }
 
         bool Load(char const* fn, SqlDbc* sql)
         {
-            DBCFileLoader dbc;
+            std::unique_ptr<DBCFileLoader> file(new DBCFileLoader());
+            DBCFileLoader& dbc = *file;
             // Check if load was sucessful, only then continue
             if (!dbc.Load(fn, fmt))
                 return false;
@@ -140,10 +143,20 @@ class DBCStorage
             char* sqlDataTable = NULL;
             fieldCount = dbc.GetCols();
 
+            // Nothing to convert, keep the file mapped and point the index straight at its records
+            if (!result && dbc.CanUseInPlace(fmt))
+            {
+                dataTable = reinterpret_cast<T*>(dbc.ProduceInPlaceData(fmt, nCount, indexTable.asChar));
+                allocatedSize = nCount * sizeof(T*);
+                mappedFile = std::move(file);
+                return indexTable.asT != NULL;
+            }
+
             dataTable = reinterpret_cast<T*>(dbc.AutoProduceData(fmt, nCount, indexTable.asChar,
                 sqlRecordCount, sqlHighestIndex, sqlDataTable));
 
             stringPoolList.push_back(dbc.AutoProduceStrings(fmt, reinterpret_cast<char*>(dataTable)));
+            allocatedSize = nCount * sizeof(T*) + (dbc.GetNumRows() + sqlRecordCount) * sizeof(T) + dbc.GetStringSize();
 
             // Insert sql data into arrays
             if (result)
@@ -259,12 +272,17 @@ class DBCStorage
             if (!indexTable.asT)
                 return false;
 
+            // Stores used in place have no string fields
+            if (mappedFile)
+                return true;
+
             DBCFileLoader dbc;
             // Check if load was successful, only then continue
             if (!dbc.Load(fn, fmt))
                 return false;
 
             stringPoolList.push_back(dbc.AutoProduceStrings(fmt, reinterpret_cast<char*>(dataTable)));
+            allocatedSize += dbc.GetStringSize();
 
             return true;
         }
@@ -276,7 +294,10 @@ class DBCStorage
 
             delete[] reinterpret_cast<char*>(indexTable.asT);
             indexTable.asT = NULL;
-            delete[] reinterpret_cast<char*>(dataTable);
+            if (mappedFile)
+                mappedFile.reset();
+            else
+                delete[] reinterpret_cast<char*>(dataTable);
             dataTable = NULL;
 
             while (!stringPoolList.empty())
@@ -286,6 +307,7 @@ class DBCStorage
             }
 
             nCount = 0;
+            allocatedSize = 0;
         }
 
     private:
@@ -302,6 +324,8 @@ class DBCStorage
 
         T* dataTable;
         StringPoolList stringPoolList;
+        std::unique_ptr<DBCFileLoader> mappedFile;          // set when records are used straight from the mapped file
+        size_t allocatedSize;
 
         DBCStorage(DBCStorage const& right) = delete;
         DBCStorage& operator=(DBCStorage const& right) = delete;
@@ -121,8 +121,8 @@ extern int main(int argc, char** argv)
     }
 
     sLog->RegisterAppender<AppenderDB>();
-    // If logs are supposed to be handled async then we need to pass the io_service into the Log singleton
-    sLog->Initialize(sConfigMgr->GetBoolDefault("Log.Async.Enable", false) ? &_ioService : nullptr);
+    // With Log.Async.Enable messages are queued and written by the log's own batching writer thread
+    sLog->Initialize(sConfigMgr->GetBoolDefault("Log.Async.Enable", false));
 
     TC_LOG_INFO("server.worldserver", "%s (worldserver-daemon)", GitRevision::GetFullVersion());
     TC_LOG_INFO("server.worldserver", "<Ctrl-C> to stop.\n");
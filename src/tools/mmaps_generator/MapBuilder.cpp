@@ -22,6 +22,8 @@
 #include "DetourNavMeshBuilder.h"
 #include "DetourNavMesh.h"
 #include "IntermediateValues.h"
+#include "SHA1.h"
+#include "Util.h"
 
 #include <limits.h>
 
@@ -40,18 +42,41 @@ struct MmapTileHeader
         mmapVersion(MMAP_VERSION), size(0), usesLiquids(true) {}
 };
 
+namespace
+{
+    // the name is hashed as well, so moving data between files or removing a file changes the hash
+    void HashFile(SHA1Hash& sha, std::string const& fileName)
+    {
+        sha.UpdateData(fileName);
+
+        FILE* file = fopen(fileName.c_str(), "rb");
+        if (!file)
+            return;
+
+        uint8 buffer[4096];
+        size_t count;
+        while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+            sha.UpdateData(buffer, int(count));
+
+        fclose(file);
+    }
+}
+
 namespace MMAP
 {
     MapBuilder::MapBuilder(float maxWalkableAngle, bool skipLiquid,
         bool skipContinents, bool skipJunkMaps, bool skipBattlegrounds,
-        bool debugOutput, bool bigBaseUnit, const char* offMeshFilePath) :
+        bool debugOutput, bool bigBaseUnit, const char* offMeshFilePath,
+        bool incremental) :
         m_terrainBuilder     (NULL),
         m_debugOutput        (debugOutput),
+        m_incremental        (incremental),
         m_offMeshFilePath    (offMeshFilePath),
         m_skipContinents     (skipContinents),
         m_skipJunkMaps       (skipJunkMaps),
         m_skipBattlegrounds  (skipBattlegrounds),
         m_maxWalkableAngle   (maxWalkableAngle),
+        m_skipLiquid         (skipLiquid),
         m_bigBaseUnit        (bigBaseUnit),
         m_rcContext          (NULL),
         _cancelationToken    (false)
@@ -160,16 +185,28 @@ namespace MMAP
 
     void MapBuilder::WorkerThread()
     {
+        // each thread loads terrain and models on its own, only the navmesh of a map is shared
+        TerrainBuilder terrainBuilder(m_skipLiquid);
+        rcContext context(false);
+
         while (1)
         {
-            uint32 mapId = 0;
+            TileInfo tileInfo;
 
-            _queue.WaitAndPop(mapId);
+            _queue.WaitAndPop(tileInfo);
 
             if (_cancelationToken)
                 return;
 
-            buildMap(mapId);
+            MapBuildInfo* mapInfo = tileInfo.m_mapInfo;
+            buildMapTile(tileInfo.m_mapId, tileInfo.m_tileX, tileInfo.m_tileY, mapInfo->m_navMesh, &terrainBuilder, &context);
+
+            if (--mapInfo->m_pendingTiles == 0)
+            {
+                dtFreeNavMesh(mapInfo->m_navMesh);
+                mapInfo->m_navMesh = NULL;
+                printf("[Map %03i] Complete!\n", tileInfo.m_mapId);
+            }
         }
     }
 
@@ -188,12 +225,40 @@ namespace MMAP
         for (TileList::iterator it = m_tiles.begin(); it != m_tiles.end(); ++it)
         {
             uint32 mapId = it->m_mapId;
-            if (!shouldSkipMap(mapId))
+            if (shouldSkipMap(mapId))
+                continue;
+
+            if (threads <= 0)
             {
-                if (threads > 0)
-                    _queue.Push(mapId);
-                else
-                    buildMap(mapId);
+                buildMap(mapId);
+                continue;
+            }
+
+            // queue every tile of the map, biggest maps first so they do not end up being built by a single thread
+            std::set<uint32>* tiles = prepareTileList(mapId);
+            if (tiles->empty())
+            {
+                printf("[Map %03i] Complete!\n", mapId);
+                continue;
+            }
+
+            MapBuildInfo& mapInfo = m_mapBuildInfo[mapId];
+            buildNavMesh(mapId, mapInfo.m_navMesh);
+            if (!mapInfo.m_navMesh)
+            {
+                printf("[Map %03i] Failed creating navmesh!\n", mapId);
+                continue;
+            }
+
+            printf("[Map %03i] We have %u tiles.                          \n", mapId, (unsigned int)tiles->size());
+            mapInfo.m_pendingTiles = uint32(tiles->size());
+            for (std::set<uint32>::iterator itr = tiles->begin(); itr != tiles->end(); ++itr)
+            {
+                TileInfo tileInfo;
+                tileInfo.m_mapId = mapId;
+                StaticMapTree::unpackTileID((*itr), tileInfo.m_tileX, tileInfo.m_tileY);
+                tileInfo.m_mapInfo = &mapInfo;
+                _queue.Push(tileInfo);
             }
         }
 
@@ -338,7 +403,7 @@ namespace MMAP
         getTileBounds(tileX, tileY, data.solidVerts.getCArray(), data.solidVerts.size() / 3, bmin, bmax);
 
         // build navmesh tile
-        buildMoveMapTile(mapId, tileX, tileY, data, bmin, bmax, navMesh);
+        buildMoveMapTile(mapId, tileX, tileY, data, bmin, bmax, navMesh, m_terrainBuilder, m_rcContext);
         fclose(file);
     }
 
@@ -353,17 +418,13 @@ namespace MMAP
             return;
         }
 
-        buildTile(mapID, tileX, tileY, navMesh);
+        buildTile(mapID, tileX, tileY, navMesh, m_terrainBuilder, m_rcContext);
         dtFreeNavMesh(navMesh);
     }
 
     /**************************************************************************/
-    void MapBuilder::buildMap(uint32 mapID)
+    std::set<uint32>* MapBuilder::prepareTileList(uint32 mapID)
     {
-#ifndef __APPLE__
-        //printf("[Thread %u] Building map %03u:\n", uint32(ACE_Thread::self()), mapID);
-#endif
-
         std::set<uint32>* tiles = getTileList(mapID);
 
         // make sure we process maps which don't have tiles
@@ -379,6 +440,18 @@ namespace MMAP
                     tiles->insert(StaticMapTree::packTileID(i, j));
         }
 
+        return tiles;
+    }
+
+    /**************************************************************************/
+    void MapBuilder::buildMap(uint32 mapID)
+    {
+#ifndef __APPLE__
+        //printf("[Thread %u] Building map %03u:\n", uint32(ACE_Thread::self()), mapID);
+#endif
+
+        std::set<uint32>* tiles = prepareTileList(mapID);
+
         if (!tiles->empty())
         {
             // build navMesh
@@ -399,10 +472,7 @@ namespace MMAP
                 // unpack tile coords
                 StaticMapTree::unpackTileID((*it), tileX, tileY);
 
-                if (shouldSkipTile(mapID, tileX, tileY))
-                    continue;
-
-                buildTile(mapID, tileX, tileY, navMesh);
+                buildMapTile(mapID, tileX, tileY, navMesh, m_terrainBuilder, m_rcContext);
             }
 
             dtFreeNavMesh(navMesh);
@@ -412,21 +482,55 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    void MapBuilder::buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh)
+    void MapBuilder::buildMapTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh, TerrainBuilder* terrainBuilder, rcContext* context)
+    {
+        if (!m_incremental)
+        {
+            if (!shouldSkipTile(mapID, tileX, tileY))
+                buildTile(mapID, tileX, tileY, navMesh, terrainBuilder, context);
+            return;
+        }
+
+        // tiles without navmesh data are marked as empty, the others also need an intact .mmtile
+        std::string hash = getTileInputHash(mapID, tileX, tileY, navMesh, terrainBuilder);
+        std::string storedHash = readTileInputHash(mapID, tileX, tileY);
+        if (storedHash == hash + " empty" || (storedHash == hash && isTileFileValid(mapID, tileX, tileY)))
+        {
+            printf("[Map %03i] Tile [%02u,%02u] is up to date\n", mapID, tileX, tileY);
+            return;
+        }
+
+        // an outdated tile must not be left behind when the new one turns out empty
+        char fileName[255];
+        sprintf(fileName, "mmaps/%03u%02i%02i.mmtile", mapID, tileY, tileX);
+        remove(fileName);
+
+        // the hash is left untouched after a failure so the tile is built again next time
+        if (!buildTile(mapID, tileX, tileY, navMesh, terrainBuilder, context))
+        {
+            printf("[Map %03i] Tile [%02u,%02u] failed, it will be rebuilt\n", mapID, tileX, tileY);
+            return;
+        }
+
+        writeTileInputHash(mapID, tileX, tileY, isTileFileValid(mapID, tileX, tileY) ? hash : hash + " empty");
+    }
+
+    /**************************************************************************/
+    bool MapBuilder::buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh, TerrainBuilder* terrainBuilder, rcContext* context)
     {
         printf("[Map %03i] Building tile [%02u,%02u]\n", mapID, tileX, tileY);
 
         MeshData meshData;
 
         // get heightmap data
-        m_terrainBuilder->loadMap(mapID, tileX, tileY, meshData);
+        terrainBuilder->loadMap(mapID, tileX, tileY, meshData);
 
         // get model data
-        m_terrainBuilder->loadVMap(mapID, tileY, tileX, meshData);
+        terrainBuilder->loadVMap(mapID, tileY, tileX, meshData);
 
         // if there is no data, give up now
         if (!meshData.solidVerts.size() && !meshData.liquidVerts.size())
-            return;
+            return true;
 
         // remove unused vertices
         TerrainBuilder::cleanVertices(meshData.solidVerts, meshData.solidTris);
@@ -438,16 +542,16 @@ namespace MMAP
         allVerts.append(meshData.solidVerts);
 
         if (!allVerts.size())
-            return;
+            return true;
 
         // get bounds of current tile
         float bmin[3], bmax[3];
         getTileBounds(tileX, tileY, allVerts.getCArray(), allVerts.size() / 3, bmin, bmax);
 
-        m_terrainBuilder->loadOffMeshConnections(mapID, tileX, tileY, meshData, m_offMeshFilePath);
+        terrainBuilder->loadOffMeshConnections(mapID, tileX, tileY, meshData, m_offMeshFilePath);
 
         // build navmesh tile
-        buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh);
+        return buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh, terrainBuilder, context);
     }
 
     /**************************************************************************/
@@ -526,9 +630,9 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    void MapBuilder::buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY,
+    bool MapBuilder::buildMoveMapTile(uint32 mapID, uint32 tileX, uint32 tileY,
         MeshData &meshData, float bmin[3], float bmax[3],
-        dtNavMesh* navMesh)
+        dtNavMesh* navMesh, TerrainBuilder* terrainBuilder, rcContext* context)
     {
         // console output
         char tileString[20];
@@ -612,7 +716,7 @@ namespace MMAP
 
                 // build heightfield
                 tile.solid = rcAllocHeightfield();
-                if (!tile.solid || !rcCreateHeightfield(m_rcContext, *tile.solid, tileCfg.width, tileCfg.height, tileCfg.bmin, tileCfg.bmax, tileCfg.cs, tileCfg.ch))
+                if (!tile.solid || !rcCreateHeightfield(context, *tile.solid, tileCfg.width, tileCfg.height, tileCfg.bmin, tileCfg.bmax, tileCfg.cs, tileCfg.ch))
                 {
                     printf("%s Failed building heightfield!            \n", tileString);
                     continue;
@@ -621,45 +725,45 @@ namespace MMAP
                 // mark all walkable tiles, both liquids and solids
                 unsigned char* triFlags = new unsigned char[tTriCount];
                 memset(triFlags, NAV_GROUND, tTriCount*sizeof(unsigned char));
-                rcClearUnwalkableTriangles(m_rcContext, tileCfg.walkableSlopeAngle, tVerts, tVertCount, tTris, tTriCount, triFlags);
-                rcRasterizeTriangles(m_rcContext, tVerts, tVertCount, tTris, triFlags, tTriCount, *tile.solid, config.walkableClimb);
+                rcClearUnwalkableTriangles(context, tileCfg.walkableSlopeAngle, tVerts, tVertCount, tTris, tTriCount, triFlags);
+                rcRasterizeTriangles(context, tVerts, tVertCount, tTris, triFlags, tTriCount, *tile.solid, config.walkableClimb);
                 delete[] triFlags;
 
-                rcFilterLowHangingWalkableObstacles(m_rcContext, config.walkableClimb, *tile.solid);
-                rcFilterLedgeSpans(m_rcContext, tileCfg.walkableHeight, tileCfg.walkableClimb, *tile.solid);
-                rcFilterWalkableLowHeightSpans(m_rcContext, tileCfg.walkableHeight, *tile.solid);
+                rcFilterLowHangingWalkableObstacles(context, config.walkableClimb, *tile.solid);
+                rcFilterLedgeSpans(context, tileCfg.walkableHeight, tileCfg.walkableClimb, *tile.solid);
+                rcFilterWalkableLowHeightSpans(context, tileCfg.walkableHeight, *tile.solid);
 
-                rcRasterizeTriangles(m_rcContext, lVerts, lVertCount, lTris, lTriFlags, lTriCount, *tile.solid, config.walkableClimb);
+                rcRasterizeTriangles(context, lVerts, lVertCount, lTris, lTriFlags, lTriCount, *tile.solid, config.walkableClimb);
 
                 // compact heightfield spans
                 tile.chf = rcAllocCompactHeightfield();
-                if (!tile.chf || !rcBuildCompactHeightfield(m_rcContext, tileCfg.walkableHeight, tileCfg.walkableClimb, *tile.solid, *tile.chf))
+                if (!tile.chf || !rcBuildCompactHeightfield(context, tileCfg.walkableHeight, tileCfg.walkableClimb, *tile.solid, *tile.chf))
                 {
                     printf("%s Failed compacting heightfield!            \n", tileString);
                     continue;
                 }
 
                 // build polymesh intermediates
-                if (!rcErodeWalkableArea(m_rcContext, config.walkableRadius, *tile.chf))
+                if (!rcErodeWalkableArea(context, config.walkableRadius, *tile.chf))
                 {
                     printf("%s Failed eroding area!                    \n", tileString);
                     continue;
                 }
 
-                if (!rcBuildDistanceField(m_rcContext, *tile.chf))
+                if (!rcBuildDistanceField(context, *tile.chf))
                 {
                     printf("%s Failed building distance field!         \n", tileString);
                     continue;
                 }
 
-                if (!rcBuildRegions(m_rcContext, *tile.chf, tileCfg.borderSize, tileCfg.minRegionArea, tileCfg.mergeRegionArea))
+                if (!rcBuildRegions(context, *tile.chf, tileCfg.borderSize, tileCfg.minRegionArea, tileCfg.mergeRegionArea))
                 {
                     printf("%s Failed building regions!                \n", tileString);
                     continue;
                 }
 
                 tile.cset = rcAllocContourSet();
-                if (!tile.cset || !rcBuildContours(m_rcContext, *tile.chf, tileCfg.maxSimplificationError, tileCfg.maxEdgeLen, *tile.cset))
+                if (!tile.cset || !rcBuildContours(context, *tile.chf, tileCfg.maxSimplificationError, tileCfg.maxEdgeLen, *tile.cset))
                 {
                     printf("%s Failed building contours!               \n", tileString);
                     continue;
@@ -667,14 +771,14 @@ namespace MMAP
 
                 // build polymesh
                 tile.pmesh = rcAllocPolyMesh();
-                if (!tile.pmesh || !rcBuildPolyMesh(m_rcContext, *tile.cset, tileCfg.maxVertsPerPoly, *tile.pmesh))
+                if (!tile.pmesh || !rcBuildPolyMesh(context, *tile.cset, tileCfg.maxVertsPerPoly, *tile.pmesh))
                 {
                     printf("%s Failed building polymesh!               \n", tileString);
                     continue;
                 }
 
                 tile.dmesh = rcAllocPolyMeshDetail();
-                if (!tile.dmesh || !rcBuildPolyMeshDetail(m_rcContext, *tile.pmesh, *tile.chf, tileCfg.detailSampleDist, tileCfg.detailSampleMaxError, *tile.dmesh))
+                if (!tile.dmesh || !rcBuildPolyMeshDetail(context, *tile.pmesh, *tile.chf, tileCfg.detailSampleDist, tileCfg.detailSampleMaxError, *tile.dmesh))
                 {
                     printf("%s Failed building polymesh detail!        \n", tileString);
                     continue;
@@ -703,9 +807,12 @@ namespace MMAP
             delete[] pmmerge;
             delete[] dmmerge;
             delete[] tiles;
-            return;
+            return false;
         }
-        rcMergePolyMeshes(m_rcContext, pmmerge, nmerge, *iv.polyMesh);
+        // a failed sub tile leaves a hole in the tile, it has to be built again
+        bool success = nmerge == TILES_PER_MAP * TILES_PER_MAP;
+
+        rcMergePolyMeshes(context, pmmerge, nmerge, *iv.polyMesh);
 
         iv.polyMeshDetail = rcAllocPolyMeshDetail();
         if (!iv.polyMeshDetail)
@@ -714,9 +821,9 @@ namespace MMAP
             delete[] pmmerge;
             delete[] dmmerge;
             delete[] tiles;
-            return;
+            return false;
         }
-        rcMergePolyMeshDetails(m_rcContext, dmmerge, nmerge, *iv.polyMeshDetail);
+        rcMergePolyMeshDetails(context, dmmerge, nmerge, *iv.polyMeshDetail);
 
         // free things up
         delete[] pmmerge;
@@ -775,11 +882,13 @@ namespace MMAP
             if (params.nvp > DT_VERTS_PER_POLYGON)
             {
                 printf("%s Invalid verts-per-polygon value!        \n", tileString);
+                success = false;
                 break;
             }
             if (params.vertCount >= 0xffff)
             {
                 printf("%s Too many vertices!                      \n", tileString);
+                success = false;
                 break;
             }
             if (!params.vertCount || !params.verts)
@@ -803,6 +912,7 @@ namespace MMAP
             if (!params.detailMeshes || !params.detailVerts || !params.detailTris)
             {
                 printf("%s No detail mesh to build tile!           \n", tileString);
+                success = false;
                 break;
             }
 
@@ -810,17 +920,18 @@ namespace MMAP
             if (!dtCreateNavMeshData(&params, &navData, &navDataSize))
             {
                 printf("%s Failed building navmesh tile!           \n", tileString);
+                success = false;
                 break;
             }
 
-            dtTileRef tileRef = 0;
-            printf("%s Adding tile to navmesh...\n", tileString);
-            // DT_TILE_FREE_DATA tells detour to unallocate memory when the tile
-            // is removed via removeTile()
-            dtStatus dtResult = navMesh->addTile(navData, navDataSize, DT_TILE_FREE_DATA, 0, &tileRef);
-            if (!tileRef || dtResult != DT_SUCCESS)
+            // the tile is not added to the navmesh of the map: neighbours built on other threads would
+            // link into its data while it is written. Check what addTile would check instead.
+            dtMeshHeader const* tileHeader = (dtMeshHeader const*)navData;
+            if (tileHeader->magic != DT_NAVMESH_MAGIC || tileHeader->version != DT_NAVMESH_VERSION ||
+                tileHeader->x != params.tileX || tileHeader->y != params.tileY)
             {
-                printf("%s Failed adding tile to navmesh!           \n", tileString);
+                printf("%s Invalid navmesh tile data!           \n", tileString);
+                success = false;
                 break;
             }
 
@@ -833,7 +944,7 @@ namespace MMAP
                 char message[1024];
                 sprintf(message, "[Map %03i] Failed to open %s for writing!\n", mapID, fileName);
                 perror(message);
-                navMesh->removeTile(tileRef, NULL, NULL);
+                success = false;
                 break;
             }
 
@@ -841,19 +952,23 @@ namespace MMAP
 
             // write header
             MmapTileHeader header;
-            header.usesLiquids = m_terrainBuilder->usesLiquids();
+            header.usesLiquids = terrainBuilder->usesLiquids();
             header.size = uint32(navDataSize);
-            fwrite(&header, sizeof(MmapTileHeader), 1, file);
+            bool written = fwrite(&header, sizeof(MmapTileHeader), 1, file) == 1;
 
             // write data
-            fwrite(navData, sizeof(unsigned char), navDataSize, file);
-            fclose(file);
-
-            // now that tile is written to disk, we can unload it
-            navMesh->removeTile(tileRef, NULL, NULL);
+            written = written && fwrite(navData, sizeof(unsigned char), navDataSize, file) == size_t(navDataSize);
+            if (fclose(file) != 0 || !written)
+            {
+                printf("%s Failed writing %s!           \n", tileString, fileName);
+                remove(fileName);
+                success = false;
+            }
         }
         while (0);
 
+        dtFree(navData);
+
         if (m_debugOutput)
         {
             // restore padding so that the debug visualization is correct
@@ -867,6 +982,8 @@ namespace MMAP
             iv.generateObjFile(mapID, tileX, tileY, meshData);
             iv.writeIV(mapID, tileX, tileY);
         }
+
+        return success;
     }
 
     /**************************************************************************/
@@ -1005,4 +1122,116 @@ namespace MMAP
         return true;
     }
 
+    /**************************************************************************/
+    std::string MapBuilder::getTileInputHash(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh, TerrainBuilder* terrainBuilder)
+    {
+        SHA1Hash sha;
+        sha.Initialize();
+
+        // settings and navmesh params that end up in the tile data
+        uint32 versions[2] = { MMAP_VERSION, DT_NAVMESH_VERSION };
+        sha.UpdateData((uint8 const*)versions, sizeof(versions));
+        sha.UpdateData((uint8 const*)&m_maxWalkableAngle, sizeof(m_maxWalkableAngle));
+        uint8 settings[2] = { uint8(terrainBuilder->usesLiquids()), uint8(m_bigBaseUnit) };
+        sha.UpdateData(settings, sizeof(settings));
+        sha.UpdateData((uint8 const*)navMesh->getParams(), sizeof(dtNavMeshParams));
+
+        // terrain of the tile and the borders of its neighbours, see TerrainBuilder::loadMap
+        uint32 const mapTiles[5][2] = { { tileX, tileY }, { tileX + 1, tileY }, { tileX - 1, tileY }, { tileX, tileY + 1 }, { tileX, tileY - 1 } };
+        char fileName[255];
+        for (uint8 i = 0; i < 5; ++i)
+        {
+            sprintf(fileName, "maps/%03u%02u%02u.map", mapID, mapTiles[i][1], mapTiles[i][0]);
+            HashFile(sha, fileName);
+        }
+
+        // model spawns and the models they use, see TerrainBuilder::loadVMap
+        sprintf(fileName, "vmaps/%03u.vmtree", mapID);
+        HashFile(sha, fileName);
+        HashFile(sha, "vmaps/" + StaticMapTree::getTileFileName(mapID, tileY, tileX));
+
+        std::set<std::string> modelNames;
+        terrainBuilder->getVMapModelNames(mapID, tileY, tileX, modelNames);
+        for (std::set<std::string>::const_iterator itr = modelNames.begin(); itr != modelNames.end(); ++itr)
+            HashFile(sha, "vmaps/" + *itr);
+
+        // off mesh connections of this tile, see TerrainBuilder::loadOffMeshConnections
+        if (m_offMeshFilePath)
+        {
+            if (FILE* fp = fopen(m_offMeshFilePath, "rb"))
+            {
+                char buf[512];
+                while (fgets(buf, 512, fp))
+                {
+                    uint32 mid, tx, ty;
+                    if (sscanf(buf, "%u %u,%u", &mid, &tx, &ty) == 3 && mapID == mid && tileX == tx && tileY == ty)
+                        sha.UpdateData(std::string(buf));
+                }
+                fclose(fp);
+            }
+        }
+
+        sha.Finalize();
+        return ByteArrayToHexStr(sha.GetDigest(), sha.GetLength());
+    }
+
+    /**************************************************************************/
+    std::string MapBuilder::readTileInputHash(uint32 mapID, uint32 tileX, uint32 tileY)
+    {
+        char fileName[255];
+        sprintf(fileName, "mmaps/%03u%02i%02i.mmhash", mapID, tileY, tileX);
+        FILE* file = fopen(fileName, "rb");
+        if (!file)
+            return "";
+
+        char hash[SHA_DIGEST_LENGTH * 2 + 8];
+        size_t count = fread(hash, sizeof(char), sizeof(hash), file);
+        fclose(file);
+        return std::string(hash, count);
+    }
+
+    /**************************************************************************/
+    bool MapBuilder::isTileFileValid(uint32 mapID, uint32 tileX, uint32 tileY)
+    {
+        char fileName[255];
+        sprintf(fileName, "mmaps/%03u%02i%02i.mmtile", mapID, tileY, tileX);
+        FILE* file = fopen(fileName, "rb");
+        if (!file)
+            return false;
+
+        MmapTileHeader header;
+        bool valid = fread(&header, sizeof(MmapTileHeader), 1, file) == 1 &&
+            header.mmapMagic == MMAP_MAGIC && header.dtVersion == uint32(DT_NAVMESH_VERSION) &&
+            header.mmapVersion == MMAP_VERSION;
+
+        // the data has to be complete as well
+        if (valid)
+        {
+            long dataStart = ftell(file);
+            valid = fseek(file, 0, SEEK_END) == 0 && ftell(file) - dataStart == long(header.size);
+        }
+
+        fclose(file);
+        return valid;
+    }
+
+    /**************************************************************************/
+    void MapBuilder::writeTileInputHash(uint32 mapID, uint32 tileX, uint32 tileY, std::string const& hash)
+    {
+        // only written after a successful build, tiles without navmesh data carry an " empty" mark
+        char fileName[255];
+        sprintf(fileName, "mmaps/%03u%02i%02i.mmhash", mapID, tileY, tileX);
+        FILE* file = fopen(fileName, "wb");
+        if (!file)
+        {
+            char message[1024];
+            sprintf(message, "[Map %03i] Failed to open %s for writing!\n", mapID, fileName);
+            perror(message);
+            return;
+        }
+
+        fwrite(hash.c_str(), sizeof(char), hash.size(), file);
+        fclose(file);
+    }
+
 }
@@ -28,6 +28,8 @@
 #include <vector>
 #include <set>
 #include <list>
+#include <map>
+#include <string>
 #include <atomic>
 #include <thread>
 
@@ -53,6 +55,25 @@ namespace MMAP
 
     typedef std::list<MapTiles> TileList;
 
+    // navmesh of a map whose tiles are built by the worker threads, freed by the one finishing its last tile
+    struct MapBuildInfo
+    {
+        MapBuildInfo() : m_navMesh(NULL), m_pendingTiles(0) {}
+
+        dtNavMesh* m_navMesh;
+        std::atomic<uint32> m_pendingTiles;
+    };
+
+    struct TileInfo
+    {
+        TileInfo() : m_mapId(uint32(-1)), m_tileX(0), m_tileY(0), m_mapInfo(NULL) {}
+
+        uint32 m_mapId;
+        uint32 m_tileX;
+        uint32 m_tileY;
+        MapBuildInfo* m_mapInfo;
+    };
+
     struct Tile
     {
         Tile() : chf(NULL), solid(NULL), cset(NULL), pmesh(NULL), dmesh(NULL) {}
@@ -81,7 +102,8 @@ namespace MMAP
                 bool skipBattlegrounds   = false,
                 bool debugOutput         = false,
                 bool bigBaseUnit         = false,
-                const char* offMeshFilePath = NULL);
+                const char* offMeshFilePath = NULL,
+                bool incremental         = false);
 
             ~MapBuilder();
 
@@ -93,6 +115,7 @@ namespace MMAP
             void buildSingleTile(uint32 mapID, uint32 tileX, uint32 tileY);
 
             // builds list of maps, then builds all of mmap tiles (based on the skip settings)
+            // the tiles of all maps are spread over the worker threads
             void buildAllMaps(int threads);
 
             void WorkerThread();
@@ -101,19 +124,26 @@ namespace MMAP
             // detect maps and tiles
             void discoverTiles();
             std::set<uint32>* getTileList(uint32 mapID);
+            // tile list of the map, or all tiles within the bounds of its models for maps without tiles
+            std::set<uint32>* prepareTileList(uint32 mapID);
 
             void buildNavMesh(uint32 mapID, dtNavMesh* &navMesh);
 
-            void buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh);
+            // builds the tile unless it is up to date (based on m_incremental)
+            void buildMapTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh, TerrainBuilder* terrainBuilder, rcContext* context);
+            // false if building failed, a tile without navmesh data is not a failure
+            bool buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh, TerrainBuilder* terrainBuilder, rcContext* context);
 
             // move map building
-            void buildMoveMapTile(uint32 mapID,
+            bool buildMoveMapTile(uint32 mapID,
                 uint32 tileX,
                 uint32 tileY,
                 MeshData &meshData,
                 float bmin[3],
                 float bmax[3],
-                dtNavMesh* navMesh);
+                dtNavMesh* navMesh,
+                TerrainBuilder* terrainBuilder,
+                rcContext* context);
 
             void getTileBounds(uint32 tileX, uint32 tileY,
                 float* verts, int vertCount,
@@ -124,10 +154,17 @@ namespace MMAP
             bool isTransportMap(uint32 mapID);
             bool shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY);
 
+            // incremental builds compare a hash of everything a tile is built from with the one stored next to it
+            std::string getTileInputHash(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh, TerrainBuilder* terrainBuilder);
+            std::string readTileInputHash(uint32 mapID, uint32 tileX, uint32 tileY);
+            void writeTileInputHash(uint32 mapID, uint32 tileX, uint32 tileY, std::string const& hash);
+            bool isTileFileValid(uint32 mapID, uint32 tileX, uint32 tileY);
+
             TerrainBuilder* m_terrainBuilder;
             TileList m_tiles;
 
             bool m_debugOutput;
+            bool m_incremental;
 
             const char* m_offMeshFilePath;
             bool m_skipContinents;
@@ -135,13 +172,17 @@ namespace MMAP
             bool m_skipBattlegrounds;
 
             float m_maxWalkableAngle;
+            bool m_skipLiquid;
             bool m_bigBaseUnit;
 
             // build performance - not really used for now
             rcContext* m_rcContext;
 
+            // the navmesh of a map only provides the params for its tiles, tiles are never added to it
+            std::map<uint32, MapBuildInfo> m_mapBuildInfo;
+
             std::vector<std::thread> _workerThreads;
-            ProducerConsumerQueue<uint32> _queue;
+            ProducerConsumerQueue<TileInfo> _queue;
             std::atomic<bool> _cancelationToken;
     };
 }
@@ -784,6 +784,28 @@ namespace MMAP
         return retval;
     }
 
+    /**************************************************************************/
+    void TerrainBuilder::getVMapModelNames(uint32 mapID, uint32 tileX, uint32 tileY, std::set<std::string> &modelNames)
+    {
+        VMapManager2 vmapManager;
+        if (vmapManager.loadMap("vmaps", mapID, tileX, tileY) == VMAP_LOAD_RESULT_ERROR)
+            return;
+
+        InstanceTreeMap instanceTrees;
+        vmapManager.getInstanceMapTree(instanceTrees);
+
+        ModelInstance* models = NULL;
+        uint32 count = 0;
+        if (instanceTrees[mapID])
+            instanceTrees[mapID]->getModelInstances(models, count);
+
+        for (uint32 i = 0; i < count; ++i)
+            if (models[i].getWorldModel())
+                modelNames.insert(models[i].name);
+
+        vmapManager.unloadMap(mapID, tileX, tileY);
+    }
+
     /**************************************************************************/
     void TerrainBuilder::transform(std::vector<G3D::Vector3> &source, std::vector<G3D::Vector3> &transformedVertices, float scale, G3D::Matrix3 &rotation, G3D::Vector3 &position)
     {
@@ -26,6 +26,9 @@
 #include "G3D/Vector3.h"
 #include "G3D/Matrix3.h"
 
+#include <set>
+#include <string>
+
 namespace MMAP
 {
     enum Spot
@@ -86,6 +89,8 @@ namespace MMAP
             void loadMap(uint32 mapID, uint32 tileX, uint32 tileY, MeshData &meshData);
             bool loadVMap(uint32 mapID, uint32 tileX, uint32 tileY, MeshData &meshData);
             void loadOffMeshConnections(uint32 mapID, uint32 tileX, uint32 tileY, MeshData &meshData, const char* offMeshFilePath);
+            // names of the model files loadVMap would add to the tile
+            void getVMapModelNames(uint32 mapID, uint32 tileX, uint32 tileY, std::set<std::string> &modelNames);
 
             bool usesLiquids() const { return !m_skipLiquid; }
 